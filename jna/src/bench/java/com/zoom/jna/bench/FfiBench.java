@@ -0,0 +1,221 @@
+package com.zoom.jna.bench;
+
+import com.sun.jna.CallbackThreadInitializer;
+import com.sun.jna.Library;
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+import com.zoom.jna.ZoomSDK;
+
+import java.io.IOException;
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.lang.management.ThreadMXBean;
+import java.lang.reflect.Method;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.Paths;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.concurrent.ArrayBlockingQueue;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.atomic.AtomicLong;
+
+/**
+ * JNA version of the cross-binding audio callback benchmark (src/bench/ffi_bench.c)
+ *
+ * Usage: gradle ffiBench [-PbenchArgs="frames participants paced"]
+ *
+ * Needs libzoomsdk_c built with -DFAKE_MEETINGSDK=ON in ../src/build. Same
+ * workload as the C, Go and Python versions: the stand-in SDK's media thread
+ * delivers `frames` 10 ms PCM frames per stream (ZOOM_FAKE_SDK_AUDIO_FRAMES)
+ * from a native thread; the callback copies each frame into a byte[] and
+ * offers it to a consumer thread through a queue bounded at 1000 frames.
+ * Callback timings come from the stand-in SDK's delivery report
+ * (ZOOM_FAKE_SDK_DELIVERY_REPORT).
+ *
+ * Two rows are printed: "jna" with JNA's defaults, which attach the SDK thread
+ * to the JVM and detach it again on every callback, and "jna-keep", which keeps
+ * it attached through a CallbackThreadInitializer. Each row joins a short
+ * warm-up meeting first so the JIT has compiled the callback path.
+ *
+ * bytes/frame comes from the JVM's allocated-bytes counter of all threads
+ * during the timed meeting, joining and leaving included (JDK 21+, "-" before);
+ * the JVM has no allocation count, so allocs/frame is "-". gc is the number of
+ * collections during the timed meeting.
+ */
+public final class FfiBench {
+
+    private static final int QUEUE_FRAMES = 1000;
+    private static final byte[] END = new byte[0];
+
+    // The stand-in SDK reads its ZOOM_FAKE_SDK_* variables for every meeting
+    // service, from the process environment the JVM cannot change itself
+    interface CLibrary extends Library {
+        CLibrary INSTANCE = Native.load("c", CLibrary.class);
+
+        int dup(int fd);
+
+        int dup2(int oldfd, int newfd);
+
+        int open(String path, int flags);
+
+        long write(int fd, byte[] buffer, long count);
+
+        int getpid();
+
+        int setenv(String name, String value, int overwrite);
+    }
+
+    static final class Sink implements ZoomSDK.OnAudioDataReceivedCallback {
+        final BlockingQueue<byte[]> frames = new ArrayBlockingQueue<>(QUEUE_FRAMES);
+        final AtomicLong dropped = new AtomicLong();
+        long consumed;
+
+        @Override
+        public void invoke(ZoomSDK.MeetingHandle meeting, Pointer data, int length, int type, int nodeId) {
+            if (!frames.offer(data.getByteArray(0, length))) {
+                dropped.incrementAndGet();
+            }
+        }
+
+        void consume() {
+            try {
+                while (true) {
+                    byte[] frame = frames.take();
+                    if (frame == END) {
+                        return;
+                    }
+                    consumed += frame.length;
+                }
+            } catch (InterruptedException e) {
+                Thread.currentThread().interrupt();
+            }
+        }
+    }
+
+    private FfiBench() {}
+
+    public static void main(String[] args) throws Exception {
+        int frames = args.length > 0 ? Integer.parseInt(args[0]) : 200000;
+        int participants = args.length > 1 ? Integer.parseInt(args[1]) : 0;
+        boolean paced = args.length > 2 && Integer.parseInt(args[2]) != 0;
+        if (frames <= 0 || participants < 0) {
+            System.err.println("usage: FfiBench [frames=200000] [participants=0] [paced=0]");
+            System.exit(2);
+        }
+
+        // Fast joins and no share; the stand-in SDK delivers the audio
+        CLibrary libc = CLibrary.INSTANCE;
+        for (String name : new String[] {"AUTH_MS", "JOIN_MS", "AUDIO_JOIN_MS", "SHARE_FPS"}) {
+            libc.setenv("ZOOM_FAKE_SDK_" + name, "0", 0);
+        }
+        libc.setenv("ZOOM_FAKE_SDK_PARTICIPANTS", Integer.toString(participants), 1);
+        libc.setenv("ZOOM_FAKE_SDK_UNPACED", paced ? "0" : "1", 1);
+        Path reportPath = Paths.get(System.getProperty("java.io.tmpdir"), "ffi_bench." + libc.getpid() + ".report");
+        libc.setenv("ZOOM_FAKE_SDK_DELIVERY_REPORT", reportPath.toString(), 1);
+
+        // The C API reports every callback change on stdout; keep the rows readable
+        System.out.flush();
+        int report = libc.dup(1);
+        libc.dup2(libc.open("/dev/null", 1 /* O_WRONLY */), 1);
+
+        print(report, String.format("%-8s %9s %9s %8s %8s %9s %10s %12s %11s %5s %8s %6s%n", "binding", "frames",
+            "ns/frame", "p50(ns)", "p99(ns)", "max(ns)", "frames/s", "allocs/frame", "bytes/frame", "gc", "dropped",
+            "late"));
+        // Generous: a paced run takes 10 ms per frame
+        long timeoutMs = (30 + (paced ? frames / 100 : frames / 1000)) * 1000L;
+        for (boolean keepAttached : new boolean[] {false, true}) {
+            Sink sink = new Sink();
+            if (keepAttached) {
+                Native.setCallbackThreadInitializer(sink, new CallbackThreadInitializer(true, false, "zoom-media"));
+            }
+            Thread consumer = new Thread(sink::consume, "consumer");
+            consumer.start();
+
+            runMeeting(sink, frames / 10 + 1, reportPath, timeoutMs);
+            sink.dropped.set(0);
+
+            long bytes = allocatedBytes();
+            long collections = collections();
+            Map<String, Long> stats = runMeeting(sink, frames, reportPath, timeoutMs);
+            sink.frames.put(END);
+            consumer.join();
+            bytes = bytes < 0 ? -1 : allocatedBytes() - bytes;
+            collections = collections() - collections;
+
+            long count = stats.get("frames");
+            long elapsed = Math.max(1, stats.get("elapsed_ns"));
+            print(report, String.format("%-8s %9d %9.1f %8d %8d %9d %10.0f %12s %11s %5d %8d %6d%n",
+                keepAttached ? "jna-keep" : "jna", count, (double) elapsed / count, stats.get("p50_ns"),
+                stats.get("p99_ns"), stats.get("max_ns"), count * 1e9 / elapsed, "-",
+                bytes < 0 ? "-" : String.format("%.1f", (double) bytes / count), collections, sink.dropped.get(),
+                stats.get("late")));
+        }
+    }
+
+    // Joins a stand-in meeting that delivers frames per stream; returns its delivery report
+    private static Map<String, Long> runMeeting(Sink sink, int frames, Path reportPath, long timeoutMs)
+        throws IOException, InterruptedException {
+        CLibrary.INSTANCE.setenv("ZOOM_FAKE_SDK_AUDIO_FRAMES", Integer.toString(frames), 1);
+        Files.deleteIfExists(reportPath);
+
+        ZoomSDK sdk = ZoomSDK.INSTANCE;
+        ZoomSDK.ZoomSDKHandle handle = sdk.zoom_sdk_create("bench", "bench");
+        ZoomSDK.MeetingHandle meeting = handle == null ? null
+            : sdk.zoom_meeting_create_and_join(handle, "1000", "bench", "bench", null, 1, 0);
+        if (meeting == null) {
+            System.err.println("failed to join; build with -DFAKE_MEETINGSDK=ON");
+            System.exit(1);
+        }
+        sdk.zoom_meeting_set_audio_callback(meeting, sink);
+        Thread loop = new Thread(() -> sdk.zoom_sdk_run_loop(handle), "sdk-loop");
+        loop.start();
+
+        long deadline = System.nanoTime() + timeoutMs * 1_000_000L;
+        while (!Files.exists(reportPath) && System.nanoTime() < deadline) {
+            Thread.sleep(1);
+        }
+        sdk.zoom_sdk_stop_loop(handle);
+        loop.join();
+        sdk.zoom_meeting_destroy(meeting);
+        sdk.zoom_sdk_destroy(handle);
+        if (!Files.exists(reportPath)) {
+            System.err.println("no delivery report from the stand-in SDK");
+            System.exit(1);
+        }
+
+        // One line of key=value fields, written before the file appears
+        Map<String, Long> stats = new HashMap<>();
+        for (String field : new String(Files.readAllBytes(reportPath), StandardCharsets.UTF_8).trim().split("\\s+")) {
+            int eq = field.indexOf('=');
+            stats.put(field.substring(0, eq), Long.parseLong(field.substring(eq + 1)));
+        }
+        Files.delete(reportPath);
+        return stats;
+    }
+
+    private static void print(int fd, String line) {
+        byte[] bytes = line.getBytes(StandardCharsets.UTF_8);
+        CLibrary.INSTANCE.write(fd, bytes, bytes.length);
+    }
+
+    // Heap bytes allocated by all threads, including finished ones, or -1 before JDK 21
+    private static long allocatedBytes() {
+        ThreadMXBean threads = ManagementFactory.getThreadMXBean();
+        try {
+            Method total = Class.forName("com.sun.management.ThreadMXBean").getMethod("getTotalThreadAllocatedBytes");
+            return (long) total.invoke(threads);
+        } catch (ReflectiveOperationException | RuntimeException e) {
+            return -1;
+        }
+    }
+
+    private static long collections() {
+        long count = 0;
+        for (GarbageCollectorMXBean gc : ManagementFactory.getGarbageCollectorMXBeans()) {
+            count += Math.max(0, gc.getCollectionCount());
+        }
+        return count;
+    }
+}
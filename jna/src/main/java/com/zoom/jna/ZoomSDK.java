@@ -38,13 +38,15 @@ public interface ZoomSDK extends Library {
                                                String meeting_id,
                                                String password,
                                                String display_name,
-                                               int enable_audio);
+                                               String join_token,
+                                               int enable_audio,
+                                               int enable_video);
 
     void zoom_meeting_destroy(MeetingHandle meeting_handle);
 
     int zoom_meeting_set_audio_callback(MeetingHandle meeting_handle, OnAudioDataReceivedCallback callback);
 
-    void zoom_sdk_run_loop();
+    void zoom_sdk_run_loop(ZoomSDKHandle handle);
 
-    void zoom_sdk_stop_loop();
+    void zoom_sdk_stop_loop(ZoomSDKHandle handle);
 }
@@ -0,0 +1,155 @@
+package main
+
+import (
+	"flag"
+	"fmt"
+	"os"
+	"path/filepath"
+	"runtime"
+	"strconv"
+	"syscall"
+	"time"
+
+	"github.com/qieqieplus/headless-meeting-bot/server/pkg/log"
+	"github.com/qieqieplus/headless-meeting-bot/server/pkg/zoomsdk"
+)
+
+// Go version of the cross-binding audio callback benchmark (src/bench/ffi_bench.c).
+// The stand-in SDK's media thread delivers the frames, and they take the
+// production path: a cgo callback on a thread the Go runtime does not own,
+// C.GoBytes, an AudioFrame on the meeting's 1000-frame channel, and the
+// meeting's processing goroutine. No audio bus is attached, so the goroutine
+// only counts what it receives. Callback timings come from the stand-in SDK's
+// delivery report (ZOOM_FAKE_SDK_DELIVERY_REPORT).
+
+func runFFIBench(args []string) {
+	fs := flag.NewFlagSet("ffibench", flag.ExitOnError)
+	frames := fs.Int("frames", 200000, "frames to deliver per stream")
+	participants := fs.Int("participants", 0, "one-way streams besides the mixed one")
+	paced := fs.Bool("paced", false, "deliver every 10 ms as the SDK does, instead of back to back")
+	fs.Usage = func() {
+		fmt.Fprintf(os.Stderr, "Usage: %s ffibench [options]\n\nMeasures the cost of delivering audio frames from the C API\ninto Go through the stand-in SDK.\n\nOptions:\n", os.Args[0])
+		fs.PrintDefaults()
+	}
+
+	if err := fs.Parse(args); err != nil {
+		log.Fatalf("Failed to parse flags: %v", err)
+	}
+	if *frames <= 0 || *participants < 0 {
+		log.Fatal("frames must be positive, participants not negative")
+	}
+
+	// Fast joins and no share; the stand-in SDK delivers the audio and reports
+	// its timings. Drops are counted, not logged
+	reportPath := filepath.Join(os.TempDir(), fmt.Sprintf("ffibench.%d.report", os.Getpid()))
+	setenvDefault("ZOOM_FAKE_SDK_AUTH_MS", "0")
+	setenvDefault("ZOOM_FAKE_SDK_JOIN_MS", "0")
+	setenvDefault("ZOOM_FAKE_SDK_AUDIO_JOIN_MS", "0")
+	setenvDefault("ZOOM_FAKE_SDK_SHARE_FPS", "0")
+	os.Setenv("ZOOM_FAKE_SDK_PARTICIPANTS", strconv.Itoa(*participants))
+	os.Setenv("ZOOM_FAKE_SDK_AUDIO_FRAMES", strconv.Itoa(*frames))
+	unpaced := "1"
+	if *paced {
+		unpaced = "0"
+	}
+	os.Setenv("ZOOM_FAKE_SDK_UNPACED", unpaced)
+	os.Setenv("ZOOM_FAKE_SDK_DELIVERY_REPORT", reportPath)
+	setenvDefault("LOG_LEVEL", "error")
+	log.Init(os.Getenv("LOG_LEVEL"))
+	log.Logger.SetOutput(os.Stderr)
+
+	// The C API reports every state change on stdout; keep the row readable
+	report, err := redirectStdout()
+	if err != nil {
+		log.Fatalf("Failed to redirect stdout: %v", err)
+	}
+	defer report.Close()
+
+	var before, after runtime.MemStats
+	runtime.ReadMemStats(&before)
+
+	manager := zoomsdk.NewManager("bench", "bench", nil)
+	if err := manager.JoinMeeting("1000", "bench", "bench", "", true, false); err != nil {
+		log.Fatalf("Failed to join; build libzoomsdk_c with -DFAKE_MEETINGSDK=ON: %v", err)
+	}
+	defer manager.Shutdown()
+	instance, _ := manager.GetMeeting("1000")
+
+	perSecond := 1000
+	if *paced {
+		perSecond = 100
+	}
+	timeout := time.Minute + time.Duration(*frames*(*participants+1)/perSecond)*time.Second
+	stats, err := waitReport(reportPath, timeout)
+	if err != nil {
+		log.Fatalf("Benchmark failed: %v", err)
+	}
+	// Frames still in the channel are part of the cost
+	end := waitDelivered(instance, stats.frames)
+	runtime.ReadMemStats(&after)
+
+	elapsed := max(stats.elapsedNs, 1)
+	fmt.Fprintf(report, "%-8s %9s %9s %8s %8s %9s %10s %12s %11s %5s %8s %6s\n", "binding", "frames", "ns/frame",
+		"p50(ns)", "p99(ns)", "max(ns)", "frames/s", "allocs/frame", "bytes/frame", "gc", "dropped", "late")
+	fmt.Fprintf(report, "%-8s %9d %9.1f %8d %8d %9d %10.0f %12.2f %11.1f %5d %8d %6d\n", "go",
+		stats.frames, float64(elapsed)/float64(stats.frames), stats.p50Ns, stats.p99Ns, stats.maxNs,
+		float64(stats.frames)*1e9/float64(elapsed),
+		float64(after.Mallocs-before.Mallocs)/float64(stats.frames),
+		float64(after.TotalAlloc-before.TotalAlloc)/float64(stats.frames),
+		after.NumGC-before.NumGC, end.HandoffDropped, stats.late)
+}
+
+// deliveryReport is the stand-in SDK's timing of every audio callback it made
+type deliveryReport struct {
+	frames, elapsedNs, p50Ns, p99Ns, maxNs, late uint64
+}
+
+// waitReport waits for the stand-in SDK to write its delivery report, which it
+// does once the last frame is delivered
+func waitReport(path string, timeout time.Duration) (deliveryReport, error) {
+	var r deliveryReport
+	deadline := time.Now().Add(timeout)
+	for {
+		data, err := os.ReadFile(path)
+		if err == nil {
+			os.Remove(path)
+			_, err = fmt.Sscanf(string(data), "frames=%d elapsed_ns=%d p50_ns=%d p99_ns=%d max_ns=%d late=%d",
+				&r.frames, &r.elapsedNs, &r.p50Ns, &r.p99Ns, &r.maxNs, &r.late)
+			return r, err
+		}
+		if time.Now().After(deadline) {
+			return r, fmt.Errorf("no delivery report from the stand-in SDK in %v", timeout)
+		}
+		time.Sleep(time.Millisecond)
+	}
+}
+
+// redirectStdout points file descriptor 1 at /dev/null and returns the original stdout
+func redirectStdout() (*os.File, error) {
+	fd, err := syscall.Dup(syscall.Stdout)
+	if err != nil {
+		return nil, err
+	}
+	devnull, err := os.OpenFile(os.DevNull, os.O_WRONLY, 0)
+	if err != nil {
+		return nil, err
+	}
+	defer devnull.Close()
+	if err := syscall.Dup3(int(devnull.Fd()), syscall.Stdout, 0); err != nil {
+		return nil, err
+	}
+	return os.NewFile(uintptr(fd), "stdout"), nil
+}
+
+// waitDelivered waits until the processing goroutine has taken or the callback
+// has dropped total frames, for at most a second
+func waitDelivered(instance *zoomsdk.MeetingInstance, total uint64) zoomsdk.MeetingStats {
+	deadline := time.Now().Add(time.Second)
+	for {
+		stats := instance.GetStats()
+		if stats.FramesReceived+stats.HandoffDropped >= total || time.Now().After(deadline) {
+			return stats
+		}
+		time.Sleep(time.Millisecond)
+	}
+}
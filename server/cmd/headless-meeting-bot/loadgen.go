@@ -0,0 +1,509 @@
+package main
+
+import (
+	"bytes"
+	"encoding/json"
+	"flag"
+	"fmt"
+	"net"
+	"net/http"
+	"os"
+	"runtime"
+	"strconv"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"time"
+
+	"github.com/gorilla/websocket"
+	"github.com/qieqieplus/headless-meeting-bot/server/pkg/audio"
+	"github.com/qieqieplus/headless-meeting-bot/server/pkg/config"
+	"github.com/qieqieplus/headless-meeting-bot/server/pkg/log"
+	"github.com/qieqieplus/headless-meeting-bot/server/pkg/server"
+	"github.com/qieqieplus/headless-meeting-bot/server/pkg/zoomsdk"
+)
+
+// loadReportVersion changes whenever a field of LoadReport changes meaning
+const loadReportVersion = 1
+
+// Linux reports process CPU time in clock ticks of USER_HZ, 100 on every
+// architecture the SDK ships for
+const clockTicksPerSecond = 100
+
+// LoadOptions describes one load generation run
+type LoadOptions struct {
+	Label             string  `json:"label,omitempty"`
+	Meetings          int     `json:"meetings"`
+	Speakers          int     `json:"speakers"`
+	ClientsPerMeeting int     `json:"clients_per_meeting"`
+	WarmupSeconds     float64 `json:"warmup_seconds"`
+	DurationSeconds   float64 `json:"duration_seconds"`
+}
+
+// LoadReport is the machine-readable result of a load generation run. Counters
+// cover the measurement window only, latency histograms the whole run.
+type LoadReport struct {
+	Version   int               `json:"version"`
+	StartedAt time.Time         `json:"started_at"`
+	GoVersion string            `json:"go_version"`
+	NumCPU    int               `json:"num_cpu"`
+	Options   LoadOptions       `json:"options"`
+	Manager   ProcessUsage      `json:"manager"`
+	Meetings  []MeetingLoad     `json:"meetings"`
+	Totals    LoadTotals        `json:"totals"`
+	Errors    []string          `json:"errors,omitempty"`
+	FakeSDK   map[string]string `json:"fake_sdk"`
+}
+
+// ProcessUsage is the CPU and memory one process used during the window
+type ProcessUsage struct {
+	PID          int     `json:"pid"`
+	CPUPercent   float64 `json:"cpu_percent"`
+	RSSBytes     int64   `json:"rss_bytes"`
+	PeakRSSBytes int64   `json:"peak_rss_bytes"`
+}
+
+// MeetingLoad is one simulated meeting: its worker process and every layer a frame crosses
+type MeetingLoad struct {
+	MeetingID string                        `json:"meeting_id"`
+	Worker    ProcessUsage                  `json:"worker"`
+	Frames    FrameLayers                   `json:"frames"`
+	Latency   map[string]audio.StageLatency `json:"latency"`
+}
+
+// FrameLayers counts frames at each hop from the SDK callback to the WebSocket client
+type FrameLayers struct {
+	NativeIn         uint64            `json:"native_in"`
+	NativeOut        uint64            `json:"native_out"`
+	NativeDropped    map[string]uint64 `json:"native_dropped"`
+	SlowConsumerShed uint64            `json:"slow_consumer_shed"`
+	HandoffDropped   uint64            `json:"handoff_dropped"`
+	WorkerReceived   uint64            `json:"worker_received"`
+	WorkerDropped    uint64            `json:"worker_dropped"`
+	RelayReceived    uint64            `json:"relay_received"`
+	RelayDropped     uint64            `json:"relay_dropped"`
+	WebSocketDropped uint64            `json:"websocket_dropped"`
+	ClientMessages   uint64            `json:"client_messages"`
+	ClientBytes      uint64            `json:"client_bytes"`
+}
+
+// LoadTotals sums the meetings; latency is the worst meeting's, since
+// percentiles of different meetings cannot be merged
+type LoadTotals struct {
+	WorkerCPUPercent     float64                       `json:"worker_cpu_percent"`
+	CPUPercentPerMeeting float64                       `json:"cpu_percent_per_meeting"`
+	WorkerRSSBytes       int64                         `json:"worker_rss_bytes"`
+	WorkerPeakRSSBytes   int64                         `json:"worker_peak_rss_bytes"`
+	Frames               FrameLayers                   `json:"frames"`
+	BusDropped           uint64                        `json:"bus_dropped"`
+	WorstLatency         map[string]audio.StageLatency `json:"worst_latency"`
+}
+
+func runLoadgen(args []string) {
+	var opts LoadOptions
+	var warmup, duration time.Duration
+	fs := flag.NewFlagSet("loadgen", flag.ExitOnError)
+	fs.IntVar(&opts.Meetings, "meetings", 4, "number of meetings, one worker process each")
+	fs.IntVar(&opts.Speakers, "speakers", 3, "simulated participants per meeting")
+	fs.IntVar(&opts.ClientsPerMeeting, "clients", 1, "WebSocket clients per meeting")
+	fs.DurationVar(&warmup, "warmup", 5*time.Second, "time after joining before measuring")
+	fs.DurationVar(&duration, "duration", 30*time.Second, "measurement window")
+	fs.StringVar(&opts.Label, "label", "", "free-form label stored in the report, e.g. a release")
+	addr := fs.String("addr", "127.0.0.1:0", "listen address of the manager")
+	out := fs.String("out", "loadgen.json", "report file")
+	fs.Usage = func() {
+		fmt.Fprintf(os.Stderr, "Usage: %s loadgen [options]\n\nJoins simulated meetings through the stand-in SDK and\nreports CPU, memory, frame drops and latency per meeting as JSON.\n\nOptions:\n", os.Args[0])
+		fs.PrintDefaults()
+	}
+
+	if err := fs.Parse(args); err != nil {
+		log.Fatalf("Failed to parse flags: %v", err)
+	}
+	if opts.Meetings < 1 || opts.Speakers < 0 || opts.ClientsPerMeeting < 0 {
+		log.Fatal("meetings must be positive, speakers and clients not negative")
+	}
+	opts.WarmupSeconds = warmup.Seconds()
+	opts.DurationSeconds = duration.Seconds()
+
+	report, err := generateLoad(opts, *addr, warmup, duration)
+	if err != nil {
+		log.Fatalf("Load generation failed: %v", err)
+	}
+
+	// Workers share stdout for their logs, so the report always goes to a file
+	data, _ := json.MarshalIndent(report, "", "  ")
+	data = append(data, '\n')
+	if err := os.WriteFile(*out, data, 0644); err != nil {
+		log.Fatalf("Failed to write report: %v", err)
+	}
+}
+
+// setenvDefault sets an environment variable unless the caller already has;
+// worker processes inherit it
+func setenvDefault(key, value string) {
+	if _, ok := os.LookupEnv(key); !ok {
+		os.Setenv(key, value)
+	}
+}
+
+func generateLoad(opts LoadOptions, addr string, warmup, duration time.Duration) (*LoadReport, error) {
+	// The stand-in SDK accepts any credentials; share video is not part of this path
+	setenvDefault("ZOOM_SDK_KEY", "loadgen")
+	setenvDefault("ZOOM_SDK_SECRET", "loadgen")
+	setenvDefault("LOG_LEVEL", "warn")
+	setenvDefault("ZOOM_FAKE_SDK_PARTICIPANTS", strconv.Itoa(opts.Speakers))
+	setenvDefault("ZOOM_FAKE_SDK_SHARE_FPS", "0")
+
+	cfg := config.Load()
+	log.Init(cfg.LogLevel)
+
+	audioBus := audio.NewBus()
+	processManager, err := NewProcessManager(cfg.ZoomSDKKey, cfg.ZoomSDKSecret, audioBus)
+	if err != nil {
+		return nil, err
+	}
+	wsServer := server.NewWebSocketServer(audioBus, processManager, cfg)
+
+	listener, err := net.Listen("tcp", addr)
+	if err != nil {
+		return nil, err
+	}
+	srv := &http.Server{Handler: server.NewHTTPServer(processManager, wsServer)}
+	go srv.Serve(listener)
+	defer srv.Close()
+	defer processManager.Shutdown()
+	base := listener.Addr().String()
+
+	report := &LoadReport{
+		Version:   loadReportVersion,
+		StartedAt: time.Now().UTC(),
+		GoVersion: runtime.Version(),
+		NumCPU:    runtime.NumCPU(),
+		Options:   opts,
+		FakeSDK:   fakeSDKEnv(),
+	}
+
+	ids := make([]string, opts.Meetings)
+	for i := range ids {
+		ids[i] = strconv.Itoa(8000000000 + i)
+		if err := postJoin(base, ids[i]); err != nil {
+			return nil, fmt.Errorf("join %s: %w", ids[i], err)
+		}
+	}
+	log.Infof("Joined %d meetings", len(ids))
+
+	clients := make([]*loadClient, 0, len(ids)*opts.ClientsPerMeeting)
+	for _, id := range ids {
+		for c := 0; c < opts.ClientsPerMeeting; c++ {
+			client, err := dialLoadClient(base, id)
+			if err != nil {
+				return nil, fmt.Errorf("connect client to %s: %w", id, err)
+			}
+			clients = append(clients, client)
+		}
+	}
+	defer func() {
+		for _, client := range clients {
+			client.close()
+		}
+	}()
+
+	time.Sleep(warmup)
+	before := takeSnapshot(processManager, wsServer, audioBus, clients, ids)
+	time.Sleep(duration)
+	after := takeSnapshot(processManager, wsServer, audioBus, clients, ids)
+
+	window := after.taken.Sub(before.taken).Seconds()
+	latency := processManager.LatencyReport()
+	report.Manager = after.manager.usage(before.manager, window)
+	report.Totals.WorstLatency = make(map[string]audio.StageLatency)
+	report.Totals.Frames.NativeDropped = make(map[string]uint64)
+
+	for _, id := range ids {
+		start, end := before.meetings[id], after.meetings[id]
+		if end.err != "" {
+			report.Errors = append(report.Errors, fmt.Sprintf("%s: %s", id, end.err))
+		}
+		meeting := MeetingLoad{
+			MeetingID: id,
+			Worker:    end.process.usage(start.process, window),
+			Frames:    end.frames.sub(start.frames),
+			Latency:   latency[id],
+		}
+		report.Meetings = append(report.Meetings, meeting)
+
+		report.Totals.WorkerCPUPercent += meeting.Worker.CPUPercent
+		report.Totals.WorkerRSSBytes += meeting.Worker.RSSBytes
+		report.Totals.WorkerPeakRSSBytes += meeting.Worker.PeakRSSBytes
+		report.Totals.Frames.add(meeting.Frames)
+		for stage, l := range meeting.Latency {
+			worst := report.Totals.WorstLatency[stage]
+			if l.P99Us > worst.P99Us {
+				report.Totals.WorstLatency[stage] = l
+			}
+		}
+	}
+	report.Totals.CPUPercentPerMeeting = report.Totals.WorkerCPUPercent / float64(len(ids))
+	report.Totals.BusDropped = after.busDropped - before.busDropped
+	return report, nil
+}
+
+func fakeSDKEnv() map[string]string {
+	env := make(map[string]string)
+	for _, kv := range os.Environ() {
+		if key, value, ok := strings.Cut(kv, "="); ok && strings.HasPrefix(key, "ZOOM_FAKE_SDK_") {
+			env[key] = value
+		}
+	}
+	return env
+}
+
+func postJoin(base, meetingID string) error {
+	body, _ := json.Marshal(server.JoinMeetingRequest{MeetingID: meetingID, Password: "loadgen", DisplayName: "loadgen"})
+	resp, err := http.Post("http://"+base+"/api/meetings", "application/json", bytes.NewReader(body))
+	if err != nil {
+		return err
+	}
+	defer resp.Body.Close()
+	if resp.StatusCode != http.StatusAccepted {
+		return fmt.Errorf("status %d", resp.StatusCode)
+	}
+	return nil
+}
+
+// loadClient is one WebSocket subscriber counting what reaches it
+type loadClient struct {
+	meetingID string
+	conn      *websocket.Conn
+	messages  uint64
+	bytes     uint64
+	done      chan struct{}
+}
+
+func dialLoadClient(base, meetingID string) (*loadClient, error) {
+	conn, _, err := websocket.DefaultDialer.Dial("ws://"+base+"/ws/audio/"+meetingID, nil)
+	if err != nil {
+		return nil, err
+	}
+	c := &loadClient{meetingID: meetingID, conn: conn, done: make(chan struct{})}
+	go func() {
+		defer close(c.done)
+		for {
+			messageType, data, err := conn.ReadMessage()
+			if err != nil {
+				return
+			}
+			if messageType == websocket.BinaryMessage && len(data) >= audio.BinaryFrameHeaderSize {
+				atomic.AddUint64(&c.messages, 1)
+				atomic.AddUint64(&c.bytes, uint64(len(data)-audio.BinaryFrameHeaderSize))
+			}
+		}
+	}()
+	return c, nil
+}
+
+func (c *loadClient) close() {
+	c.conn.Close()
+	<-c.done
+}
+
+// procSample is a process's cumulative CPU time and memory at one instant
+type procSample struct {
+	pid      int
+	cpuTicks uint64
+	rss      int64
+	peakRSS  int64
+}
+
+func sampleProc(pid int) procSample {
+	s := procSample{pid: pid}
+	if stat, err := os.ReadFile(fmt.Sprintf("/proc/%d/stat", pid)); err == nil {
+		s.cpuTicks = parseProcStatCPU(string(stat))
+	}
+	if status, err := os.ReadFile(fmt.Sprintf("/proc/%d/status", pid)); err == nil {
+		s.rss, s.peakRSS = parseProcStatusRSS(string(status))
+	}
+	return s
+}
+
+// parseProcStatCPU returns utime+stime from /proc/<pid>/stat; the command
+// name may contain spaces, so fields are counted after its closing paren
+func parseProcStatCPU(stat string) uint64 {
+	i := strings.LastIndexByte(stat, ')')
+	if i < 0 {
+		return 0
+	}
+	fields := strings.Fields(stat[i+1:])
+	if len(fields) < 13 {
+		return 0
+	}
+	utime, _ := strconv.ParseUint(fields[11], 10, 64)
+	stime, _ := strconv.ParseUint(fields[12], 10, 64)
+	return utime + stime
+}
+
+// parseProcStatusRSS returns VmRSS and VmHWM from /proc/<pid>/status in bytes
+func parseProcStatusRSS(status string) (rss, peak int64) {
+	for _, line := range strings.Split(status, "\n") {
+		key, value, ok := strings.Cut(line, ":")
+		if !ok || (key != "VmRSS" && key != "VmHWM") {
+			continue
+		}
+		kb, _ := strconv.ParseInt(strings.TrimSuffix(strings.TrimSpace(value), " kB"), 10, 64)
+		if key == "VmRSS" {
+			rss = kb * 1024
+		} else {
+			peak = kb * 1024
+		}
+	}
+	return rss, peak
+}
+
+func (s procSample) usage(start procSample, seconds float64) ProcessUsage {
+	u := ProcessUsage{PID: s.pid, RSSBytes: s.rss, PeakRSSBytes: s.peakRSS}
+	if seconds > 0 && s.cpuTicks >= start.cpuTicks {
+		u.CPUPercent = float64(s.cpuTicks-start.cpuTicks) / clockTicksPerSecond / seconds * 100
+	}
+	return u
+}
+
+type meetingSample struct {
+	process procSample
+	frames  FrameLayers
+	err     string
+}
+
+type loadSnapshot struct {
+	taken      time.Time
+	manager    procSample
+	busDropped uint64
+	meetings   map[string]meetingSample
+}
+
+// workerStats is the part of a worker's /stats the report uses
+type workerStats struct {
+	FramesReceived uint64
+	FramesDropped  uint64
+	HandoffDropped uint64
+	SlowConsumer   *zoomsdk.SlowConsumerStats `json:"slow_consumer"`
+	Native         []zoomsdk.NativeMetric     `json:"native"`
+}
+
+func takeSnapshot(pm *ProcessManager, ws *server.WebSocketServer, bus *audio.Bus, clients []*loadClient,
+	ids []string) *loadSnapshot {
+	snap := &loadSnapshot{
+		taken:      time.Now(),
+		manager:    sampleProc(os.Getpid()),
+		busDropped: bus.GetStats().DroppedFrames,
+		meetings:   make(map[string]meetingSample, len(ids)),
+	}
+	wsDropped := ws.DroppedFrames()
+
+	var mu sync.Mutex
+	var wg sync.WaitGroup
+	for _, id := range ids {
+		wg.Add(1)
+		go func(id string) {
+			defer wg.Done()
+			sample := sampleMeeting(pm, id)
+			sample.frames.WebSocketDropped = wsDropped[id]
+			mu.Lock()
+			snap.meetings[id] = sample
+			mu.Unlock()
+		}(id)
+	}
+	wg.Wait()
+
+	for _, c := range clients {
+		sample := snap.meetings[c.meetingID]
+		sample.frames.ClientMessages += atomic.LoadUint64(&c.messages)
+		sample.frames.ClientBytes += atomic.LoadUint64(&c.bytes)
+		snap.meetings[c.meetingID] = sample
+	}
+	return snap
+}
+
+func sampleMeeting(pm *ProcessManager, id string) meetingSample {
+	var sample meetingSample
+	worker, ok := pm.GetMeeting(id)
+	if !ok {
+		sample.err = "worker not running"
+		return sample
+	}
+	sample.process = sampleProc(worker.PID)
+	if relay, err := pm.GetMeetingStats(id); err == nil {
+		sample.frames.RelayReceived = relay.FramesReceived
+		sample.frames.RelayDropped = relay.FramesDropped
+	}
+
+	client := &http.Client{Timeout: 2 * time.Second}
+	resp, err := client.Get(fmt.Sprintf("http://localhost:%d/stats", worker.Port))
+	if err != nil {
+		sample.err = err.Error()
+		return sample
+	}
+	defer resp.Body.Close()
+
+	var stats workerStats
+	if err := json.NewDecoder(resp.Body).Decode(&stats); err != nil {
+		sample.err = err.Error()
+		return sample
+	}
+	sample.frames.WorkerReceived = stats.FramesReceived
+	sample.frames.WorkerDropped = stats.FramesDropped
+	sample.frames.HandoffDropped = stats.HandoffDropped
+	if stats.SlowConsumer != nil {
+		sample.frames.SlowConsumerShed = stats.SlowConsumer.ShedFrames
+	}
+	sample.frames.NativeDropped = make(map[string]uint64)
+	for _, m := range stats.Native {
+		switch m.Name {
+		case "zoom_frames_in_total":
+			sample.frames.NativeIn += uint64(m.Value)
+		case "zoom_frames_out_total":
+			sample.frames.NativeOut += uint64(m.Value)
+		case "zoom_frames_dropped_total":
+			reason := strings.TrimSuffix(strings.TrimPrefix(m.Labels, `reason="`), `"`)
+			sample.frames.NativeDropped[reason] += uint64(m.Value)
+		}
+	}
+	return sample
+}
+
+func (f FrameLayers) sub(start FrameLayers) FrameLayers {
+	d := FrameLayers{
+		NativeIn:         f.NativeIn - start.NativeIn,
+		NativeOut:        f.NativeOut - start.NativeOut,
+		NativeDropped:    make(map[string]uint64),
+		SlowConsumerShed: f.SlowConsumerShed - start.SlowConsumerShed,
+		HandoffDropped:   f.HandoffDropped - start.HandoffDropped,
+		WorkerReceived:   f.WorkerReceived - start.WorkerReceived,
+		WorkerDropped:    f.WorkerDropped - start.WorkerDropped,
+		RelayReceived:    f.RelayReceived - start.RelayReceived,
+		RelayDropped:     f.RelayDropped - start.RelayDropped,
+		WebSocketDropped: f.WebSocketDropped - start.WebSocketDropped,
+		ClientMessages:   f.ClientMessages - start.ClientMessages,
+		ClientBytes:      f.ClientBytes - start.ClientBytes,
+	}
+	for reason, n := range f.NativeDropped {
+		d.NativeDropped[reason] = n - start.NativeDropped[reason]
+	}
+	return d
+}
+
+func (f *FrameLayers) add(o FrameLayers) {
+	f.NativeIn += o.NativeIn
+	f.NativeOut += o.NativeOut
+	for reason, n := range o.NativeDropped {
+		f.NativeDropped[reason] += n
+	}
+	f.SlowConsumerShed += o.SlowConsumerShed
+	f.HandoffDropped += o.HandoffDropped
+	f.WorkerReceived += o.WorkerReceived
+	f.WorkerDropped += o.WorkerDropped
+	f.RelayReceived += o.RelayReceived
+	f.RelayDropped += o.RelayDropped
+	f.WebSocketDropped += o.WebSocketDropped
+	f.ClientMessages += o.ClientMessages
+	f.ClientBytes += o.ClientBytes
+}
@@ -21,6 +21,10 @@ func main() {
 		runServer(os.Args[2:])
 	case "worker":
 		runWorker(os.Args[2:])
+	case "loadgen":
+		runLoadgen(os.Args[2:])
+	case "ffibench":
+		runFFIBench(os.Args[2:])
 	default:
 		fmt.Fprintf(os.Stderr, "Unknown command: %s\n", command)
 		printUsage()
@@ -34,6 +38,8 @@ func printUsage() {
 Commands:
   server    Start the main HTTP/WebSocket server
   worker    Start a meeting worker process
+  loadgen   Run simulated meetings against the stand-in SDK and report resource use
+  ffibench  Measure the cost of delivering audio callbacks into Go
 
 Run '%s <command> -h' for more information on a command.
 `, os.Args[0], os.Args[0])
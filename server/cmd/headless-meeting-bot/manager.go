@@ -283,6 +283,7 @@ func (pm *ProcessManager) streamAudioFromWorker(worker *WorkerProcess) {
 		}
 
 		// Publish to audio bus
+		frame.Hop(worker.MeetingID, audio.StageRelay)
 		published := true
 		if pm.audioBus != nil {
 			published = pm.audioBus.Publish(worker.MeetingID, &frame)
@@ -315,6 +316,7 @@ func (pm *ProcessManager) LeaveMeeting(meetingID string) error {
 
 	worker := value.(*WorkerProcess)
 	pm.usedPorts.Delete(worker.Port)
+	audio.Latency.Remove(meetingID)
 
 	if err := worker.Stop(); err != nil {
 		log.Errorf("Error stopping worker %s: %v", meetingID, err)
@@ -369,6 +371,40 @@ func (pm *ProcessManager) GetAllStats() map[string]MeetingStats {
 	return result
 }
 
+// LatencyReport merges the frame latency stages measured in this process
+// (relay, WebSocket write) with those each worker measured (dispatch, cgo, publish)
+func (pm *ProcessManager) LatencyReport() map[string]map[string]audio.StageLatency {
+	report := audio.Latency.Report()
+	client := &http.Client{Timeout: 2 * time.Second}
+
+	pm.workers.Range(func(key, value interface{}) bool {
+		worker := value.(*WorkerProcess)
+		resp, err := client.Get(fmt.Sprintf("http://localhost:%d/debug/latency", worker.Port))
+		if err != nil {
+			log.Debugf("Failed to get latency from worker %s: %v", worker.MeetingID, err)
+			return true
+		}
+		defer resp.Body.Close()
+
+		var workerReport map[string]map[string]audio.StageLatency
+		if err := json.NewDecoder(resp.Body).Decode(&workerReport); err != nil {
+			log.Debugf("Failed to decode latency from worker %s: %v", worker.MeetingID, err)
+			return true
+		}
+		for id, stages := range workerReport {
+			if report[id] == nil {
+				report[id] = stages
+				continue
+			}
+			for stage, latency := range stages {
+				report[id][stage] = latency
+			}
+		}
+		return true
+	})
+	return report
+}
+
 // Shutdown gracefully shuts down all worker processes
 func (pm *ProcessManager) Shutdown() error {
 	log.Info("Shutting down process manager")
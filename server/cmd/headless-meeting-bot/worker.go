@@ -4,6 +4,7 @@ import (
 	"bytes"
 	"encoding/json"
 	"fmt"
+	"io"
 	"net/http"
 	"os"
 	"os/signal"
@@ -87,6 +88,8 @@ func (w *Worker) Start() error {
 	mux.HandleFunc("/health", w.handleHealth)
 	mux.HandleFunc("/status", w.handleStatus)
 	mux.HandleFunc("/stats", w.handleStats)
+	mux.HandleFunc("/metrics", w.handleMetrics)
+	mux.HandleFunc("/debug/latency", w.handleLatency)
 	mux.HandleFunc("/audio", w.handleAudioStream)
 
 	w.server = &http.Server{
@@ -136,13 +139,32 @@ func (w *Worker) handleStatus(rw http.ResponseWriter, r *http.Request) {
 	})
 }
 
-// handleStats returns meeting statistics
+// handleStats returns meeting statistics, including the native library counters
 func (w *Worker) handleStats(rw http.ResponseWriter, r *http.Request) {
-	stats := w.instance.GetStats()
+	stats := struct {
+		zoomsdk.MeetingStats
+		SlowConsumer *zoomsdk.SlowConsumerStats `json:"slow_consumer,omitempty"`
+		Timeline     *zoomsdk.Timeline          `json:"timeline,omitempty"`
+		Memory       []zoomsdk.MemoryStats      `json:"memory"`
+		Native       []zoomsdk.NativeMetric     `json:"native"`
+	}{w.instance.GetStats(), w.instance.GetSlowConsumerStats(), w.instance.GetTimeline(), zoomsdk.GetMemoryStats(),
+		zoomsdk.GetNativeMetrics()}
 	rw.Header().Set("Content-Type", "application/json")
 	json.NewEncoder(rw).Encode(stats)
 }
 
+// handleMetrics serves the native library metrics for Prometheus
+func (w *Worker) handleMetrics(rw http.ResponseWriter, r *http.Request) {
+	rw.Header().Set("Content-Type", "text/plain; version=0.0.4")
+	io.WriteString(rw, zoomsdk.GetNativeMetricsText())
+}
+
+// handleLatency reports per-stage frame latency measured in this worker
+func (w *Worker) handleLatency(rw http.ResponseWriter, r *http.Request) {
+	rw.Header().Set("Content-Type", "application/json")
+	json.NewEncoder(rw).Encode(audio.Latency.Report())
+}
+
 // handleAudioStream streams audio frames to the client
 func (w *Worker) handleAudioStream(rw http.ResponseWriter, r *http.Request) {
 	// Set headers for streaming
@@ -242,5 +264,8 @@ func (w *Worker) WaitForShutdown() {
 		}
 	}
 
+	// No-op unless ZOOM_SDK_TRACE is set
+	zoomsdk.WriteTrace()
+
 	log.Info("Worker shutdown complete")
 }
@@ -5,9 +5,7 @@ go 1.23
 require (
 	github.com/gorilla/websocket v1.5.1
 	github.com/sirupsen/logrus v1.9.3
+	golang.org/x/sys v0.15.0
 )
 
-require (
-	golang.org/x/net v0.17.0 // indirect
-	golang.org/x/sys v0.15.0 // indirect
-)
+require golang.org/x/net v0.17.0 // indirect
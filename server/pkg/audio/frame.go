@@ -31,6 +31,10 @@ type AudioFrame struct {
 	Type   AudioType // Audio type
 	UserID uint64    // Speaker/source identifier
 	Data   []byte    // PCM audio data (S16LE)
+
+	// Latency tracing, CLOCK_MONOTONIC nanoseconds (0 if unknown); not sent to WebSocket clients
+	IngressNs    int64 // When the native library received the frame from the SDK
+	CheckpointNs int64 // When the frame passed its last traced hop
 }
 
 var BinaryFrameHeaderSize = 2 * binary.Size(uint64(0)) // Type + UserID
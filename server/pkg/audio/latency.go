@@ -0,0 +1,218 @@
+package audio
+
+import (
+	"math"
+	"math/bits"
+	"sync"
+	"sync/atomic"
+	"time"
+
+	"golang.org/x/sys/unix"
+)
+
+// Stage identifies a hop an audio frame passes on its way from the SDK to a client
+type Stage int
+
+const (
+	StageDispatch Stage = iota // SDK ingress -> C consumer callback
+	StageCgo                   // C callback -> Go callback
+	StagePublish               // Go callback -> handed to the bus (the meeting channel wait)
+	StageRelay                 // Worker bus -> server bus (worker processes only)
+	StageWrite                 // Bus -> written to a WebSocket (includes the flush interval)
+	StageTotal                 // SDK ingress -> written to a WebSocket
+	stageCount
+)
+
+var stageNames = [stageCount]string{"dispatch", "cgo", "publish", "relay", "ws_write", "total"}
+
+func (s Stage) String() string {
+	if s < 0 || s >= stageCount {
+		return "unknown"
+	}
+	return stageNames[s]
+}
+
+// Frame timestamps are CLOCK_MONOTONIC nanoseconds, the clock the native library
+// stamps ingress with. Go's monotonic clock is the same clock with an unknown
+// origin, so one paired reading at startup converts between them.
+var (
+	monoOrigin int64
+	monoStart  time.Time
+)
+
+func init() {
+	var ts unix.Timespec
+	monoStart = time.Now()
+	if err := unix.ClockGettime(unix.CLOCK_MONOTONIC, &ts); err == nil {
+		monoOrigin = ts.Nano()
+	}
+}
+
+// MonotonicNs returns the current CLOCK_MONOTONIC time in nanoseconds
+func MonotonicNs() int64 {
+	return monoOrigin + int64(time.Since(monoStart))
+}
+
+// Log-linear buckets: each power of two is split into 4, so quantiles are
+// accurate to within 25% over the whole range (same layout as Util::Histogram)
+const (
+	histSubBits     = 2
+	histSubBuckets  = 1 << histSubBits
+	histBucketCount = histSubBuckets + (64-histSubBits)*histSubBuckets
+)
+
+func histBucketIndex(v uint64) int {
+	if v < histSubBuckets {
+		return int(v)
+	}
+	e := bits.Len64(v) - 1
+	sub := (v >> (e - histSubBits)) & (histSubBuckets - 1)
+	return histSubBuckets + (e-histSubBits)*histSubBuckets + int(sub)
+}
+
+func histBucketUpperBound(i int) uint64 {
+	if i < histSubBuckets {
+		return uint64(i)
+	}
+	shift := (i - histSubBuckets) / histSubBuckets
+	sub := uint64((i - histSubBuckets) % histSubBuckets)
+	lower := (histSubBuckets + sub) << shift
+	return lower + (uint64(1)<<shift - 1)
+}
+
+// Histogram is a lock-free histogram of nanosecond durations
+type Histogram struct {
+	count   atomic.Uint64
+	buckets [histBucketCount]atomic.Uint64
+}
+
+// Record adds one duration; negative values (clock skew) count as zero
+func (h *Histogram) Record(ns int64) {
+	if ns < 0 {
+		ns = 0
+	}
+	h.buckets[histBucketIndex(uint64(ns))].Add(1)
+	h.count.Add(1)
+}
+
+// Count returns the number of recorded samples
+func (h *Histogram) Count() uint64 {
+	return h.count.Load()
+}
+
+// Quantile returns the upper bound of the bucket holding the q-th sample, 0 if empty
+func (h *Histogram) Quantile(q float64) uint64 {
+	var counts [histBucketCount]uint64
+	var total uint64
+	for i := range h.buckets {
+		counts[i] = h.buckets[i].Load()
+		total += counts[i]
+	}
+	if total == 0 {
+		return 0
+	}
+
+	rank := uint64(math.Ceil(q * float64(total)))
+	if rank == 0 {
+		rank = 1
+	}
+	var seen uint64
+	for i, c := range counts {
+		seen += c
+		if seen >= rank {
+			return histBucketUpperBound(i)
+		}
+	}
+	return histBucketUpperBound(histBucketCount - 1)
+}
+
+// StageLatency summarizes one stage, in microseconds
+type StageLatency struct {
+	Count  uint64  `json:"count"`
+	P50Us  float64 `json:"p50_us"`
+	P99Us  float64 `json:"p99_us"`
+	P999Us float64 `json:"p999_us"`
+}
+
+// LatencyTracker keeps per-stage latency histograms for each meeting
+type LatencyTracker struct {
+	meetings map[string]*[stageCount]Histogram
+	mutex    sync.RWMutex
+}
+
+// NewLatencyTracker creates an empty tracker
+func NewLatencyTracker() *LatencyTracker {
+	return &LatencyTracker{meetings: make(map[string]*[stageCount]Histogram)}
+}
+
+func (t *LatencyTracker) histograms(meetingID string) *[stageCount]Histogram {
+	t.mutex.RLock()
+	h := t.meetings[meetingID]
+	t.mutex.RUnlock()
+	if h != nil {
+		return h
+	}
+
+	t.mutex.Lock()
+	defer t.mutex.Unlock()
+	if h = t.meetings[meetingID]; h == nil {
+		h = new([stageCount]Histogram)
+		t.meetings[meetingID] = h
+	}
+	return h
+}
+
+// Record adds a latency sample for a meeting and stage
+func (t *LatencyTracker) Record(meetingID string, stage Stage, ns int64) {
+	if stage < 0 || stage >= stageCount {
+		return
+	}
+	t.histograms(meetingID)[stage].Record(ns)
+}
+
+// Remove forgets a meeting
+func (t *LatencyTracker) Remove(meetingID string) {
+	t.mutex.Lock()
+	defer t.mutex.Unlock()
+	delete(t.meetings, meetingID)
+}
+
+// Report returns p50/p99/p999 per stage for every meeting; stages without samples are omitted
+func (t *LatencyTracker) Report() map[string]map[string]StageLatency {
+	t.mutex.RLock()
+	defer t.mutex.RUnlock()
+
+	report := make(map[string]map[string]StageLatency, len(t.meetings))
+	for id, hists := range t.meetings {
+		stages := make(map[string]StageLatency)
+		for s := range hists {
+			h := &hists[s]
+			if h.Count() == 0 {
+				continue
+			}
+			stages[Stage(s).String()] = StageLatency{
+				Count:  h.Count(),
+				P50Us:  float64(h.Quantile(0.50)) / 1e3,
+				P99Us:  float64(h.Quantile(0.99)) / 1e3,
+				P999Us: float64(h.Quantile(0.999)) / 1e3,
+			}
+		}
+		report[id] = stages
+	}
+	return report
+}
+
+// Latency is the process-wide tracker fed by the frame path
+var Latency = NewLatencyTracker()
+
+// Hop records the time since the frame's previous checkpoint under stage and
+// makes now the new checkpoint. Only the goroutine that owns the frame may call
+// it: once published, the frame is shared by all subscribers and read-only.
+func (f *AudioFrame) Hop(meetingID string, stage Stage) {
+	if f.IngressNs == 0 {
+		return
+	}
+	now := MonotonicNs()
+	Latency.Record(meetingID, stage, now-f.CheckpointNs)
+	f.CheckpointNs = now
+}
@@ -0,0 +1,104 @@
+package audio
+
+import (
+	"math"
+	"testing"
+)
+
+func TestHistBuckets(t *testing.T) {
+	values := []uint64{0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 1000, 123456789, math.MaxUint64}
+	for _, v := range values {
+		i := histBucketIndex(v)
+		var lower uint64
+		if i > 0 {
+			lower = histBucketUpperBound(i-1) + 1
+		}
+		if upper := histBucketUpperBound(i); v < lower || v > upper {
+			t.Errorf("value %d in bucket %d covering [%d, %d]", v, i, lower, upper)
+		}
+	}
+	if got := histBucketIndex(math.MaxUint64); got != histBucketCount-1 {
+		t.Errorf("histBucketIndex(max) = %d, want %d", got, histBucketCount-1)
+	}
+}
+
+func TestHistogram_Quantile(t *testing.T) {
+	var h Histogram
+	if got := h.Quantile(0.5); got != 0 {
+		t.Errorf("empty Quantile(0.5) = %d, want 0", got)
+	}
+
+	for i := int64(1); i <= 1000; i++ {
+		h.Record(i * 1000)
+	}
+	h.Record(-5)
+
+	if h.Count() != 1001 {
+		t.Errorf("Count() = %d, want 1001", h.Count())
+	}
+	tests := []struct {
+		q    float64
+		want uint64
+	}{
+		{0.5, 500000},
+		{0.99, 990000},
+		{1, 1000000},
+	}
+	for _, test := range tests {
+		got := h.Quantile(test.q)
+		// Bucket bounds are within 25% above the exact value
+		if got < test.want || float64(got) > float64(test.want)*1.25 {
+			t.Errorf("Quantile(%v) = %d, want within 25%% above %d", test.q, got, test.want)
+		}
+	}
+}
+
+func TestLatencyTracker_Report(t *testing.T) {
+	tracker := NewLatencyTracker()
+	tracker.Record("m1", StageDispatch, 2000)
+	tracker.Record("m1", StageTotal, 40000000)
+	tracker.Record("m2", StageCgo, 500)
+	tracker.Record("m2", Stage(99), 500)
+
+	report := tracker.Report()
+	if len(report) != 2 {
+		t.Fatalf("len(report) = %d, want 2", len(report))
+	}
+	if _, ok := report["m1"]["cgo"]; ok {
+		t.Errorf("stage without samples should be omitted")
+	}
+	if got := report["m1"]["dispatch"]; got.Count != 1 || got.P50Us < 2 || got.P50Us > 2.5 {
+		t.Errorf("m1 dispatch = %+v, want 1 sample near 2us", got)
+	}
+	if got := report["m1"]["total"]; got.P999Us < 40000 || got.P999Us > 50000 {
+		t.Errorf("m1 total p999 = %v us, want near 40000", got.P999Us)
+	}
+	if len(report["m2"]) != 1 {
+		t.Errorf("m2 stages = %v, want only cgo", report["m2"])
+	}
+
+	tracker.Remove("m1")
+	if _, ok := tracker.Report()["m1"]; ok {
+		t.Errorf("m1 still reported after Remove")
+	}
+}
+
+func TestAudioFrame_Hop(t *testing.T) {
+	defer Latency.Remove("hop-test")
+
+	untraced := &AudioFrame{}
+	untraced.Hop("hop-test", StagePublish)
+	if _, ok := Latency.Report()["hop-test"]; ok {
+		t.Errorf("frame without ingress time should not be recorded")
+	}
+
+	now := MonotonicNs()
+	frame := &AudioFrame{IngressNs: now - 3000, CheckpointNs: now - 1000}
+	frame.Hop("hop-test", StagePublish)
+	if frame.CheckpointNs < now {
+		t.Errorf("CheckpointNs = %d, want >= %d", frame.CheckpointNs, now)
+	}
+	if got := Latency.Report()["hop-test"]["publish"]; got.Count != 1 || got.P50Us < 1 {
+		t.Errorf("publish = %+v, want 1 sample of at least 1us", got)
+	}
+}
@@ -5,6 +5,7 @@ import (
 	"net/http"
 	"strings"
 
+	"github.com/qieqieplus/headless-meeting-bot/server/pkg/audio"
 	"github.com/qieqieplus/headless-meeting-bot/server/pkg/log"
 	"github.com/qieqieplus/headless-meeting-bot/server/pkg/zoomsdk"
 )
@@ -39,6 +40,7 @@ func (s *HTTPServer) registerRoutes() {
 	mux.HandleFunc("/health", s.handleHealth)
 	mux.HandleFunc("/api/meetings", s.handleMeetings)
 	mux.HandleFunc("/api/meetings/", s.handleMeetingByID)
+	mux.HandleFunc("/debug/latency", s.handleLatency)
 
 	// Param router for websocket path: /ws/audio/{meeting_id}
 	pr := NewParamRouter()
@@ -166,6 +168,23 @@ func (s *HTTPServer) handleGetMeetingStatus(w http.ResponseWriter, r *http.Reque
 	json.NewEncoder(w).Encode(response)
 }
 
+// LatencyReporter is implemented by meeting managers that measure part of the
+// frame path in other processes
+type LatencyReporter interface {
+	LatencyReport() map[string]map[string]audio.StageLatency
+}
+
+// handleLatency reports p50/p99/p999 frame latency per stage for each meeting
+func (s *HTTPServer) handleLatency(w http.ResponseWriter, r *http.Request) {
+	report := audio.Latency.Report()
+	if reporter, ok := s.meetingManager.(LatencyReporter); ok {
+		report = reporter.LatencyReport()
+	}
+
+	w.Header().Set("Content-Type", "application/json")
+	json.NewEncoder(w).Encode(report)
+}
+
 // handleHealth returns health status for the process manager
 func (s *HTTPServer) handleHealth(w http.ResponseWriter, r *http.Request) {
 	w.Header().Set("Content-Type", "application/json")
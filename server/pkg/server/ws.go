@@ -3,6 +3,7 @@ package server
 import (
 	"net/http"
 	"sync"
+	"sync/atomic"
 	"time"
 
 	"github.com/gorilla/websocket"
@@ -20,6 +21,7 @@ type WebSocketServer struct {
 	config         *config.Config
 	clients        map[string]*Client
 	clientsMutex   sync.RWMutex
+	dropped        sync.Map // map[string]*uint64, frames shed per meeting
 }
 
 // NewWebSocketServer creates a new WebSocket server
@@ -56,6 +58,7 @@ func (s *WebSocketServer) HandleConnection(w http.ResponseWriter, r *http.Reques
 	config.MeetingID = meetingID
 
 	client := NewClient(conn, s.audioBus, s.config)
+	client.dropped = s.dropCounter(meetingID)
 	s.addClient(client)
 
 	log.Infof("WebSocket client connected: %s for meeting: %s", client.ID, meetingID)
@@ -80,6 +83,23 @@ func (s *WebSocketServer) removeClient(clientID string) {
 	delete(s.clients, clientID)
 }
 
+// dropCounter returns the counter of frames shed for a meeting's clients
+func (s *WebSocketServer) dropCounter(meetingID string) *uint64 {
+	counter, _ := s.dropped.LoadOrStore(meetingID, new(uint64))
+	return counter.(*uint64)
+}
+
+// DroppedFrames returns the frames shed because a client's send channel was
+// full, per meeting, including clients that have since disconnected
+func (s *WebSocketServer) DroppedFrames() map[string]uint64 {
+	result := make(map[string]uint64)
+	s.dropped.Range(func(key, value interface{}) bool {
+		result[key.(string)] = atomic.LoadUint64(value.(*uint64))
+		return true
+	})
+	return result
+}
+
 // Client represents a single WebSocket client
 type Client struct {
 	ID         string
@@ -87,8 +107,10 @@ type Client struct {
 	audioBus   *audio.Bus
 	config     *config.Config
 	subscriber *audio.Subscriber
+	meetingID  string
 	sendChan   chan interface{} // Can be []byte (JSON) or *audio.AudioFrame
 	stopChan   chan struct{}
+	dropped    *uint64
 }
 
 // NewClient creates a new client
@@ -105,6 +127,7 @@ func NewClient(conn *websocket.Conn, audioBus *audio.Bus, cfg *config.Config) *C
 
 // Process starts processing messages for the client
 func (c *Client) Process(config *ConnectionConfig) {
+	c.meetingID = config.MeetingID
 	c.subscriber = audio.NewSubscriber(c.ID, config.QueueSize)
 	c.subscriber.SetMeetingFilter(config.MeetingID)
 	c.subscriber.SetAudioTypeFilter(config.AudioTypes)
@@ -127,6 +150,9 @@ func (c *Client) Process(config *ConnectionConfig) {
 		select {
 		case c.sendChan <- frame:
 		default:
+			if c.dropped != nil {
+				atomic.AddUint64(c.dropped, 1)
+			}
 			log.Warnf("Dropping frame for client %s (send channel full)", c.ID)
 		}
 	}
@@ -142,6 +168,13 @@ func (c *Client) writePump() {
 	// Aggregate PCM per user and type, send every flush interval
 	userBuffers := make(map[uint64]map[audio.AudioType][]byte)
 
+	// Oldest traced frame in each buffer: the one that waited longest for the flush
+	type bufferKey struct {
+		userID    uint64
+		audioType audio.AudioType
+	}
+	oldest := make(map[bufferKey]*audio.AudioFrame)
+
 	ticker := time.NewTicker(c.config.WebSocket.AudioFlushInterval)
 	defer ticker.Stop()
 
@@ -172,6 +205,9 @@ func (c *Client) writePump() {
 					userBuffers[msg.UserID] = make(map[audio.AudioType][]byte)
 				}
 				userBuffers[msg.UserID][msg.Type] = append(userBuffers[msg.UserID][msg.Type], msg.Data...)
+				if key := (bufferKey{msg.UserID, msg.Type}); msg.IngressNs != 0 && oldest[key] == nil {
+					oldest[key] = msg
+				}
 			}
 
 		case <-ticker.C:
@@ -192,6 +228,12 @@ func (c *Client) writePump() {
 						log.Errorf("Error writing audio to WebSocket: %v", err)
 						return
 					}
+					if key := (bufferKey{userID, t}); oldest[key] != nil {
+						now := audio.MonotonicNs()
+						audio.Latency.Record(c.meetingID, audio.StageWrite, now-oldest[key].CheckpointNs)
+						audio.Latency.Record(c.meetingID, audio.StageTotal, now-oldest[key].IngressNs)
+						delete(oldest, key)
+					}
 					// Clear buffer for next tick
 					userBuffers[userID][t] = userBuffers[userID][t][:0]
 				}
@@ -5,11 +5,14 @@ package zoomsdk
 #include "zoom_sdk_c.h"
 
 // Forward declaration for Go callback
-extern void goOnAudioDataReceived(MeetingHandle meeting_handle, void* data, int length, int type, unsigned int node_id);
+extern void goOnAudioDataReceived(MeetingHandle meeting_handle, void* data, int length, int type, unsigned int node_id,
+                                  unsigned long long ingress_ns, unsigned long long dispatch_ns);
 
 // C wrapper function that will be passed to zoom_meeting_set_audio_callback
+// Passes the frame's ingress time and the time the callback started, so Go can time the cgo hop
 static void cAudioCallback(MeetingHandle meeting_handle, const void* data, int length, int type, unsigned int node_id) {
-    goOnAudioDataReceived(meeting_handle, (void*)data, length, type, node_id);
+    goOnAudioDataReceived(meeting_handle, (void*)data, length, type, node_id,
+                          zoom_frame_ingress_ns(), zoom_sdk_monotonic_ns());
 }
 
 // Helper function to get the C callback function pointer
@@ -22,6 +25,7 @@ import (
 	"fmt"
 	"runtime"
 	"sync"
+	"sync/atomic"
 	"unsafe"
 
 	"github.com/qieqieplus/headless-meeting-bot/server/pkg/audio"
@@ -181,6 +185,65 @@ func (m *MeetingHandle) SetAudioCallback() error {
 	return nil
 }
 
+// SlowConsumerStats are the slow consumer watchdog counters of a meeting
+type SlowConsumerStats struct {
+	Callbacks    uint64 `json:"callbacks"`
+	Overruns     uint64 `json:"overruns"`
+	MaxNs        uint64 `json:"max_ns"`
+	ShedFrames   uint64 `json:"shed_frames"`
+	DeliveryMode int    `json:"delivery_mode"`
+}
+
+// GetSlowConsumerStats returns how often the meeting's callbacks exceeded their budget
+func (m *MeetingHandle) GetSlowConsumerStats() (SlowConsumerStats, error) {
+	if m.handle == nil {
+		return SlowConsumerStats{}, fmt.Errorf("meeting handle is nil")
+	}
+
+	var s C.ZoomSlowConsumerStats
+	if result := C.zoom_meeting_get_slow_consumer_stats(m.handle, &s); result != C.ZOOM_SDK_SUCCESS {
+		return SlowConsumerStats{}, fmt.Errorf("failed to get slow consumer stats: %s", Result(result).Error())
+	}
+	return SlowConsumerStats{
+		Callbacks:    uint64(s.callbacks),
+		Overruns:     uint64(s.overruns),
+		MaxNs:        uint64(s.max_ns),
+		ShedFrames:   uint64(s.shed_frames),
+		DeliveryMode: int(s.mode),
+	}, nil
+}
+
+// Timeline holds the steps from the join request to the first frames, in nanoseconds
+// since the request; a step not reached yet is 0
+type Timeline struct {
+	InMeetingNs          uint64 `json:"in_meeting_ns"`
+	RecordingPrivilegeNs uint64 `json:"recording_privilege_ns"`
+	RecordingStartedNs   uint64 `json:"recording_started_ns"`
+	AudioSubscribedNs    uint64 `json:"audio_subscribed_ns"`
+	FirstAudioNs         uint64 `json:"first_audio_ns"`
+	FirstVideoNs         uint64 `json:"first_video_ns"`
+}
+
+// GetTimeline returns the join timeline, including time-to-first-audio and time-to-first-video
+func (m *MeetingHandle) GetTimeline() (Timeline, error) {
+	if m.handle == nil {
+		return Timeline{}, fmt.Errorf("meeting handle is nil")
+	}
+
+	var t C.ZoomMeetingTimeline
+	if result := C.zoom_meeting_get_timeline(m.handle, &t); result != C.ZOOM_SDK_SUCCESS {
+		return Timeline{}, fmt.Errorf("failed to get timeline: %s", Result(result).Error())
+	}
+	return Timeline{
+		InMeetingNs:          uint64(t.in_meeting_ns),
+		RecordingPrivilegeNs: uint64(t.recording_privilege_ns),
+		RecordingStartedNs:   uint64(t.recording_started_ns),
+		AudioSubscribedNs:    uint64(t.audio_subscribed_ns),
+		FirstAudioNs:         uint64(t.first_audio_ns),
+		FirstVideoNs:         uint64(t.first_video_ns),
+	}, nil
+}
+
 // GetStatus returns the current meeting status from Zoom SDK
 func (m *MeetingHandle) GetStatus() MeetingStatus {
 	if m.handle == nil {
@@ -191,21 +254,143 @@ func (m *MeetingHandle) GetStatus() MeetingStatus {
 	return MeetingStatus(status)
 }
 
-// RunLoop runs the main SDK event loop (blocking)
-func RunLoop() {
-	log.Debug("Starting SDK event loop")
-	C.zoom_sdk_run_loop()
+// RunLoop runs the event loop of this SDK instance (blocking)
+func (s *SDKHandle) RunLoop() {
+	if s.handle == nil {
+		return
+	}
+	log.Debugf("Starting SDK event loop for handle: %p", s.handle)
+	C.zoom_sdk_run_loop(s.handle)
 	log.Debug("SDK event loop stopped")
 }
 
-// StopLoop requests the SDK event loop to stop
-func StopLoop() {
-	log.Debug("Requesting SDK event loop to stop")
-	C.zoom_sdk_stop_loop()
+// StopLoop requests the event loop of this SDK instance to stop
+func (s *SDKHandle) StopLoop() {
+	if s.handle == nil {
+		return
+	}
+	log.Debugf("Requesting SDK event loop to stop for handle: %p", s.handle)
+	C.zoom_sdk_stop_loop(s.handle)
+}
+
+// NativeMetric is one metric series of the native library; durations are in seconds
+type NativeMetric struct {
+	Name   string  `json:"name"`
+	Labels string  `json:"labels,omitempty"`
+	Type   string  `json:"type"`
+	Value  float64 `json:"value"`
+	Count  uint64  `json:"count,omitempty"`
+	Sum    float64 `json:"sum,omitempty"`
+	P50    float64 `json:"p50,omitempty"`
+	P90    float64 `json:"p90,omitempty"`
+	P99    float64 `json:"p99,omitempty"`
+	Max    float64 `json:"max,omitempty"`
+}
+
+var nativeMetricTypes = [...]string{"counter", "gauge", "histogram"}
+
+// GetNativeMetricsText returns the native library metrics in Prometheus text format
+func GetNativeMetricsText() string {
+	buf := make([]byte, 16*1024)
+	for {
+		n := int(C.zoom_sdk_get_metrics_text((*C.char)(unsafe.Pointer(&buf[0])), C.int(len(buf))))
+		if n < len(buf) {
+			return string(buf[:n])
+		}
+		buf = make([]byte, n+1)
+	}
+}
+
+// GetNativeMetrics returns a snapshot of the native library metrics
+func GetNativeMetrics() []NativeMetric {
+	n := int(C.zoom_sdk_get_metrics(nil, 0))
+	if n == 0 {
+		return nil
+	}
+
+	// Metrics are only ever added, so a second call may report more than fit
+	samples := make([]C.ZoomMetricSample, n)
+	if got := int(C.zoom_sdk_get_metrics(&samples[0], C.int(n))); got < n {
+		n = got
+	}
+
+	metrics := make([]NativeMetric, n)
+	for i, s := range samples[:n] {
+		metrics[i] = NativeMetric{
+			Name:   C.GoString(s.name),
+			Labels: C.GoString(s.labels),
+			Type:   nativeMetricTypes[s._type],
+			Value:  float64(s.value),
+			Count:  uint64(s.count),
+			Sum:    float64(s.sum),
+			P50:    float64(s.p50),
+			P90:    float64(s.p90),
+			P99:    float64(s.p99),
+			Max:    float64(s.max),
+		}
+	}
+	return metrics
+}
+
+// MemoryStats is the memory one native subsystem holds, in total or for one meeting
+type MemoryStats struct {
+	Subsystem    string `json:"subsystem"`
+	PerMeeting   bool   `json:"per_meeting,omitempty"`
+	CurrentBytes int64  `json:"current_bytes"`
+	PeakBytes    int64  `json:"peak_bytes"`
+	Allocations  uint64 `json:"allocations"`
+	Frees        uint64 `json:"frees"`
+}
+
+// GetMemoryStats returns the memory held by the native library's own buffers, pools and queues
+func GetMemoryStats() []MemoryStats {
+	n := int(C.zoom_sdk_get_memory_stats(nil, 0))
+	if n == 0 {
+		return nil
+	}
+
+	// Meetings may be added between the two calls
+	entries := make([]C.ZoomMemoryStats, n)
+	if got := int(C.zoom_sdk_get_memory_stats(&entries[0], C.int(n))); got < n {
+		n = got
+	}
+
+	stats := make([]MemoryStats, n)
+	for i, e := range entries[:n] {
+		stats[i] = MemoryStats{
+			Subsystem:    C.GoString(e.subsystem),
+			PerMeeting:   e.meeting != nil,
+			CurrentBytes: int64(e.current_bytes),
+			PeakBytes:    int64(e.peak_bytes),
+			Allocations:  uint64(e.allocations),
+			Frees:        uint64(e.frees),
+		}
+	}
+	return stats
+}
+
+// EnableTracing starts recording a Chrome trace of the SDK lifecycle to path;
+// "%p" in the path is replaced by the process id
+func EnableTracing(path string) error {
+	cPath := C.CString(path)
+	defer C.free(unsafe.Pointer(cPath))
+
+	if result := C.zoom_sdk_enable_tracing(cPath); result != C.ZOOM_SDK_SUCCESS {
+		return fmt.Errorf("failed to enable tracing: %s", Result(result).Error())
+	}
+	return nil
+}
+
+// WriteTrace writes the trace recorded so far, if tracing is enabled.
+// Go exits without running C++ static destructors, so call it before exiting.
+func WriteTrace() {
+	C.zoom_sdk_write_trace()
 }
 
 //export goOnAudioDataReceived
-func goOnAudioDataReceived(meetingHandle C.MeetingHandle, data unsafe.Pointer, length C.int, audioType C.int, nodeID C.uint) {
+func goOnAudioDataReceived(meetingHandle C.MeetingHandle, data unsafe.Pointer, length C.int, audioType C.int, nodeID C.uint,
+	ingressNs, dispatchNs C.ulonglong) {
+	entered := audio.MonotonicNs()
 	instance := getMeetingInstance(meetingHandle)
 	if instance == nil {
 		log.Warnf("Received audio data for unknown meeting handle: %p", meetingHandle)
@@ -215,14 +400,21 @@ func goOnAudioDataReceived(meetingHandle C.MeetingHandle, data unsafe.Pointer, l
 	audioData := C.GoBytes(data, length)
 
 	frame := &audio.AudioFrame{
-		Type:   audio.AudioType(audioType),
-		UserID: uint64(nodeID),
-		Data:   audioData,
+		Type:         audio.AudioType(audioType),
+		UserID:       uint64(nodeID),
+		Data:         audioData,
+		IngressNs:    int64(ingressNs),
+		CheckpointNs: entered,
+	}
+	if ingressNs != 0 {
+		audio.Latency.Record(instance.meetingID, audio.StageDispatch, int64(dispatchNs)-int64(ingressNs))
+		audio.Latency.Record(instance.meetingID, audio.StageCgo, entered-int64(dispatchNs))
 	}
 
 	select {
 	case instance.audioChannel <- frame:
 	default:
+		atomic.AddUint64(&instance.stats.HandoffDropped, 1)
 		log.Warnf("Dropping audio frame for meeting %s (channel full)", instance.meetingID)
 	}
 }
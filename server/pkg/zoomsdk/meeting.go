@@ -2,6 +2,7 @@ package zoomsdk
 
 import (
 	"fmt"
+	"sync/atomic"
 	"time"
 
 	"github.com/qieqieplus/headless-meeting-bot/server/pkg/audio"
@@ -89,6 +90,8 @@ type MeetingStats struct {
 	FramesDropped  uint64
 	BytesReceived  uint64
 	LastFrameTime  time.Time
+	// Frames the cgo callback shed because the processing channel was full
+	HandoffDropped uint64
 }
 
 // NewMeetingInstance creates a new meeting instance
@@ -120,7 +123,33 @@ func (m *MeetingInstance) GetError() error {
 
 // GetStats returns meeting statistics
 func (m *MeetingInstance) GetStats() MeetingStats {
-	return m.stats
+	stats := m.stats
+	stats.HandoffDropped = atomic.LoadUint64(&m.stats.HandoffDropped)
+	return stats
+}
+
+// GetSlowConsumerStats returns the native slow consumer watchdog counters, nil before joining
+func (m *MeetingInstance) GetSlowConsumerStats() *SlowConsumerStats {
+	if m.meetingHandle == nil {
+		return nil
+	}
+	stats, err := m.meetingHandle.GetSlowConsumerStats()
+	if err != nil {
+		return nil
+	}
+	return &stats
+}
+
+// GetTimeline returns the native join timeline, nil before joining
+func (m *MeetingInstance) GetTimeline() *Timeline {
+	if m.meetingHandle == nil {
+		return nil
+	}
+	timeline, err := m.meetingHandle.GetTimeline()
+	if err != nil {
+		return nil
+	}
+	return &timeline
 }
 
 // Start starts the meeting instance and joins the meeting
@@ -152,7 +181,7 @@ func (m *MeetingInstance) Start() error {
 	// Start SDK event loop on OS thread
 	go func() {
 		m.osThread.Execute(func() {
-			RunLoop()
+			m.sdkHandle.RunLoop()
 		})
 	}()
 
@@ -211,6 +240,8 @@ func (m *MeetingInstance) processAudioFrames() {
 			m.stats.LastFrameTime = time.Now()
 
 			if m.audioBus != nil {
+				// Checkpointed before publishing: subscribers may read the frame right away
+				frame.Hop(m.meetingID, audio.StagePublish)
 				if !m.audioBus.Publish(m.meetingID, frame) {
 					m.stats.FramesDropped++
 					log.Warnf("Dropped audio frame for meeting %s", m.meetingID)
@@ -235,9 +266,12 @@ func (m *MeetingInstance) Stop() error {
 	// Stop audio frame processor
 	close(m.stopChan)
 	m.stopped = true
+	audio.Latency.Remove(m.meetingID)
 
 	// Stop SDK event loop
-	StopLoop()
+	if m.sdkHandle != nil {
+		m.sdkHandle.StopLoop()
+	}
 
 	// Clean up SDK resources on OS thread
 	if m.osThread != nil {
@@ -1,11 +1,22 @@
 #include "Meeting.h"
+#include "util/FlightRecorder.h"
 #include "util/Logger.h"
-#include <sstream>
-#include <thread>
+#include "util/Metrics.h"
+#include "util/Probes.h"
+#include "util/Trace.h"
 #include <chrono>
 
 using namespace ZOOMSDK;
 
+// How long the join flow waits for the host to answer a recording privilege request;
+// a later grant still starts recording through the privilege callback
+static constexpr std::chrono::seconds kPrivilegeTimeout{60};
+
+// Raw audio can only be subscribed once VoIP is connected. Retry on every audio
+// status change, and at least every interval in case the event never arrives
+static constexpr int kAudioJoinAttempts = 10;
+static constexpr std::chrono::milliseconds kAudioJoinRetryInterval{500};
+
 Meeting::Meeting(const MeetingConfig& config, IMeetingService* meetingService, ISettingService* settingService)
     : m_config(config)
     , m_videoHelper(nullptr)
@@ -14,6 +25,8 @@ Meeting::Meeting(const MeetingConfig& config, IMeetingService* meetingService, I
     , m_audioSource(nullptr)
     , m_isJoined(false)
     , m_isRecording(false)
+    , m_audioSubscribed(false)
+    , m_context(g_main_context_ref_thread_default())
     , m_currentShareSourceId(0)
     , m_shareSubscribed(false)
     , m_meetingService(meetingService)
@@ -25,9 +38,13 @@ Meeting::Meeting(const MeetingConfig& config, IMeetingService* meetingService, I
     }
 
     setupMeetingEvents();
+    m_tasks.spawn(lifecycle());
 }
 
 Meeting::~Meeting() {
+    // Cancel pending waits before any SDK object they touch goes away
+    m_tasks.clear();
+
     if (m_audioHelper) {
         m_audioHelper->unSubscribe();
     }
@@ -58,92 +75,223 @@ Meeting::~Meeting() {
         shareCtrl->SetEvent(nullptr);
     }
 
+    auto* audioCtrl = m_meetingService ? m_meetingService->GetMeetingAudioController() : nullptr;
+    if (audioCtrl && m_audioEvent) {
+        audioCtrl->SetEvent(nullptr);
+    }
+
     if (m_isJoined) {
         leave();
     }
+
+    g_main_context_unref(m_context);
 }
 
 
 SDKError Meeting::setupMeetingEvents() {
     std::function<void()> onJoin = [this]() {
-        m_isJoined = true;
-        Util::Logger::getInstance().success("Joined meeting successfully");
-
-        // mute the bot video & audio by default
-        auto* participantsCtrl = m_meetingService->GetMeetingParticipantsController();
-        if (participantsCtrl) {
-            if (auto* botUser = participantsCtrl->GetMySelfUser()) {
-                
-                if (auto* audioCtrl = m_meetingService->GetMeetingAudioController()) {
-                    audioCtrl->MuteAudio(botUser->GetUserID());
-                    // a workaround to join audio
-                    // https://devforum.zoom.us/t/cant-record-audio-with-linux-meetingsdk-after-6-3-5-6495-error-code-32/130689/10
-                    audioCtrl->JoinVoip();
-                }
+        m_inMeeting.set();
+    };
+    
+    std::function<void()> onLeave = [this]() {
+        m_isJoined = false;
+        m_isRecording = false;
+        m_audioSubscribed = false;
+        m_audioJoined.reset();
+        ZPROBE(left, this);
+        Util::FlightRecorder::getInstance().record("left", this);
+        Util::Logger::getInstance().info("Left meeting");
+    };
+
+    m_meetingServiceEvent = std::make_unique<MeetingServiceEvent>(onJoin, onLeave);
+
+    return m_meetingService->SetEvent(m_meetingServiceEvent.get());
+}
+
+Util::Task<> Meeting::lifecycle() {
+    // Runs the join flow every time the meeting is (re)entered
+    for (;;) {
+        co_await m_inMeeting.wait(m_context);
+        m_inMeeting.reset();
+        co_await onJoined();
+    }
+}
+
+Util::Task<> Meeting::onJoined() {
+    ZPROBE(joined, this);
+    Util::FlightRecorder::getInstance().record("joined", this);
+    m_isJoined = true;
+    m_audioJoined.reset();
+    Util::Logger::getInstance().success("Joined meeting successfully");
+
+    if (m_timeline.mark(MeetingTimeline::IN_MEETING)) {
+        static auto& joinLatency = Util::MetricsRegistry::getInstance().histogram(
+            "zoom_join_duration_seconds", "Time from the join request to being in the meeting", "", 1e-9);
+        joinLatency.record(m_timeline.elapsed(MeetingTimeline::IN_MEETING));
+    }
+
+    // Send the requests that need a round trip first, then do local setup while they are in flight
+    IMeetingRecordingController* recordingCtrl = nullptr;
+    bool needPrivilege = false;
+
+    if (m_config.useRawRecording()) {
+        recordingCtrl = m_meetingService->GetMeetingRecordingController();
+        if (!recordingCtrl) {
+            Util::Logger::getInstance().error("Recording controller not available");
+        } else {
+            m_recordingPrivilege.reset();
+            m_recordingEvent = std::make_unique<MeetingRecordingCtrlEvent>([this](bool canRec) {
+                onRecordingPrivilegeChanged(canRec);
+            });
+            recordingCtrl->SetEvent(m_recordingEvent.get());
 
-                if (auto* videoCtrl = m_meetingService->GetMeetingVideoController()) {
-                    videoCtrl->MuteVideo();
+            // A join token carries the recording privilege, so skip the privilege round trip
+            if (!startRecordingWithToken()) {
+                needPrivilege = recordingCtrl->CanStartRawRecording() != SDKERR_SUCCESS;
+                if (needPrivilege) {
+                    recordingCtrl->RequestLocalRecordingPrivilege();
+                } else {
+                    m_timeline.mark(MeetingTimeline::RECORDING_PRIVILEGE);
                 }
             }
         }
-        
+    }
 
-        auto* reminderController = m_meetingService->GetMeetingReminderController();
-        if (reminderController) {
-            m_reminderEvent = std::make_unique<MeetingReminderEvent>();
-            reminderController->SetEvent(m_reminderEvent.get());
+    muteSelf();
+    setupReminder();
+    setupShare();
+
+    if (!recordingCtrl) {
+        co_return;
+    }
+
+    if (needPrivilege) {
+        uint64_t requested = Util::monotonicNs();
+        auto granted = co_await m_recordingPrivilege.wait(m_context, kPrivilegeTimeout);
+        Util::Tracer::getInstance().asyncSpan("RecordingPrivilege", requested, Util::monotonicNs());
+        if (!granted) {
+            Util::Logger::getInstance().info("Recording privilege not granted yet, recording starts once it is");
+            co_return;
         }
+        if (!*granted) {
+            Util::Logger::getInstance().warn("Recording privilege denied");
+            co_return;
+        }
+    }
 
-        // Setup share event if we're capturing video (which is always share)
-        if (m_config.useRawVideo()) {
-            auto* shareCtrl = m_meetingService->GetMeetingShareController();
-            if (shareCtrl) {
-                auto onShareStart = [this](const ZoomSDKSharingSourceInfo& info) {
-                    subscribeShare(info);
-                };
-                auto onShareEnd = [this](const ZoomSDKSharingSourceInfo& info) {
-                    unSubscribeShare(info);
-                };
-                m_shareEvent = std::make_unique<MeetingShareEvent>(onShareStart, onShareEnd);
-                shareCtrl->SetEvent(m_shareEvent.get());
-            }
+    co_await startRecording();
+}
+
+bool Meeting::startRecordingWithToken() {
+    if (m_config.joinToken().empty()) return false;
+
+    // Start before VoIP is joined; startRecording() finishes the audio subscription
+    SDKError err = startRawRecording();
+    if (!m_isRecording) {
+        ZLOG_INFO("Raw recording with the join token failed ({}), asking for the privilege", static_cast<int>(err));
+        return false;
+    }
+    m_timeline.mark(MeetingTimeline::RECORDING_PRIVILEGE);
+    return true;
+}
+
+void Meeting::onRecordingPrivilegeChanged(bool canRecord) {
+    Util::FlightRecorder::getInstance().record("recording_privilege", this, canRecord);
+    if (canRecord) {
+        m_timeline.mark(MeetingTimeline::RECORDING_PRIVILEGE);
+    }
+    if (m_recordingPrivilege.hasWaiters()) {
+        // The join flow is waiting for exactly this answer
+        m_recordingPrivilege.set(canRecord);
+        return;
+    }
+
+    if (canRecord)
+        m_tasks.spawn(resumeRecording());
+    else
+        stopRawRecording();
+}
+
+Util::Task<SDKError> Meeting::startRecording() {
+    SDKError err = startRawRecording();
+
+    static auto& retries = Util::MetricsRegistry::getInstance().counter(
+        "zoom_audio_subscribe_retries_total", "Raw audio subscribe attempts repeated while audio was joining");
+    for (int attempt = 0; err == SDKERR_NOT_JOIN_AUDIO && attempt < kAudioJoinAttempts; attempt++) {
+        retries.add();
+        ZLOG_INFO("Audio not yet joined, waiting... ({} retries left)", kAudioJoinAttempts - attempt);
+        if (m_audioJoined.isSet()) {
+            // The event is latched: VoIP is up but the SDK won't take the subscribe yet, so back off
+            co_await Util::Delay(m_context, kAudioJoinRetryInterval);
+        } else {
+            co_await m_audioJoined.wait(m_context, kAudioJoinRetryInterval);
         }
+        err = subscribeAudio();
+    }
 
-        if (m_config.useRawRecording()) {
-            auto recordingCtrl = m_meetingService->GetMeetingRecordingController();
-            if (!recordingCtrl) {
-                Util::Logger::getInstance().error("Recording controller not available");
-                return;
-            }
+    if (err == SDKERR_NOT_JOIN_AUDIO)
+        hasError(err, "subscribe to raw audio");
+    co_return err;
+}
 
-            std::function<void(bool)> onRecordingPrivilegeChanged = [this](bool canRec) {
-                if (canRec)
-                    startRawRecording();
-                else
-                    stopRawRecording();
-            };
+Util::Task<> Meeting::resumeRecording() {
+    co_await startRecording();
+}
 
-            m_recordingEvent = std::make_unique<MeetingRecordingCtrlEvent>(onRecordingPrivilegeChanged);
-            recordingCtrl->SetEvent(m_recordingEvent.get());
-            
-            auto e = recordingCtrl->CanStartRawRecording();
-            if (e == SDKERR_SUCCESS) {
-                startRawRecording();
-            } else {
-                recordingCtrl->RequestLocalRecordingPrivilege();
-            }
+void Meeting::muteSelf() {
+    // mute the bot video & audio by default
+    auto* participantsCtrl = m_meetingService->GetMeetingParticipantsController();
+    if (!participantsCtrl) return;
+
+    auto* botUser = participantsCtrl->GetMySelfUser();
+    if (!botUser) return;
+
+    if (auto* audioCtrl = m_meetingService->GetMeetingAudioController()) {
+        auto getSelfId = [participantsCtrl]() -> unsigned int {
+            auto* self = participantsCtrl->GetMySelfUser();
+            return self ? self->GetUserID() : 0;
+        };
+        m_audioEvent = std::make_unique<MeetingAudioCtrlEvent>(getSelfId, [this]() { m_audioJoined.set(); });
+        audioCtrl->SetEvent(m_audioEvent.get());
+
+        audioCtrl->MuteAudio(botUser->GetUserID());
+        // a workaround to join audio
+        // https://devforum.zoom.us/t/cant-record-audio-with-linux-meetingsdk-after-6-3-5-6495-error-code-32/130689/10
+        audioCtrl->JoinVoip();
+
+        if (botUser->GetAudioJoinType() != AUDIOTYPE_NONE) {
+            m_audioJoined.set();
         }
-    };
-    
-    std::function<void()> onLeave = [this]() {
-        m_isJoined = false;
-        m_isRecording = false;
-        Util::Logger::getInstance().info("Left meeting");
-    };
+    }
 
-    m_meetingServiceEvent = std::make_unique<MeetingServiceEvent>(onJoin, onLeave);
+    if (auto* videoCtrl = m_meetingService->GetMeetingVideoController()) {
+        videoCtrl->MuteVideo();
+    }
+}
 
-    return m_meetingService->SetEvent(m_meetingServiceEvent.get());
+void Meeting::setupReminder() {
+    auto* reminderController = m_meetingService->GetMeetingReminderController();
+    if (reminderController) {
+        m_reminderEvent = std::make_unique<MeetingReminderEvent>();
+        reminderController->SetEvent(m_reminderEvent.get());
+    }
+}
+
+void Meeting::setupShare() {
+    // Setup share event if we're capturing video (which is always share)
+    if (!m_config.useRawVideo()) return;
+
+    auto* shareCtrl = m_meetingService->GetMeetingShareController();
+    if (shareCtrl) {
+        auto onShareStart = [this](const ZoomSDKSharingSourceInfo& info) {
+            subscribeShare(info);
+        };
+        auto onShareEnd = [this](const ZoomSDKSharingSourceInfo& info) {
+            unSubscribeShare(info);
+        };
+        m_shareEvent = std::make_unique<MeetingShareEvent>(onShareStart, onShareEnd);
+        shareCtrl->SetEvent(m_shareEvent.get());
+    }
 }
 
 SDKError Meeting::join() {
@@ -188,6 +336,9 @@ SDKError Meeting::join() {
         audioSettings->EnableAutoJoinAudio(true);
     }
 
+    m_timeline.reset();
+    ZPROBE(join_start, this);
+    Util::FlightRecorder::getInstance().record("join_start", this);
     return m_meetingService->Join(joinParam);
 }
 
@@ -206,6 +357,9 @@ SDKError Meeting::start() {
     normalUser.isAudioOff = false;
     startParam.param.normaluserStart = normalUser;
 
+    m_timeline.reset();
+    ZPROBE(join_start, this);
+    Util::FlightRecorder::getInstance().record("join_start", this);
     SDKError err = m_meetingService->Start(startParam);
     hasError(err, "start meeting");
 
@@ -236,15 +390,17 @@ SDKError Meeting::startRawRecording() {
     }
 
     if (m_isRecording) {
-        return SDKERR_SUCCESS;
+        return subscribeAudio();
     }
 
     SDKError err;
 
     auto recCtrl = m_meetingService->GetMeetingRecordingController();
     err = recCtrl->StartRawRecording();
+    Util::FlightRecorder::getInstance().record("start_raw_recording", this, err);
     if (hasError(err, "start raw recording"))
         return err;
+    m_timeline.mark(MeetingTimeline::RECORDING_STARTED);
 
     if (m_config.useRawVideo()) {
         // Video always means shared screen content
@@ -275,28 +431,34 @@ SDKError Meeting::startRawRecording() {
         }
     }
 
-    if (m_config.useRawAudio() && m_audioSource) {
+    m_isRecording = true;
+
+    // Audio join may still be in progress; startRecording() retries once it completes
+    return subscribeAudio();
+}
+
+SDKError Meeting::subscribeAudio() {
+    if (m_audioSubscribed || !m_config.useRawAudio() || !m_audioSource) {
+        return SDKERR_SUCCESS;
+    }
+
+    if (!m_audioHelper) {
         m_audioHelper = GetAudioRawdataHelper();
         if (!m_audioHelper)
             return SDKERR_UNINITIALIZE;
-
-        // Audio join may still be in progress, retry with delays
-        int retries = 10; // 10 retries with 500ms each = 5 seconds max
-        err = SDKERR_NOT_JOIN_AUDIO;
-        while (retries > 0 && err == SDKERR_NOT_JOIN_AUDIO) {
-            err = m_audioHelper->subscribe(m_audioSource);
-            if (err == SDKERR_NOT_JOIN_AUDIO) {
-                Util::Logger::getInstance().info("Audio not yet joined, waiting... (" + std::to_string(retries) + " retries left)");
-                std::this_thread::sleep_for(std::chrono::milliseconds(500));
-                retries--;
-            }
-        }
-        
-        if (hasError(err, "subscribe to raw audio"))
-            return err;
     }
-    
-    m_isRecording = true;
+
+    SDKError err = m_audioHelper->subscribe(m_audioSource);
+    ZPROBE(audio_subscribe, this, static_cast<int>(err));
+    Util::FlightRecorder::getInstance().record("audio_subscribe", this, err);
+    if (err == SDKERR_NOT_JOIN_AUDIO)
+        return err;
+
+    if (hasError(err, "subscribe to raw audio"))
+        return err;
+
+    m_audioSubscribed = true;
+    m_timeline.mark(MeetingTimeline::AUDIO_SUBSCRIBED);
     return SDKERR_SUCCESS;
 }
 
@@ -312,6 +474,9 @@ SDKError Meeting::stopRawRecording() {
     
     if (m_audioHelper) {
         m_audioHelper->unSubscribe();
+        m_audioSubscribed = false;
+        ZPROBE(audio_unsubscribe, this);
+        Util::FlightRecorder::getInstance().record("audio_unsubscribe", this);
     }
     
     if (m_videoHelper) {
@@ -357,11 +522,9 @@ bool Meeting::hasError(const SDKError e, const std::string& action) {
 
     if(!action.empty()) {
         if (isError) {
-            std::stringstream ss;
-            ss << "failed to " << action << " with status " << e;
-            Util::Logger::getInstance().error(ss.str());
+            ZLOG_ERROR("failed to {} with status {}", action, e);
         } else {
-            Util::Logger::getInstance().success(action);
+            ZLOG_SUCCESS("{}", action);
         }
     }
     return isError;
@@ -381,20 +544,24 @@ void Meeting::subscribeShare(const ZoomSDKSharingSourceInfo& shareInfo) {
     }
 
     auto err = m_videoHelper->subscribe(shareInfo.shareSourceID, RAW_DATA_TYPE_SHARE);
+    ZPROBE(share_subscribe, this, shareInfo.shareSourceID, static_cast<int>(err));
+    Util::FlightRecorder::getInstance().record("share_subscribe", this, shareInfo.shareSourceID, err);
     if (hasError(err, "subscribe to share source " + std::to_string(shareInfo.shareSourceID))) {
         return;
     }
 
     m_currentShareSourceId = shareInfo.shareSourceID;
     m_shareSubscribed = true;
-    Util::Logger::getInstance().success("Subscribed to share source " + std::to_string(shareInfo.shareSourceID));
+    ZLOG_SUCCESS("Subscribed to share source {}", shareInfo.shareSourceID);
 }
 
 void Meeting::unSubscribeShare(const ZoomSDKSharingSourceInfo& shareInfo) {
     // Unsubscribe if this is the share we're currently subscribed to
     if (m_videoHelper && m_shareSubscribed && m_currentShareSourceId == shareInfo.shareSourceID) {
         m_videoHelper->unSubscribe();
-        Util::Logger::getInstance().success("Unsubscribed from share source " + std::to_string(m_currentShareSourceId));
+        ZPROBE(share_unsubscribe, this, m_currentShareSourceId);
+        Util::FlightRecorder::getInstance().record("share_unsubscribe", this, m_currentShareSourceId);
+        ZLOG_SUCCESS("Unsubscribed from share source {}", m_currentShareSourceId);
         m_currentShareSourceId = 0;
         m_shareSubscribed = false;
     }
@@ -1,12 +1,20 @@
 #ifndef HEADLESS_ZOOM_BOT_MEETING_H
 #define HEADLESS_ZOOM_BOT_MEETING_H
 
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <functional>
 #include <string>
 #include <memory>
 
+#include <glib.h>
+
 #include "MeetingConfig.h"
+#include "MeetingTimeline.h"
+#include "util/AsyncEvent.h"
+#include "util/MediaCapture.h"
+#include "util/Task.h"
 
 // SDK interfaces needed by implementation
 #include "meeting_service_interface.h"
@@ -26,6 +34,7 @@
 #include "events/MeetingReminderEvent.h"
 #include "events/MeetingRecordingCtrlEvent.h"
 #include "events/MeetingShareEvent.h"
+#include "events/MeetingAudioCtrlEvent.h"
 
 
 class Meeting {
@@ -41,6 +50,7 @@ class Meeting {
 
     bool m_isJoined;
     bool m_isRecording;
+    bool m_audioSubscribed;
 
     // Service references (injected instead of obtained from singleton)
     ZOOMSDK::IMeetingService* m_meetingService;
@@ -51,12 +61,40 @@ class Meeting {
     std::unique_ptr<MeetingRecordingCtrlEvent> m_recordingEvent;
     std::unique_ptr<MeetingServiceEvent> m_meetingServiceEvent;
     std::unique_ptr<MeetingShareEvent> m_shareEvent;
+    std::unique_ptr<MeetingAudioCtrlEvent> m_audioEvent;
+
+    // Context the meeting was created on; SDK callbacks and the lifecycle coroutine run there
+    GMainContext* m_context;
+
+    // SDK events the lifecycle coroutine waits on
+    Util::AsyncEvent<> m_inMeeting;
+    Util::AsyncEvent<> m_audioJoined;
+    Util::AsyncEvent<bool> m_recordingPrivilege;
+
+    // Steps from the join()/start() call to the first frames, restarted on every call
+    MeetingTimeline m_timeline{this};
+
+    // Raw media callbacks written to a capture file while capturing
+    Util::MediaCaptureWriter m_capture{this};
 
     // Share tracking
     unsigned int m_currentShareSourceId;
     bool m_shareSubscribed;
 
+    // Declared after the events it awaits so suspended tasks are destroyed first
+    Util::TaskScope m_tasks;
+
     ZOOMSDK::SDKError setupMeetingEvents();
+    Util::Task<> lifecycle();
+    Util::Task<> onJoined();
+    Util::Task<ZOOMSDK::SDKError> startRecording();
+    Util::Task<> resumeRecording();
+    void onRecordingPrivilegeChanged(bool canRecord);
+    bool startRecordingWithToken();
+    void muteSelf();
+    void setupReminder();
+    void setupShare();
+    ZOOMSDK::SDKError subscribeAudio();
     void subscribeShare(const ZOOMSDK::ZoomSDKSharingSourceInfo& shareInfo);
     void unSubscribeShare(const ZOOMSDK::ZoomSDKSharingSourceInfo& shareInfo);
 
@@ -79,6 +117,9 @@ public:
     const MeetingConfig& getConfig() const { return m_config; }
     ZOOMSDK::IMeetingService* getMeetingService() const { return m_meetingService; }
 
+    MeetingTimeline& timeline() { return m_timeline; }
+    Util::MediaCaptureWriter& capture() { return m_capture; }
+
     void setAudioSource(ZOOMSDK::IZoomSDKAudioRawDataDelegate* source) { m_audioSource = source; }
     ZOOMSDK::IZoomSDKAudioRawDataDelegate* getAudioSource() const { return m_audioSource; }
     
@@ -0,0 +1,53 @@
+#include "MeetingTimeline.h"
+#include "util/FlightRecorder.h"
+#include "util/Trace.h"
+
+#include <string>
+
+static const char* const kStepNames[MeetingTimeline::STEP_COUNT] = {
+    "in_meeting", "recording_privilege", "recording_started", "audio_subscribed", "first_audio", "first_video",
+};
+
+const char* MeetingTimeline::stepName(Step step) {
+    return step >= 0 && step < STEP_COUNT ? kStepNames[step] : "unknown";
+}
+
+void MeetingTimeline::reset(uint64_t joinRequestedNs) {
+    for (auto& step : m_steps) {
+        step.store(0, std::memory_order_relaxed);
+    }
+    m_joinRequestedNs.store(joinRequestedNs, std::memory_order_release);
+}
+
+bool MeetingTimeline::markSlow(Step step, uint64_t ns) {
+    uint64_t joinRequested = m_joinRequestedNs.load(std::memory_order_acquire);
+    if (joinRequested == 0) return false;  // no join request yet, nothing to measure against
+
+    uint64_t expected = 0;
+    if (!m_steps[step].compare_exchange_strong(expected, ns, std::memory_order_relaxed)) return false;
+
+    static Util::Histogram* durations[STEP_COUNT] = {};
+    static bool registered = [] {
+        for (int i = 0; i < STEP_COUNT; i++) {
+            durations[i] = &Util::MetricsRegistry::getInstance().histogram(
+                "zoom_join_step_seconds", "Time from the join request to each step on the way to the first frames",
+                std::string("step=\"") + kStepNames[i] + "\"", 1e-9);
+        }
+        return true;
+    }();
+    (void)registered;
+
+    uint64_t elapsedNs = ns > joinRequested ? ns - joinRequested : 0;
+    durations[step]->record(elapsedNs);
+    Util::Tracer::getInstance().asyncSpan(kStepNames[step], joinRequested, ns);
+    Util::FlightRecorder::getInstance().record(kStepNames[step], m_meeting, static_cast<int64_t>(elapsedNs / 1000));
+    return true;
+}
+
+uint64_t MeetingTimeline::elapsed(Step step) const {
+    uint64_t at = m_steps[step].load(std::memory_order_relaxed);
+    uint64_t joinRequested = m_joinRequestedNs.load(std::memory_order_relaxed);
+    if (at == 0) return 0;
+    // A step stamped within the same nanosecond still reads as reached
+    return at > joinRequested ? at - joinRequested : 1;
+}
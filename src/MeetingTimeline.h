@@ -0,0 +1,59 @@
+#ifndef HEADLESS_ZOOM_BOT_MEETING_TIMELINE_H
+#define HEADLESS_ZOOM_BOT_MEETING_TIMELINE_H
+
+#include <atomic>
+#include <cstdint>
+
+#include "util/Metrics.h"
+
+/**
+ * Milestones on the critical path from the join request to the first media frames
+ *
+ * Each step is stamped once per join request, with CLOCK_MONOTONIC nanoseconds.
+ * The first stamp of a step also feeds zoom_join_step_seconds{step} and the trace.
+ * Steps are marked from SDK callbacks and frame delivery threads and read by the
+ * C API; mark() on a step that is already stamped costs one relaxed load.
+ */
+class MeetingTimeline {
+public:
+    enum Step {
+        IN_MEETING,           // MEETING_STATUS_INMEETING
+        RECORDING_PRIVILEGE,  // Raw recording allowed (at once, by token, or granted by the host)
+        RECORDING_STARTED,    // StartRawRecording succeeded
+        AUDIO_SUBSCRIBED,     // Raw audio subscribed
+        FIRST_AUDIO,          // First raw audio frame
+        FIRST_VIDEO,          // First raw video frame
+        STEP_COUNT
+    };
+
+    // meeting identifies the owner in flight recorder events
+    explicit MeetingTimeline(const void* meeting = nullptr) : m_meeting(meeting) {}
+
+    // Start a new timeline; called on every join()/start()
+    void reset(uint64_t joinRequestedNs = Util::monotonicNs());
+
+    /**
+     * Stamp a step if it was not reached yet since the join request
+     * @return true if this call stamped it
+     */
+    bool mark(Step step, uint64_t ns = Util::monotonicNs()) {
+        if (m_steps[step].load(std::memory_order_relaxed) != 0) return false;
+        return markSlow(step, ns);
+    }
+
+    uint64_t joinRequestedNs() const { return m_joinRequestedNs.load(std::memory_order_relaxed); }
+
+    // Time from the join request to the step, 0 if not reached
+    uint64_t elapsed(Step step) const;
+
+    static const char* stepName(Step step);
+
+private:
+    bool markSlow(Step step, uint64_t ns);
+
+    const void* m_meeting;
+    std::atomic<uint64_t> m_joinRequestedNs{0};
+    std::atomic<uint64_t> m_steps[STEP_COUNT] = {};
+};
+
+#endif // HEADLESS_ZOOM_BOT_MEETING_TIMELINE_H
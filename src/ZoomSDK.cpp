@@ -2,6 +2,8 @@
 #include "Meeting.h"
 #include "MeetingConfig.h"
 #include "util/Logger.h"
+#include "util/Probes.h"
+#include "util/Trace.h"
 #include <cstdlib>
 
 using namespace ZOOMSDK;
@@ -12,7 +14,8 @@ ZoomSDK::ZoomSDK()
     , m_networkHelper(nullptr)
     , m_meetingService(nullptr)
     , m_isInitialized(false)
-    , m_isAuthenticated(false) {
+    , m_isAuthenticated(false)
+    , m_authStartNs(0) {
 }
 
 ZoomSDK::~ZoomSDK() {
@@ -32,6 +35,8 @@ SDKError ZoomSDK::initialize(const std::string& sdkKey, const std::string& sdkSe
         return SDKERR_UNINITIALIZE;
     }
     
+    ZTRACE_SCOPE("ZoomSDK::initialize");
+    
     m_sdkKey = sdkKey;
     m_sdkSecret = sdkSecret;
     m_zoomHost = zoomHost;
@@ -48,7 +53,11 @@ SDKError ZoomSDK::initialize(const std::string& sdkKey, const std::string& sdkSe
     initParam.enableLogByDefault = true;
     initParam.enableGenerateDump = true;
     
-    SDKError err = InitSDK(initParam);
+    SDKError err;
+    {
+        ZTRACE_SCOPE("InitSDK");
+        err = InitSDK(initParam);
+    }
     if (hasError(err, "initialize SDK")) return err;
     
     err = createGlobalServices();
@@ -63,10 +72,16 @@ SDKError ZoomSDK::initialize(const std::string& sdkKey, const std::string& sdkSe
 SDKError ZoomSDK::createGlobalServices() {
     SDKError err;
     
-    err = CreateSettingService(&m_settingService);
+    {
+        ZTRACE_SCOPE("CreateSettingService");
+        err = CreateSettingService(&m_settingService);
+    }
     if (hasError(err, "create setting service")) return err;
     
-    err = CreateNetworkConnectionHelper(&m_networkHelper);
+    {
+        ZTRACE_SCOPE("CreateNetworkConnectionHelper");
+        err = CreateNetworkConnectionHelper(&m_networkHelper);
+    }
     if (hasError(err, "create network connection helper")) return err;
     
     // Configure proxy settings
@@ -76,13 +91,16 @@ SDKError ZoomSDK::createGlobalServices() {
     if (const char* proxy_env = getenv("HTTP_PROXY")) {
         proxy_setting.auto_detect = false;
         proxy_setting.proxy = proxy_env;
-        Util::Logger::getInstance().info("Proxy found: " + std::string(proxy_env));
+        ZLOG_INFO("Proxy found: {}", proxy_env);
     }
     
     m_networkHelper->ConfigureProxy(proxy_setting);
     
     // Create meeting service at SDK level
-    err = CreateMeetingService(&m_meetingService);
+    {
+        ZTRACE_SCOPE("CreateMeetingService");
+        err = CreateMeetingService(&m_meetingService);
+    }
     if (hasError(err, "create meeting service")) return err;
     
     return SDKERR_SUCCESS;
@@ -106,6 +124,7 @@ SDKError ZoomSDK::authenticate( std::function<void()> onAuthCallback) {
     m_onAuthCallback = onAuthCallback;
     
      std::function<void()> onAuth = [this]() {
+        Util::Tracer::getInstance().asyncSpan("SDKAuth", m_authStartNs, Util::monotonicNs());
         m_isAuthenticated = true;
         Util::Logger::getInstance().success("SDK authenticated successfully");
         if (m_onAuthCallback) {
@@ -122,10 +141,15 @@ SDKError ZoomSDK::authenticate( std::function<void()> onAuthCallback) {
     AuthContext ctx;
     ctx.jwt_token = m_jwt.c_str();
     
+    // Auth completes in onAuthenticationReturn; the span ends there
+    m_authStartNs = Util::monotonicNs();
+    ZPROBE(auth_start, this);
     return m_authService->SDKAuth(ctx);
 }
 
 void ZoomSDK::generateJWT(const std::string& key, const std::string& secret) {
+    ZTRACE_SCOPE("generateJWT");
+    
     m_iat = std::chrono::system_clock::now();
     m_exp = m_iat + std::chrono::hours{24};
     
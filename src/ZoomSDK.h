@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <chrono>
+#include <cstdint>
 #include <string>
 #include <sstream>
 #include <functional>
@@ -45,6 +46,7 @@ class ZoomSDK {
     
     bool m_isInitialized;
     bool m_isAuthenticated;
+    uint64_t m_authStartNs;
     
     std::function<void()> m_onAuthCallback;
     
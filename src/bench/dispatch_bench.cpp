@@ -0,0 +1,228 @@
+// Cost of the C API media dispatch path under concurrent meetings
+//
+// usage: dispatch_bench [audio_frames_per_meeting] [video_frames_per_meeting]
+//
+// Builds with -DFAKE_MEETINGSDK=ON: every meeting is a real handle from
+// zoom_meeting_create_and_join() against the stand-in SDK, each on its own
+// SDK instance. One thread per meeting then calls zoom_meeting_dispatch_audio()
+// or zoom_meeting_dispatch_video() in a loop, as the SDK's delivery thread
+// would, with inline delivery into a trivial callback. In "control" runs two
+// more threads hammer zoom_meeting_get_status() and
+// zoom_meeting_set_audio_callback()/zoom_meeting_set_video_callback() on
+// random meetings, which take the same g_instance_mutex as every frame.
+//
+// "ns/frame" is wall time per frame per meeting thread, "frames/s" the
+// aggregate over all meetings, and the percentiles are per dispatch call.
+
+#include "zoom_sdk_c.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr int kAudioFrameBytes = 640;    // 10 ms of 32 kHz mono S16LE
+static constexpr unsigned kVideoWidth = 1280;
+static constexpr unsigned kVideoHeight = 720;
+
+static thread_local unsigned long long t_delivered = 0;
+
+static void on_audio(MeetingHandle, const void*, int, int, unsigned int) {
+    t_delivered++;
+}
+
+static void on_video(MeetingHandle, const char*, const char*, const char*, unsigned int, unsigned int,
+                     unsigned int, unsigned int, unsigned long long) {
+    t_delivered++;
+}
+
+static unsigned long long now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+struct Meeting {
+    ZoomSDKHandle sdk;
+    MeetingHandle handle;
+};
+
+struct Result {
+    double nsPerFrame;
+    double framesPerSec;
+    uint64_t p50Ns;
+    uint64_t p99Ns;
+    uint64_t p999Ns;
+    uint64_t maxNs;
+    uint64_t undelivered;
+    double controlPerSec;
+};
+
+static Result run(const std::vector<Meeting>& meetings, bool video, bool control, int framesPerMeeting) {
+    const int count = static_cast<int>(meetings.size());
+    std::vector<char> audio(kAudioFrameBytes, 1);
+    std::vector<char> frame(kVideoWidth * kVideoHeight * 3 / 2, 16);
+    const char* y = frame.data();
+    const char* u = y + kVideoWidth * kVideoHeight;
+    const char* v = u + kVideoWidth * kVideoHeight / 4;
+
+    std::vector<std::vector<uint32_t>> latencies(count);
+    std::vector<unsigned long long> delivered(count);
+    std::atomic<int> ready{0};
+    std::atomic<bool> go{false};
+    std::atomic<bool> producing{true};
+    std::atomic<uint64_t> controlCalls{0};
+
+    std::vector<std::thread> controllers;
+    if (control) {
+        controllers.emplace_back([&]() {
+            std::minstd_rand rng(1);
+            uint64_t calls = 0;
+            while (producing.load(std::memory_order_relaxed)) {
+                zoom_meeting_get_status(meetings[rng() % count].handle);
+                calls++;
+            }
+            controlCalls += calls;
+        });
+        controllers.emplace_back([&]() {
+            std::minstd_rand rng(2);
+            uint64_t calls = 0;
+            while (producing.load(std::memory_order_relaxed)) {
+                MeetingHandle handle = meetings[rng() % count].handle;
+                if (video) {
+                    zoom_meeting_set_video_callback(handle, on_video);
+                } else {
+                    zoom_meeting_set_audio_callback(handle, on_audio);
+                }
+                calls++;
+            }
+            controlCalls += calls;
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (int m = 0; m < count; m++) {
+        producers.emplace_back([&, m]() {
+            MeetingHandle handle = meetings[m].handle;
+            auto& samples = latencies[m];
+            samples.reserve(framesPerMeeting);
+            t_delivered = 0;
+
+            ready++;
+            while (!go.load(std::memory_order_acquire)) {
+            }
+            for (int i = 0; i < framesPerMeeting; i++) {
+                unsigned long long before = now_ns();
+                if (video) {
+                    zoom_meeting_dispatch_video(handle, y, u, v, kVideoWidth, kVideoHeight,
+                                                static_cast<unsigned>(frame.size()), 1, i, before);
+                } else {
+                    zoom_meeting_dispatch_audio(handle, audio.data(), kAudioFrameBytes, ZOOM_AUDIO_TYPE_ONE_WAY,
+                                                100 + (i & 7), before);
+                }
+                samples.push_back(static_cast<uint32_t>(std::min<unsigned long long>(now_ns() - before, UINT32_MAX)));
+            }
+            delivered[m] = t_delivered;
+        });
+    }
+
+    while (ready.load() < count) {
+        std::this_thread::yield();
+    }
+    auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& p : producers) {
+        p.join();
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    producing = false;
+    for (auto& c : controllers) {
+        c.join();
+    }
+
+    std::vector<uint32_t> all;
+    all.reserve(static_cast<size_t>(count) * framesPerMeeting);
+    unsigned long long total = 0;
+    for (int m = 0; m < count; m++) {
+        all.insert(all.end(), latencies[m].begin(), latencies[m].end());
+        total += delivered[m];
+    }
+    std::sort(all.begin(), all.end());
+
+    double frames = static_cast<double>(count) * framesPerMeeting;
+    Result r;
+    r.nsPerFrame = elapsed * 1e9 / framesPerMeeting;
+    r.framesPerSec = frames / elapsed;
+    r.p50Ns = all[all.size() / 2];
+    r.p99Ns = all[all.size() * 99 / 100];
+    r.p999Ns = all[all.size() * 999 / 1000];
+    r.maxNs = all.back();
+    r.undelivered = static_cast<uint64_t>(frames) - total;
+    r.controlPerSec = controlCalls.load() / elapsed;
+    return r;
+}
+
+int main(int argc, char** argv) {
+    int audioFrames = argc > 1 ? std::atoi(argv[1]) : 200000;
+    int videoFrames = argc > 2 ? std::atoi(argv[2]) : 50000;
+
+    // Fast joins and no synthetic media of the stand-in SDK's own
+    setenv("ZOOM_FAKE_SDK_AUTH_MS", "0", 0);
+    setenv("ZOOM_FAKE_SDK_JOIN_MS", "0", 0);
+    setenv("ZOOM_FAKE_SDK_SHARE_FPS", "0", 0);
+    setenv("ZOOM_FAKE_SDK_AUDIO_INTERVAL_MS", "1000", 0);
+
+    // The C API reports every callback change on stdout; keep the table readable
+    FILE* report = fdopen(dup(STDOUT_FILENO), "w");
+    if (!report || !freopen("/dev/null", "w", stdout)) {
+        std::perror("stdout");
+        return 1;
+    }
+
+    std::vector<Meeting> meetings;
+    for (int count : {1, 8, 64}) {
+        while (static_cast<int>(meetings.size()) < count) {
+            Meeting meeting;
+            meeting.sdk = zoom_sdk_create("bench", "bench");
+            meeting.handle = meeting.sdk ? zoom_meeting_create_and_join(meeting.sdk, "1000", "bench", "bench", nullptr, 0, 0)
+                                         : nullptr;
+            if (!meeting.handle) {
+                std::fprintf(stderr, "failed to create meeting %zu; build with -DFAKE_MEETINGSDK=ON\n", meetings.size());
+                return 1;
+            }
+            zoom_meeting_set_audio_callback(meeting.handle, on_audio);
+            zoom_meeting_set_video_callback(meeting.handle, on_video);
+            meetings.push_back(meeting);
+        }
+
+        if (count == 1) {
+            std::fprintf(report, "%-5s %8s %7s %9s %12s %8s %8s %9s %9s %11s %10s\n", "kind", "meetings", "control",
+                         "ns/frame", "frames/s", "p50(ns)", "p99(ns)", "p99.9(ns)", "max(ns)", "undelivered",
+                         "control/s");
+        }
+        for (bool video : {false, true}) {
+            for (bool control : {false, true}) {
+                Result r = run(meetings, video, control, video ? videoFrames : audioFrames);
+                std::fprintf(report, "%-5s %8d %7s %9.1f %12.0f %8llu %8llu %9llu %9llu %11llu %10.0f\n",
+                             video ? "video" : "audio", count, control ? "on" : "off", r.nsPerFrame, r.framesPerSec,
+                             (unsigned long long)r.p50Ns, (unsigned long long)r.p99Ns,
+                             (unsigned long long)r.p999Ns, (unsigned long long)r.maxNs,
+                             (unsigned long long)r.undelivered, r.controlPerSec);
+                std::fflush(report);
+            }
+        }
+    }
+
+    for (auto& meeting : meetings) {
+        zoom_meeting_destroy(meeting.handle);
+        zoom_sdk_destroy(meeting.sdk);
+    }
+    std::fclose(report);
+    return 0;
+}
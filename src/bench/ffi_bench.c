@@ -0,0 +1,163 @@
+// C baseline of the cross-binding audio callback benchmark
+//
+// usage: ffi_bench [frames=200000] [participants=0] [paced=0]
+//
+// Builds with -DFAKE_MEETINGSDK=ON. Joins one stand-in meeting whose media
+// thread delivers `frames` 10 ms PCM frames of the mixed stream and of each
+// participant (ZOOM_FAKE_SDK_AUDIO_FRAMES), as the SDK's delivery thread
+// would: a native thread unknown to any language runtime. The callback does
+// what every binding benchmark does: copy the frame out of the SDK's buffer
+// and hand it to a consumer thread through a bounded queue of 1000 frames,
+// dropping when it is full. Here the queue slots are preallocated, so nothing
+// is allocated per frame; the Go (headless-meeting-bot ffibench) and Python
+// (bench/ffi_bench.py) versions print the same row for comparison.
+//
+// The stand-in SDK times every callback and writes the percentiles to
+// ZOOM_FAKE_SDK_DELIVERY_REPORT (see fake_sdk/FakeConfig.h). Unpaced runs
+// (ZOOM_FAKE_SDK_UNPACED) show the most one delivery thread can push through
+// the binding; a paced run every 10 ms is sustainable when it reports no late
+// and no dropped frames.
+
+#include "zoom_sdk_c.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define FRAME_BYTES 640  // 10 ms of 32 kHz mono S16LE
+#define QUEUE_FRAMES 1000
+
+static char g_slots[QUEUE_FRAMES][FRAME_BYTES];
+static int g_head, g_count;
+static unsigned long long g_dropped, g_consumed_bytes;
+static int g_stop;
+static pthread_mutex_t g_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t g_ready = PTHREAD_COND_INITIALIZER;
+
+static void on_audio(MeetingHandle meeting, const void* data, int length, int type, unsigned int node_id) {
+    (void)meeting;
+    (void)type;
+    (void)node_id;
+    pthread_mutex_lock(&g_mutex);
+    if (g_count == QUEUE_FRAMES) {
+        g_dropped++;
+    } else {
+        memcpy(g_slots[(g_head + g_count) % QUEUE_FRAMES], data, length < FRAME_BYTES ? length : FRAME_BYTES);
+        g_count++;
+        pthread_cond_signal(&g_ready);
+    }
+    pthread_mutex_unlock(&g_mutex);
+}
+
+static void* consume(void* arg) {
+    (void)arg;
+    pthread_mutex_lock(&g_mutex);
+    while (!g_stop || g_count > 0) {
+        if (g_count == 0) {
+            pthread_cond_wait(&g_ready, &g_mutex);
+            continue;
+        }
+        g_consumed_bytes += (unsigned char)g_slots[g_head][0] + FRAME_BYTES;
+        g_head = (g_head + 1) % QUEUE_FRAMES;
+        g_count--;
+    }
+    pthread_mutex_unlock(&g_mutex);
+    return NULL;
+}
+
+// Runs the SDK instance's main loop, where the stand-in SDK's control callbacks are delivered
+static void* run_loop(void* sdk) {
+    zoom_sdk_run_loop((ZoomSDKHandle)sdk);
+    return NULL;
+}
+
+// Waits for the stand-in SDK's delivery report and parses it, 0 on timeout
+static int read_report(const char* path, unsigned long long* values, int seconds) {
+    for (int waited = 0; waited < seconds * 1000; waited++) {
+        FILE* file = fopen(path, "r");
+        if (file) {
+            int fields = fscanf(file, "frames=%llu elapsed_ns=%llu p50_ns=%llu p99_ns=%llu max_ns=%llu late=%llu",
+                                &values[0], &values[1], &values[2], &values[3], &values[4], &values[5]);
+            fclose(file);
+            unlink(path);
+            return fields == 6;
+        }
+        usleep(1000);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    int frames = argc > 1 ? atoi(argv[1]) : 200000;
+    int participants = argc > 2 ? atoi(argv[2]) : 0;
+    int paced = argc > 3 ? atoi(argv[3]) : 0;
+    if (frames <= 0 || participants < 0) {
+        fprintf(stderr, "usage: %s [frames=200000] [participants=0] [paced=0]\n", argv[0]);
+        return 2;
+    }
+
+    // Fast joins, no share, and the audio run and its report
+    char value[32];
+    char report_path[64];
+    snprintf(report_path, sizeof(report_path), "/tmp/ffi_bench.%d.report", (int)getpid());
+    setenv("ZOOM_FAKE_SDK_AUTH_MS", "0", 0);
+    setenv("ZOOM_FAKE_SDK_JOIN_MS", "0", 0);
+    setenv("ZOOM_FAKE_SDK_AUDIO_JOIN_MS", "0", 0);
+    setenv("ZOOM_FAKE_SDK_SHARE_FPS", "0", 0);
+    snprintf(value, sizeof(value), "%d", participants);
+    setenv("ZOOM_FAKE_SDK_PARTICIPANTS", value, 1);
+    snprintf(value, sizeof(value), "%d", frames);
+    setenv("ZOOM_FAKE_SDK_AUDIO_FRAMES", value, 1);
+    setenv("ZOOM_FAKE_SDK_UNPACED", paced ? "0" : "1", 1);
+    setenv("ZOOM_FAKE_SDK_DELIVERY_REPORT", report_path, 1);
+
+    // The C API reports every callback change on stdout; keep the row readable
+    FILE* report = fdopen(dup(STDOUT_FILENO), "w");
+    if (!report || !freopen("/dev/null", "w", stdout)) {
+        perror("stdout");
+        return 1;
+    }
+
+    pthread_t consumer;
+    pthread_create(&consumer, NULL, consume, NULL);
+
+    ZoomSDKHandle sdk = zoom_sdk_create("bench", "bench");
+    MeetingHandle meeting = sdk ? zoom_meeting_create_and_join(sdk, "1000", "bench", "bench", NULL, 1, 0) : NULL;
+    if (!meeting) {
+        fprintf(stderr, "failed to join; build with -DFAKE_MEETINGSDK=ON\n");
+        return 1;
+    }
+    zoom_meeting_set_audio_callback(meeting, on_audio);
+    pthread_t loop;
+    pthread_create(&loop, NULL, run_loop, sdk);
+
+    // Generous: a paced run takes 10 ms per frame
+    unsigned long long stats[6];
+    int ok = read_report(report_path, stats, 30 + (paced ? frames / 100 : frames / 1000));
+    zoom_sdk_stop_loop(sdk);
+    pthread_join(loop, NULL);
+    if (!ok) {
+        fprintf(stderr, "no delivery report from the stand-in SDK\n");
+        return 1;
+    }
+
+    pthread_mutex_lock(&g_mutex);
+    g_stop = 1;
+    pthread_cond_signal(&g_ready);
+    pthread_mutex_unlock(&g_mutex);
+    pthread_join(consumer, NULL);
+
+    unsigned long long count = stats[0], elapsed = stats[1] ? stats[1] : 1;
+    fprintf(report, "%-8s %9s %9s %8s %8s %9s %10s %12s %11s %5s %8s %6s\n", "binding", "frames", "ns/frame",
+            "p50(ns)", "p99(ns)", "max(ns)", "frames/s", "allocs/frame", "bytes/frame", "gc", "dropped", "late");
+    fprintf(report, "%-8s %9llu %9.1f %8llu %8llu %9llu %10.0f %12.2f %11.1f %5d %8llu %6llu\n", "c", count,
+            (double)elapsed / count, stats[2], stats[3], stats[4], count * 1e9 / elapsed, 0.0, 0.0, 0, g_dropped,
+            stats[5]);
+
+    zoom_meeting_destroy(meeting);
+    zoom_sdk_destroy(sdk);
+    fclose(report);
+    return 0;
+}
@@ -0,0 +1,177 @@
+#!/usr/bin/env python3
+"""Python (ctypes) version of the cross-binding audio callback benchmark
+
+usage: LD_LIBRARY_PATH=build python3 bench/ffi_bench.py [frames=200000] [participants=0] [paced=0]
+
+Needs libzoomsdk_c built with -DFAKE_MEETINGSDK=ON. Same workload as
+bench/ffi_bench.c: the stand-in SDK's media thread calls the callback from a
+native thread, which has to take the GIL (ctypes creates a thread state for
+the foreign thread on every call), copy the frame into a bytes object and hand
+it to a consumer thread through a queue bounded at 1000 frames. Callback
+timings come from the stand-in SDK's delivery report.
+
+CPython has no allocation counter, so allocs/frame and bytes/frame are
+measured in a separate, shorter meeting under tracemalloc (which slows every
+allocation down and would distort the timed run): the sum of the sizes of the
+blocks allocated per frame, counted from a snapshot taken while the consumer
+holds every frame. gc is the number of collections during the timed run.
+"""
+
+import ctypes
+import gc
+import inspect
+import os
+import queue
+import sys
+import tempfile
+import threading
+import time
+import tracemalloc
+
+FRAME_BYTES = 640  # 10 ms of 32 kHz mono S16LE
+QUEUE_FRAMES = 1000
+
+
+AUDIO_CALLBACK = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_uint)
+
+
+def load_sdk():
+    lib = ctypes.CDLL("libzoomsdk_c.so")
+    lib.zoom_sdk_create.restype = ctypes.c_void_p
+    lib.zoom_sdk_create.argtypes = [ctypes.c_char_p, ctypes.c_char_p]
+    lib.zoom_sdk_destroy.argtypes = [ctypes.c_void_p]
+    lib.zoom_meeting_create_and_join.restype = ctypes.c_void_p
+    lib.zoom_meeting_create_and_join.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_char_p, ctypes.c_char_p,
+                                                 ctypes.c_char_p, ctypes.c_int, ctypes.c_int]
+    lib.zoom_meeting_destroy.argtypes = [ctypes.c_void_p]
+    lib.zoom_meeting_set_audio_callback.argtypes = [ctypes.c_void_p, AUDIO_CALLBACK]
+    lib.zoom_sdk_run_loop.argtypes = [ctypes.c_void_p]
+    lib.zoom_sdk_stop_loop.argtypes = [ctypes.c_void_p]
+    return lib
+
+
+class Sink:
+    """Copies frames out of the callback and hands them to a consumer thread"""
+
+    def __init__(self):
+        self.frames = queue.Queue(QUEUE_FRAMES)
+        self.dropped = 0
+        self.consumed = 0
+        self.callback = AUDIO_CALLBACK(self.on_audio)  # must outlive the meeting
+
+    def on_audio(self, meeting, data, length, audio_type, node_id):
+        try:
+            self.frames.put_nowait(ctypes.string_at(data, length))
+        except queue.Full:
+            self.dropped += 1
+
+    def consume(self):
+        while True:
+            frame = self.frames.get()
+            if frame is None:
+                return
+            self.consumed += len(frame)
+
+
+def run_meeting(lib, sink, frames, timeout):
+    """Joins a stand-in meeting that delivers frames per stream; returns its delivery report"""
+    report = os.path.join(tempfile.gettempdir(), "ffi_bench.%d.report" % os.getpid())
+    os.environ["ZOOM_FAKE_SDK_AUDIO_FRAMES"] = str(frames)
+    os.environ["ZOOM_FAKE_SDK_DELIVERY_REPORT"] = report
+
+    sdk = lib.zoom_sdk_create(b"bench", b"bench")
+    meeting = lib.zoom_meeting_create_and_join(sdk, b"1000", b"bench", b"bench", None, 1, 0) if sdk else None
+    if not meeting:
+        raise RuntimeError("failed to join; build with -DFAKE_MEETINGSDK=ON")
+    lib.zoom_meeting_set_audio_callback(meeting, sink.callback)
+    # ctypes releases the GIL for the call, so the loop runs alongside this thread
+    loop = threading.Thread(target=lib.zoom_sdk_run_loop, args=(sdk,), name="sdk-loop")
+    loop.start()
+
+    deadline = time.monotonic() + timeout
+    while not os.path.exists(report) and time.monotonic() < deadline:
+        time.sleep(0.001)
+    lib.zoom_sdk_stop_loop(sdk)
+    loop.join()
+    lib.zoom_meeting_destroy(meeting)
+    lib.zoom_sdk_destroy(sdk)
+    if not os.path.exists(report):
+        raise RuntimeError("no delivery report from the stand-in SDK")
+
+    with open(report) as f:
+        stats = dict((key, int(value)) for key, value in (field.split("=") for field in f.read().split()))
+    os.unlink(report)
+    return stats
+
+
+def measure_allocations(lib, sink):
+    """Bytes and blocks allocated per frame, with the consumer stopped so nothing is freed"""
+    frames = QUEUE_FRAMES // 2
+    code = Sink.on_audio.__code__
+    lines = range(code.co_firstlineno, code.co_firstlineno + len(inspect.getsourcelines(code)[0]))
+    tracemalloc.start(8)
+    before = tracemalloc.take_snapshot()
+    run_meeting(lib, sink, frames, 30)
+    after = tracemalloc.take_snapshot()
+    tracemalloc.stop()
+    # Only what the callback allocates, not joining and leaving the meeting
+    diff = [d for d in after.compare_to(before, "traceback") if d.size_diff > 0 and
+            any(f.filename == code.co_filename and f.lineno in lines for f in d.traceback)]
+    blocks = sum(d.count_diff for d in diff)
+    size = sum(d.size_diff for d in diff)
+    delivered = sink.frames.qsize() + sink.dropped
+    while not sink.frames.empty():
+        sink.frames.get_nowait()
+    sink.dropped = 0
+    return blocks / delivered, size / delivered
+
+
+def main():
+    frames = int(sys.argv[1]) if len(sys.argv) > 1 else 200000
+    participants = int(sys.argv[2]) if len(sys.argv) > 2 else 0
+    paced = int(sys.argv[3]) if len(sys.argv) > 3 else 0
+    if frames <= 0 or participants < 0:
+        print(f"usage: {sys.argv[0]} [frames=200000] [participants=0] [paced=0]", file=sys.stderr)
+        return 2
+
+    # Fast joins and no share; the stand-in SDK delivers the audio
+    for name, value in (("AUTH_MS", "0"), ("JOIN_MS", "0"), ("AUDIO_JOIN_MS", "0"), ("SHARE_FPS", "0")):
+        os.environ.setdefault("ZOOM_FAKE_SDK_" + name, value)
+    os.environ["ZOOM_FAKE_SDK_PARTICIPANTS"] = str(participants)
+    os.environ["ZOOM_FAKE_SDK_UNPACED"] = "0" if paced else "1"
+
+    # The C API reports every callback change on stdout; keep the row readable
+    report = os.fdopen(os.dup(sys.stdout.fileno()), "w")
+    sys.stdout.flush()
+    devnull = os.open(os.devnull, os.O_WRONLY)
+    os.dup2(devnull, sys.stdout.fileno())
+
+    lib = load_sdk()
+    sink = Sink()
+    try:
+        allocs, size = measure_allocations(lib, sink)
+
+        consumer = threading.Thread(target=sink.consume, name="consumer")
+        consumer.start()
+        collections = sum(s["collections"] for s in gc.get_stats())
+        stats = run_meeting(lib, sink, frames, 60 + frames * (participants + 1) // (100 if paced else 1000))
+        collections = sum(s["collections"] for s in gc.get_stats()) - collections
+        sink.frames.put(None)
+        consumer.join()
+    except RuntimeError as e:
+        print(e, file=sys.stderr)
+        return 1
+
+    count, elapsed = stats["frames"], max(stats["elapsed_ns"], 1)
+    report.write("%-8s %9s %9s %8s %8s %9s %10s %12s %11s %5s %8s %6s\n" % (
+        "binding", "frames", "ns/frame", "p50(ns)", "p99(ns)", "max(ns)", "frames/s", "allocs/frame",
+        "bytes/frame", "gc", "dropped", "late"))
+    report.write("%-8s %9d %9.1f %8d %8d %9d %10.0f %12.2f %11.1f %5d %8d %6d\n" % (
+        "python", count, elapsed / count, stats["p50_ns"], stats["p99_ns"], stats["max_ns"], count * 1e9 / elapsed,
+        allocs, size, collections, sink.dropped, stats["late"]))
+    report.flush()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
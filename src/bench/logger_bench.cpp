@@ -0,0 +1,131 @@
+// Throughput and caller latency of Util::Logger, synchronous vs async mode
+//
+// usage: logger_bench [messages_per_thread] [log_file]
+//
+// Every configuration logs to a file with console output off, which is how the
+// bot runs under the Go server. "calls/s" is what the logging threads see;
+// "written/s" counts records that reached the file, including the time to
+// drain the async ring; records dropped on overflow are reported separately.
+
+#include "util/Logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+    double callsPerSec;
+    double writtenPerSec;
+    uint64_t p50Ns;
+    uint64_t p99Ns;
+    uint64_t maxNs;
+    uint64_t dropped;
+};
+
+static Result run(bool async, int threads, int messagesPerThread, size_t ringCapacity) {
+    auto& logger = Util::Logger::getInstance();
+    uint64_t droppedBefore = logger.droppedMessages();
+    if (async) {
+        logger.enableAsync(ringCapacity);
+    }
+
+    std::vector<std::vector<uint64_t>> latencies(threads);
+    std::vector<std::thread> workers;
+
+    auto start = Clock::now();
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t]() {
+            auto& samples = latencies[t];
+            samples.reserve(messagesPerThread);
+            for (int i = 0; i < messagesPerThread; i++) {
+                auto before = Clock::now();
+                logger.info("Share started from user " + std::to_string(t) + " frame " + std::to_string(i));
+                samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - before).count());
+            }
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    auto produced = Clock::now();
+
+    if (async) {
+        logger.disableAsync();
+    }
+    auto written = Clock::now();
+
+    std::vector<uint64_t> all;
+    for (auto& samples : latencies) {
+        all.insert(all.end(), samples.begin(), samples.end());
+    }
+    std::sort(all.begin(), all.end());
+
+    double total = static_cast<double>(threads) * messagesPerThread;
+    Result r;
+    r.callsPerSec = total / std::chrono::duration<double>(produced - start).count();
+    r.dropped = logger.droppedMessages() - droppedBefore;
+    r.writtenPerSec = (total - r.dropped) / std::chrono::duration<double>(written - start).count();
+    r.p50Ns = all[all.size() / 2];
+    r.p99Ns = all[all.size() * 99 / 100];
+    r.maxNs = all.back();
+    return r;
+}
+
+// Cost of a disabled DEBUG site: eager string building vs the lazy macro
+static void runDisabled(int iterations) {
+    auto& logger = Util::Logger::getInstance();
+    logger.setLogLevel(Util::LogLevel::INFO);
+
+    auto start = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        logger.debug("Audio frame " + std::to_string(i) + " from node " + std::to_string(i & 7));
+    }
+    auto eager = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        ZLOG_DEBUG("Audio frame {} from node {}", i, i & 7);
+    }
+    auto lazy = Clock::now();
+
+    std::printf("\ndisabled DEBUG site: eager %.1f ns/call, ZLOG_DEBUG %.1f ns/call\n",
+                std::chrono::duration<double, std::nano>(eager - start).count() / iterations,
+                std::chrono::duration<double, std::nano>(lazy - eager).count() / iterations);
+}
+
+int main(int argc, char** argv) {
+    int messagesPerThread = argc > 1 ? std::atoi(argv[1]) : 100000;
+    std::string logFile = argc > 2 ? argv[2] : "/tmp/logger_bench.log";
+
+    auto& logger = Util::Logger::getInstance();
+    logger.enableConsoleOutput(false);
+    logger.setLogFile(logFile);
+    logger.enableFileOutput(true);
+
+    std::printf("%-6s %7s %10s %12s %12s %9s %9s %10s %9s\n",
+                "mode", "threads", "ring", "calls/s", "written/s", "p50(ns)", "p99(ns)", "max(ns)", "dropped");
+
+    for (int threads : {1, 4, 8}) {
+        Result sync = run(false, threads, messagesPerThread, 0);
+        std::printf("%-6s %7d %10s %12.0f %12.0f %9llu %9llu %10llu %9llu\n", "sync", threads, "-",
+                    sync.callsPerSec, sync.writtenPerSec,
+                    (unsigned long long)sync.p50Ns, (unsigned long long)sync.p99Ns,
+                    (unsigned long long)sync.maxNs, (unsigned long long)sync.dropped);
+
+        // The ring keeps its first capacity, so size it for the largest run up front
+        Result async = run(true, threads, messagesPerThread, 1 << 16);
+        std::printf("%-6s %7d %10d %12.0f %12.0f %9llu %9llu %10llu %9llu\n", "async", threads, 1 << 16,
+                    async.callsPerSec, async.writtenPerSec,
+                    (unsigned long long)async.p50Ns, (unsigned long long)async.p99Ns,
+                    (unsigned long long)async.maxNs, (unsigned long long)async.dropped);
+    }
+
+    runDisabled(messagesPerThread * 10);
+
+    std::remove(logFile.c_str());
+    return 0;
+}
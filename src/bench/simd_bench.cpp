@@ -0,0 +1,79 @@
+// Check and time every tier of the runtime-dispatched SIMD kernels
+//
+// usage: simd_bench [iterations=200000]
+//
+// Forces each tier from scalar up to the best one this machine supports with
+// Util::forceCpuTier(), so every implementation runs on one host. Each kernel
+// is first checked against its scalar version on random and extreme input
+// (full-scale samples, -32768, silence) for every length up to 130 samples and
+// every alignment, then timed on 10 ms of 32 kHz audio. Exits with 1 if any
+// tier disagrees with scalar. The tier used in production is printed first;
+// ZOOM_SDK_CPU_TIER caps it.
+
+#include "util/AudioKernels.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr size_t kFrameSamples = 320;  // 10 ms of 32 kHz mono
+
+static bool checkPcmLevel(const std::vector<int16_t>& input) {
+    auto scalar = Util::pcmLevel.implementation(Util::CpuTier::SCALAR);
+    for (size_t offset = 0; offset < 4; offset++) {
+        for (size_t count = 0; count + offset <= 130 && count + offset <= input.size(); count++) {
+            Util::PcmLevel expected = scalar(input.data() + offset, count);
+            Util::PcmLevel actual = Util::pcmLevel(input.data() + offset, count);
+            if (actual.peak != expected.peak || actual.sumSquares != expected.sumSquares) {
+                std::fprintf(stderr, "pcm_level mismatch at %s, offset %zu, count %zu: peak %u/%u, energy %llu/%llu\n",
+                             Util::cpuTierName(Util::pcmLevel.boundTier()), offset, count, actual.peak, expected.peak,
+                             (unsigned long long)actual.sumSquares, (unsigned long long)expected.sumSquares);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 200000;
+
+    std::printf("detected %s, active %s\n", Util::cpuTierName(Util::detectedCpuTier()),
+                Util::cpuTierName(Util::activeCpuTier()));
+
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> sample(-32768, 32767);
+    std::vector<std::vector<int16_t>> inputs(4, std::vector<int16_t>(kFrameSamples));
+    for (auto& s : inputs[0]) s = static_cast<int16_t>(sample(rng));
+    for (auto& s : inputs[1]) s = -32768;
+    for (size_t i = 0; i < kFrameSamples; i++) inputs[2][i] = i % 2 ? 32767 : -32768;
+    // inputs[3] is silence
+
+    std::printf("%-10s %-8s %-8s %10s %12s %6s\n", "kernel", "forced", "bound", "ns/frame", "Msamples/s", "check");
+    bool ok = true;
+    for (int t = 0; t <= static_cast<int>(Util::detectedCpuTier()); t++) {
+        Util::forceCpuTier(static_cast<Util::CpuTier>(t));
+
+        bool matches = true;
+        for (const auto& input : inputs) {
+            matches = matches && checkPcmLevel(input);
+        }
+        ok = ok && matches;
+
+        uint64_t sink = 0;
+        auto start = Clock::now();
+        for (int i = 0; i < iterations; i++) {
+            sink += Util::pcmLevel(inputs[0].data(), kFrameSamples).sumSquares;
+        }
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / iterations;
+        std::printf("%-10s %-8s %-8s %10.1f %12.0f %6s\n", Util::pcmLevel.name(),
+                    Util::cpuTierName(static_cast<Util::CpuTier>(t)), Util::cpuTierName(Util::pcmLevel.boundTier()),
+                    ns, kFrameSamples * 1e3 / ns, matches ? "ok" : "FAIL");
+        if (sink == 1) std::printf("\n");  // keep the loop
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,223 @@
+// Slab pool vs malloc for media frame buffers under a synthetic multi-meeting load
+//
+// usage: slab_bench [meetings=8] [seconds=10] [participants=4]
+//
+// Each meeting has a producer thread standing in for its SDK delivery thread
+// and a consumer thread standing in for a media worker. For every simulated
+// 10 ms the producer allocates a 640-byte audio chunk (32 kHz mono) per
+// participant, and every 40 ms a 1280x720 I420 frame (25 fps). It writes one
+// byte per 4 KiB page, as a copy would touch them, then queues the buffer.
+// The consumer frees each buffer once 8 newer ones of its meeting are held,
+// so buffers are allocated and freed on different threads, as in worker pool
+// delivery. Runs are unpaced; seconds is simulated meeting time. A producer
+// more than 64 buffers ahead waits, like a bounded per-stream queue, so
+// memory reflects the working set rather than an ever-growing backlog.
+//
+// Every allocator runs in its own forked process, so the minor page faults
+// and peak RSS reported are its own. "slab+hugetlb" needs reserved huge pages
+// (vm.nr_hugepages) and falls back to THP otherwise; the last column shows
+// how many slabs came from hugetlbfs.
+
+#include "util/SlabAllocator.h"
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr size_t kAudioBytes = 640;
+static constexpr size_t kVideoBytes = 1280 * 720 * 3 / 2;
+static constexpr size_t kHeld = 8;
+static constexpr size_t kMaxQueued = 64;
+
+enum class Mode { MALLOC, SLAB, SLAB_THP, SLAB_HUGETLB };
+
+struct Buffer {
+    char* data;
+    size_t bytes;
+};
+
+struct Meeting {
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::condition_variable drained;
+    std::deque<Buffer> queue;
+    bool done = false;
+    std::vector<uint32_t> allocNs;
+    std::vector<uint32_t> freeNs;
+};
+
+static uint32_t elapsedNs(Clock::time_point start) {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    return static_cast<uint32_t>(std::min<int64_t>(ns, UINT32_MAX));
+}
+
+static char* allocate(Mode mode, size_t bytes) {
+    if (mode == Mode::MALLOC) return static_cast<char*>(std::malloc(bytes));
+    return static_cast<char*>(Util::SlabAllocator::getInstance().allocate(bytes));
+}
+
+static void release(Mode mode, const Buffer& buffer) {
+    if (mode == Mode::MALLOC) {
+        std::free(buffer.data);
+    } else {
+        Util::SlabAllocator::getInstance().deallocate(buffer.data, buffer.bytes);
+    }
+}
+
+static void produce(Mode mode, Meeting& meeting, int ticks, int participants) {
+    for (int tick = 0; tick < ticks; tick++) {
+        int buffers = participants + (tick % 4 == 0 ? 1 : 0);
+        for (int i = 0; i < buffers; i++) {
+            size_t bytes = i < participants ? kAudioBytes : kVideoBytes;
+            auto start = Clock::now();
+            char* data = allocate(mode, bytes);
+            meeting.allocNs.push_back(elapsedNs(start));
+            for (size_t offset = 0; offset < bytes; offset += 4096) {
+                data[offset] = static_cast<char>(tick);
+            }
+            std::unique_lock<std::mutex> lock(meeting.mutex);
+            meeting.drained.wait(lock, [&]() { return meeting.queue.size() < kMaxQueued; });
+            meeting.queue.push_back({data, bytes});
+            meeting.ready.notify_one();
+        }
+    }
+    std::lock_guard<std::mutex> lock(meeting.mutex);
+    meeting.done = true;
+    meeting.ready.notify_one();
+}
+
+static void consume(Mode mode, Meeting& meeting) {
+    std::deque<Buffer> held;
+    auto timedRelease = [&](const Buffer& buffer) {
+        auto start = Clock::now();
+        release(mode, buffer);
+        meeting.freeNs.push_back(elapsedNs(start));
+    };
+    for (;;) {
+        std::deque<Buffer> batch;
+        {
+            std::unique_lock<std::mutex> lock(meeting.mutex);
+            meeting.ready.wait(lock, [&]() { return !meeting.queue.empty() || meeting.done; });
+            if (meeting.queue.empty()) break;
+            batch.swap(meeting.queue);
+        }
+        meeting.drained.notify_one();
+        for (const auto& buffer : batch) {
+            held.push_back(buffer);
+            if (held.size() > kHeld) {
+                timedRelease(held.front());
+                held.pop_front();
+            }
+        }
+    }
+    for (const auto& buffer : held) {
+        timedRelease(buffer);
+    }
+}
+
+static uint32_t percentile(std::vector<uint32_t>& values, double p) {
+    if (values.empty()) return 0;
+    size_t index = std::min(values.size() - 1, static_cast<size_t>(values.size() * p));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+static void run(Mode mode, const char* name, int meetings, int seconds, int participants) {
+    auto& slab = Util::SlabAllocator::getInstance();
+    if (mode == Mode::SLAB_THP) slab.setBacking(Util::SlabAllocator::Backing::TRANSPARENT_HUGE_PAGES);
+    if (mode == Mode::SLAB_HUGETLB) slab.setBacking(Util::SlabAllocator::Backing::HUGETLB);
+
+    int ticks = seconds * 100;
+    std::vector<Meeting> state(meetings);
+    for (auto& meeting : state) {
+        meeting.allocNs.reserve(static_cast<size_t>(ticks) * (participants + 1));
+        meeting.freeNs.reserve(static_cast<size_t>(ticks) * (participants + 1));
+    }
+
+    rusage before;
+    getrusage(RUSAGE_SELF, &before);
+    auto start = Clock::now();
+    std::vector<std::thread> threads;
+    for (auto& meeting : state) {
+        threads.emplace_back(consume, mode, std::ref(meeting));
+        threads.emplace_back(produce, mode, std::ref(meeting), ticks, participants);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double wallMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    rusage after;
+    getrusage(RUSAGE_SELF, &after);
+
+    std::vector<uint32_t> allocNs;
+    std::vector<uint32_t> freeNs;
+    for (auto& meeting : state) {
+        allocNs.insert(allocNs.end(), meeting.allocNs.begin(), meeting.allocNs.end());
+        freeNs.insert(freeNs.end(), meeting.freeNs.begin(), meeting.freeNs.end());
+    }
+
+    uint64_t hugeTlbSlabs = 0;
+    uint64_t outstanding = 0;
+    for (const auto& s : slab.stats()) {
+        hugeTlbSlabs += s.hugeTlbSlabs;
+        outstanding += s.outstanding;
+    }
+    if (outstanding != 0) {
+        std::fprintf(stderr, "%s: %llu buffers not freed\n", name, static_cast<unsigned long long>(outstanding));
+    }
+
+    uint32_t allocMax = allocNs.empty() ? 0 : *std::max_element(allocNs.begin(), allocNs.end());
+    std::printf("%-13s %8zu %9.0f %9u %9u %9u %9u %9u %10ld %9.1f %7llu\n", name, allocNs.size(), wallMs,
+                percentile(allocNs, 0.5), percentile(allocNs, 0.99), allocMax, percentile(freeNs, 0.5),
+                percentile(freeNs, 0.99), after.ru_minflt - before.ru_minflt, after.ru_maxrss / 1024.0,
+                static_cast<unsigned long long>(hugeTlbSlabs));
+}
+
+int main(int argc, char** argv) {
+    int meetings = argc > 1 ? std::atoi(argv[1]) : 8;
+    int seconds = argc > 2 ? std::atoi(argv[2]) : 10;
+    int participants = argc > 3 ? std::atoi(argv[3]) : 4;
+    if (meetings <= 0 || seconds <= 0 || participants < 0) {
+        std::fprintf(stderr, "usage: slab_bench [meetings=8] [seconds=10] [participants=4]\n");
+        return 1;
+    }
+
+    std::printf("%d meetings x %d s, %d audio streams + 720p25 video each, %zu buffers held per meeting\n",
+                meetings, seconds, participants, kHeld);
+    std::printf("%-13s %8s %9s %9s %9s %9s %9s %9s %10s %9s %7s\n", "allocator", "buffers", "wall_ms",
+                "alloc_p50", "alloc_p99", "alloc_max", "free_p50", "free_p99", "minflt", "rss_mb", "hugetlb");
+    std::fflush(stdout);
+
+    const struct {
+        Mode mode;
+        const char* name;
+    } modes[] = {
+        {Mode::MALLOC, "malloc"},
+        {Mode::SLAB, "slab"},
+        {Mode::SLAB_THP, "slab+thp"},
+        {Mode::SLAB_HUGETLB, "slab+hugetlb"},
+    };
+    for (const auto& m : modes) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            run(m.mode, m.name, meetings, seconds, participants);
+            std::fflush(stdout);
+            _exit(0);
+        }
+        int status = 0;
+        waitpid(pid, &status, 0);
+    }
+    return 0;
+}
@@ -129,7 +129,7 @@ int main(int argc, char *argv[]) {
     printf("-------------------------------------------\n");
 
     // Run event loop
-    zoom_sdk_run_loop();
+    zoom_sdk_run_loop(sdk);
 
     // Cleanup
     printf("\n-------------------------------------------\n");
@@ -1,20 +1,33 @@
 #include "zoom_sdk_audio_delegate.h"
+#include "util/Metrics.h"
+#include "util/Probes.h"
 
 void ZoomSDKAudioRawDataDelegate::onMixedAudioRawDataReceived(AudioRawData* data) {
     if (!data) return;
+    uint64_t ingress = Util::monotonicNs();
+    m_timeline->mark(MeetingTimeline::FIRST_AUDIO, ingress);
+    m_dispatchThread->bindCurrentThread();
     char* buffer = data->GetBuffer();
     unsigned int length = data->GetBufferLen();
+    ZPROBE(audio_frame, m_meetingHandle, static_cast<int>(ZOOM_AUDIO_TYPE_MIXED), 0u, length, ingress);
     if (buffer && length > 0) {
-        zoom_meeting_dispatch_audio(m_meetingHandle, buffer, static_cast<int>(length), ZOOM_AUDIO_TYPE_MIXED, 0);
+        if (m_capture->isActive()) m_capture->record(Util::MediaRecord::AUDIO_MIXED, 0, ingress, buffer, length);
+        zoom_meeting_dispatch_audio(m_meetingHandle, buffer, static_cast<int>(length), ZOOM_AUDIO_TYPE_MIXED, 0, ingress);
     }
 }
 
 void ZoomSDKAudioRawDataDelegate::onOneWayAudioRawDataReceived(AudioRawData* data, uint32_t user_id) {
     if (!data) return;
+    uint64_t ingress = Util::monotonicNs();
+    m_timeline->mark(MeetingTimeline::FIRST_AUDIO, ingress);
+    m_dispatchThread->bindCurrentThread();
     char* buffer = data->GetBuffer();
     unsigned int length = data->GetBufferLen();
+    ZPROBE(audio_frame, m_meetingHandle, static_cast<int>(ZOOM_AUDIO_TYPE_ONE_WAY), user_id, length, ingress);
     if (buffer && length > 0) {
-        zoom_meeting_dispatch_audio(m_meetingHandle, buffer, static_cast<int>(length), ZOOM_AUDIO_TYPE_ONE_WAY, user_id);
+        if (m_capture->isActive()) m_capture->record(Util::MediaRecord::AUDIO_ONE_WAY, user_id, ingress, buffer, length);
+        zoom_meeting_dispatch_audio(m_meetingHandle, buffer, static_cast<int>(length), ZOOM_AUDIO_TYPE_ONE_WAY, user_id,
+                                    ingress);
     }
 }
 
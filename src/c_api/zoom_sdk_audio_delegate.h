@@ -2,16 +2,24 @@
 #ifndef ZOOM_SDK_AUDIO_DELEGATE_H
 #define ZOOM_SDK_AUDIO_DELEGATE_H
 
+#include <cstdint>
 #include <iostream>
 #include "zoom_sdk_raw_data_def.h"
 #include "rawdata/rawdata_audio_helper_interface.h"
 #include "zoom_sdk_c.h"
+#include "MeetingTimeline.h"
+#include "util/MediaCapture.h"
+#include "util/ThreadOptions.h"
 
 
 class ZoomSDKAudioRawDataDelegate : public ZOOMSDK::IZoomSDKAudioRawDataDelegate {
 public:
-    explicit ZoomSDKAudioRawDataDelegate(MeetingHandle meetingHandle)
-        : m_meetingHandle(meetingHandle) {}
+    ZoomSDKAudioRawDataDelegate(MeetingHandle meetingHandle, Util::ThreadBinding* dispatchThread,
+                                MeetingTimeline* timeline, Util::MediaCaptureWriter* capture)
+        : m_meetingHandle(meetingHandle)
+        , m_dispatchThread(dispatchThread)
+        , m_timeline(timeline)
+        , m_capture(capture) {}
 
     void onMixedAudioRawDataReceived(AudioRawData* data) override;
     void onOneWayAudioRawDataReceived(AudioRawData* data, uint32_t user_id) override;
@@ -20,6 +28,9 @@ public:
 
 private:
     MeetingHandle m_meetingHandle;
+    Util::ThreadBinding* m_dispatchThread;
+    MeetingTimeline* m_timeline;
+    Util::MediaCaptureWriter* m_capture;
 };
 
 #endif // ZOOM_SDK_AUDIO_DELEGATE_H
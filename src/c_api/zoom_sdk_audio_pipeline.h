@@ -0,0 +1,127 @@
+
+#ifndef ZOOM_SDK_AUDIO_PIPELINE_H
+#define ZOOM_SDK_AUDIO_PIPELINE_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <variant>
+#include "zoom_sdk_c.h"
+#include "util/AudioPipeline.h"
+
+// Configurations behind the ZoomAudioPipeline presets
+using VadAudioPipeline = Util::AudioPipeline<Util::NoStage, Util::NoStage, Util::EnergyVad<>, Util::ForwardSink>;
+using DcBlockAudioPipeline = Util::AudioPipeline<Util::DcBlocker, Util::NoStage, Util::NoStage, Util::ForwardSink>;
+using SpeechAudioPipeline =
+    Util::AudioPipeline<Util::DcBlocker, Util::Downsample2, Util::EnergyVad<>, Util::ForwardSink>;
+
+// One of the preset configurations; the preset is picked once per frame by std::visit
+using AnyAudioPipeline = std::variant<VadAudioPipeline, DcBlockAudioPipeline, SpeechAudioPipeline>;
+
+// Audio pipelines of one meeting, one instance per stream
+class MeetingAudioPipelines {
+public:
+    // A stream this long without frames, normally a participant who left, gives up its pipeline
+    static constexpr uint64_t kIdleNs = 30'000'000'000;
+
+    explicit MeetingAudioPipelines(ZoomAudioPipeline preset)
+        : m_preset(preset), m_streams(std::make_shared<const StreamMap>()) {}
+
+    ZoomAudioPipeline preset() const { return m_preset; }
+
+    /**
+     * Pipeline of a stream, created with its first frame. Only creating it or
+     * evicting idle streams takes the lock; the result stays valid if the
+     * stream is evicted while the frame is in flight
+     * @param nowNs CLOCK_MONOTONIC time of the frame
+     */
+    std::shared_ptr<AnyAudioPipeline> stream(uint64_t key, uint64_t nowNs) {
+        if (nowNs >= m_nextSweepNs.load(std::memory_order_relaxed)) {
+            sweep(nowNs);
+        }
+        auto streams = m_streams.load(std::memory_order_acquire);
+        auto it = streams->find(key);
+        if (it == streams->end()) {
+            return add(key, nowNs);
+        }
+        Stream& found = *it->second;
+        found.lastNs.store(nowNs, std::memory_order_relaxed);
+        return std::shared_ptr<AnyAudioPipeline>(std::move(streams), &found.pipeline);
+    }
+
+private:
+    struct Stream {
+        Stream(ZoomAudioPipeline preset, uint64_t nowNs) : pipeline(create(preset)), lastNs(nowNs) {}
+
+        AnyAudioPipeline pipeline;
+        std::atomic<uint64_t> lastNs;
+    };
+    // Replaced, never changed, so frames find their stream without the lock
+    using StreamMap = std::unordered_map<uint64_t, std::shared_ptr<Stream>>;
+
+    static AnyAudioPipeline create(ZoomAudioPipeline preset) {
+        switch (preset) {
+            case ZOOM_AUDIO_PIPELINE_DC_BLOCK:
+                return AnyAudioPipeline(std::in_place_type<DcBlockAudioPipeline>);
+            case ZOOM_AUDIO_PIPELINE_SPEECH:
+                return AnyAudioPipeline(std::in_place_type<SpeechAudioPipeline>);
+            default:
+                return AnyAudioPipeline(std::in_place_type<VadAudioPipeline>);
+        }
+    }
+
+    std::shared_ptr<AnyAudioPipeline> add(uint64_t key, uint64_t nowNs) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto current = m_streams.load(std::memory_order_relaxed);
+        auto next = std::make_shared<StreamMap>(*current);
+        auto& stream = (*next)[key];
+        if (!stream) {
+            stream = std::make_shared<Stream>(m_preset, nowNs);
+        }
+        std::shared_ptr<AnyAudioPipeline> pipeline(stream, &stream->pipeline);
+        m_streams.store(std::move(next), std::memory_order_release);
+        return pipeline;
+    }
+
+    // Drops the streams idle for kIdleNs, at most once per kIdleNs
+    void sweep(uint64_t nowNs) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (nowNs < m_nextSweepNs.load(std::memory_order_relaxed)) {
+            return;
+        }
+        m_nextSweepNs.store(nowNs + kIdleNs, std::memory_order_relaxed);
+
+        auto current = m_streams.load(std::memory_order_relaxed);
+        auto next = std::make_shared<StreamMap>();
+        for (const auto& [key, stream] : *current) {
+            if (stream->lastNs.load(std::memory_order_relaxed) + kIdleNs > nowNs) {
+                next->emplace(key, stream);
+            }
+        }
+        if (next->size() != current->size()) {
+            m_streams.store(std::move(next), std::memory_order_release);
+        }
+    }
+
+    const ZoomAudioPipeline m_preset;
+    std::mutex m_mutex;  // Serializes replacing the map
+    std::atomic<std::shared_ptr<const StreamMap>> m_streams;
+    std::atomic<uint64_t> m_nextSweepNs{0};
+};
+
+/**
+ * Run a frame through a pipeline; deliver(const Util::AudioBlock&) gets the result
+ * Frames of one stream must not be processed concurrently, which both delivery
+ * paths guarantee: the SDK thread is serial and the worker pool orders each stream
+ * @return false if a stage dropped the frame
+ */
+template<class Deliver>
+bool process_audio_pipeline(AnyAudioPipeline& pipeline, const void* data, int length, Deliver&& deliver) {
+    auto* samples = static_cast<const int16_t*>(data);
+    size_t count = static_cast<size_t>(length) / sizeof(int16_t);
+    return std::visit([&](auto& p) { return p.process(samples, count, deliver); }, pipeline);
+}
+
+#endif // ZOOM_SDK_AUDIO_PIPELINE_H
@@ -1,34 +1,267 @@
 #include "zoom_sdk_c.h"
 #include "zoom_sdk_audio_delegate.h"
+#include "zoom_sdk_audio_pipeline.h"
+#include "zoom_sdk_plugin_host.h"
 #include "zoom_sdk_video_delegate.h"
 
 #include "ZoomSDK.h"
 #include "SDKConfig.h"
 #include "Meeting.h"
 #include "MeetingConfig.h"
+#include "util/CpuDispatch.h"
+#include "util/FlightRecorder.h"
+#include "util/MediaCapture.h"
 #include "util/Logger.h"
+#include "util/MemoryAccounting.h"
+#include "util/Metrics.h"
+#include "util/PathTemplate.h"
+#include "util/Probes.h"
+#include "util/SlabAllocator.h"
+#include "util/ThreadOptions.h"
+#include "util/Trace.h"
+#include "util/WorkStealingPool.h"
 
+#include <algorithm>
 #include <iostream>
 #include <mutex>
 #include <thread>
 #include <chrono>
+#include <cmath>
 #include <atomic>
 #include <glib.h>
 #include <memory>
 #include <condition_variable>
+#include <cstring>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace SDK = ZOOMSDK;
 
+// Per-handle state: every SDK instance owns its GLib context and loop,
+// so running, stopping or destroying one never touches another
+struct SDKInstance {
+    ZoomSDK sdk;
+    GMainContext* context;
+    GMainLoop* loop;
+
+    // State of an externally driven iteration (zoom_sdk_get_poll_fds / zoom_sdk_dispatch_pending)
+    gint pollMaxPriority = 0;
+    bool pollPrepared = false;
+
+    SDKInstance()
+        : context(g_main_context_new())
+        , loop(g_main_loop_new(context, FALSE)) {}
+
+    ~SDKInstance() {
+        g_main_loop_unref(loop);
+        g_main_context_unref(context);
+    }
+};
+
+// Pushes a context as thread-default for the current scope, so SDK sources
+// created by calls made in that scope attach to the owning instance
+class ScopedThreadDefaultContext {
+    GMainContext* m_context;
+
+public:
+    explicit ScopedThreadDefaultContext(GMainContext* context) : m_context(context) {
+        g_main_context_push_thread_default(m_context);
+    }
+    ~ScopedThreadDefaultContext() {
+        g_main_context_pop_thread_default(m_context);
+    }
+
+    ScopedThreadDefaultContext(const ScopedThreadDefaultContext&) = delete;
+    ScopedThreadDefaultContext& operator=(const ScopedThreadDefaultContext&) = delete;
+};
+
+// Times the consumer callbacks of one meeting. With inline delivery a slow callback
+// stalls the SDK delivery thread, so repeated overruns may switch the meeting to
+// another delivery mode
+struct ConsumerWatchdog {
+    static constexpr uint64_t kDefaultBudgetNs = 5'000'000;
+    static constexpr uint32_t kDefaultStrikes = 3;
+    static constexpr uint64_t kWarnIntervalNs = 10'000'000'000;
+
+    explicit ConsumerWatchdog(MeetingHandle handle) : meeting(handle) {}
+
+    const MeetingHandle meeting;
+
+    // Policy, see zoom_meeting_set_slow_consumer_policy()
+    std::atomic<uint64_t> budgetNs{kDefaultBudgetNs};
+    std::atomic<uint32_t> strikeLimit{kDefaultStrikes};
+    std::atomic<int> action{ZOOM_SLOW_CONSUMER_WARN};
+
+    std::atomic<uint32_t> strikes{0};
+    std::atomic<uint64_t> callbacks{0};
+    std::atomic<uint64_t> overruns{0};
+    std::atomic<uint64_t> maxNs{0};
+    std::atomic<uint64_t> shedFrames{0};
+    std::atomic<uint64_t> shedUntilNs{0};
+
+    // Warning rate limit
+    std::atomic<uint64_t> lastWarnNs{0};
+    std::atomic<uint64_t> unreportedOverruns{0};
+    Util::RecordThrottle overrunRecords;
+};
+
+// Everything needed to deliver a meeting's frames, found with one lookup per frame.
+// Shared with queued frames, which can outlive the handle
+struct MeetingDeliveryState {
+    MeetingDeliveryState(MeetingHandle handle, std::shared_ptr<Util::MemoryAccount> memory)
+        : watchdog(handle), frameMemory(std::move(memory)) {}
+
+    // Cleared when the meeting is destroyed, so queued frames are not delivered
+    std::atomic<OnAudioDataReceivedCallback> audioCallback{nullptr};
+    std::atomic<OnVideoDataReceivedCallback> videoCallback{nullptr};
+    std::atomic<ZoomDeliveryMode> mode{ZOOM_DELIVERY_INLINE};
+    ConsumerWatchdog watchdog;
+    const std::shared_ptr<Util::MemoryAccount> frameMemory;  // Charged for worker pool frame copies
+    // Null without a pipeline; frames in flight keep the one they started on
+    std::atomic<std::shared_ptr<MeetingAudioPipelines>> audioPipelines;
+};
+
 // Global state management
 static std::unordered_set<ZoomSDKHandle> g_sdk_instances;
 static std::unordered_set<MeetingHandle> g_meeting_instances;
-static std::unordered_map<MeetingHandle, OnAudioDataReceivedCallback> g_audio_callbacks;
-static std::unordered_map<MeetingHandle, OnVideoDataReceivedCallback> g_video_callbacks;
-static GMainLoop* g_main_loop = nullptr;
+static std::unordered_map<MeetingHandle, std::shared_ptr<MeetingDeliveryState>> g_delivery_states;
 static std::mutex g_instance_mutex;
 
+// Media worker pool, created on first use by a meeting in ZOOM_DELIVERY_WORKER_POOL mode
+static std::unique_ptr<Util::WorkStealingPool> g_media_pool;
+static Util::WorkStealingPool::Options g_media_pool_options;
+static std::mutex g_media_pool_mutex;
+
+// SDK threads delivering raw data; the SDK shares them between meetings, so one binding covers all
+static Util::ThreadBinding g_dispatch_thread;
+
+// Log writer thread options, used when async logging is enabled
+static Util::ThreadOptions g_log_writer_options;
+
+// Stream keys within a meeting's group: audio by type and node, video by source
+static constexpr uint64_t kVideoStreamTag = 1ULL << 40;
+
+static_assert(sizeof(ZoomSDKPollFD) == sizeof(GPollFD), "ZoomSDKPollFD must match GPollFD");
+
+enum FrameKind { FRAME_AUDIO_MIXED, FRAME_AUDIO_ONE_WAY, FRAME_AUDIO_SHARE, FRAME_VIDEO, FRAME_KIND_COUNT };
+
+// Per frame type metrics, registered once and updated lock-free from the delivery threads
+struct FrameMetrics {
+    FrameKind kind;
+    const char* type;
+    Util::Counter& framesIn;
+    Util::Counter& bytesIn;
+    Util::Counter& framesOut;
+    Util::Histogram& dispatchLatency;
+    Util::Histogram& callbackDuration;
+    Util::Counter& callbackOverruns;
+};
+
+static FrameMetrics make_frame_metrics(FrameKind kind, const char* type) {
+    auto& registry = Util::MetricsRegistry::getInstance();
+    std::string labels = std::string("type=\"") + type + "\"";
+    return {
+        kind,
+        type,
+        registry.counter("zoom_frames_in_total", "Raw frames received from the SDK", labels),
+        registry.counter("zoom_frame_bytes_in_total", "Raw frame bytes received from the SDK", labels),
+        registry.counter("zoom_frames_out_total", "Frames delivered to the consumer callback", labels),
+        registry.histogram("zoom_frame_dispatch_seconds", "Time from SDK ingress to the consumer callback", labels, 1e-9),
+        registry.histogram("zoom_callback_duration_seconds", "Time spent in the consumer callback", labels, 1e-9),
+        registry.counter("zoom_callback_overruns_total", "Consumer callbacks over the slow consumer budget", labels),
+    };
+}
+
+static FrameMetrics& frame_metrics(FrameKind kind) {
+    static FrameMetrics metrics[FRAME_KIND_COUNT] = {
+        make_frame_metrics(FRAME_AUDIO_MIXED, "audio_mixed"),
+        make_frame_metrics(FRAME_AUDIO_ONE_WAY, "audio_one_way"),
+        make_frame_metrics(FRAME_AUDIO_SHARE, "audio_share"),
+        make_frame_metrics(FRAME_VIDEO, "video"),
+    };
+    return metrics[kind];
+}
+
+// Ingress time of the frame whose callback is running on this thread, see zoom_frame_ingress_ns()
+static thread_local unsigned long long t_frame_ingress_ns = 0;
+
+static void watch_callback(MeetingDeliveryState& state, FrameMetrics& metrics, uint64_t duration, uint64_t end);
+
+// Brackets one consumer callback: records the delay since ingress and the time
+// spent in the callback, exposes the ingress time to the callback, and reports
+// the duration to the meeting's watchdog
+class FrameDelivery {
+public:
+    FrameDelivery(MeetingHandle meeting, FrameMetrics& metrics, uint64_t ingress_ns, MeetingDeliveryState& state)
+        : m_meeting(meeting), m_metrics(metrics), m_state(state), m_start(Util::monotonicNs()) {
+        ZPROBE(dispatch_start, m_meeting, static_cast<int>(m_metrics.kind), ingress_ns);
+        m_metrics.dispatchLatency.record(m_start > ingress_ns ? m_start - ingress_ns : 0);
+        t_frame_ingress_ns = ingress_ns;
+    }
+    ~FrameDelivery() {
+        t_frame_ingress_ns = 0;
+        uint64_t end = Util::monotonicNs();
+        ZPROBE(dispatch_end, m_meeting, static_cast<int>(m_metrics.kind), end - m_start);
+        m_metrics.callbackDuration.record(end - m_start);
+        m_metrics.framesOut.add();
+        watch_callback(m_state, m_metrics, end - m_start, end);
+    }
+
+    FrameDelivery(const FrameDelivery&) = delete;
+    FrameDelivery& operator=(const FrameDelivery&) = delete;
+
+private:
+    MeetingHandle m_meeting;
+    FrameMetrics& m_metrics;
+    MeetingDeliveryState& m_state;
+    uint64_t m_start;
+};
+
+static FrameKind audio_frame_kind(int type) {
+    return type >= ZOOM_AUDIO_TYPE_MIXED && type <= ZOOM_AUDIO_TYPE_SHARE ? static_cast<FrameKind>(type)
+                                                                          : FRAME_AUDIO_MIXED;
+}
+
+// Frames received but not delivered, for one reason. Instances are static, so
+// the flight recorder can keep a pointer to the event name
+class FrameDrops {
+public:
+    explicit FrameDrops(const char* reason)
+        : m_reason(reason)
+        , m_event(std::string("frame_drop:") + reason)
+        , m_counter(Util::MetricsRegistry::getInstance().counter(
+              "zoom_frames_dropped_total", "Frames received but not delivered",
+              std::string("reason=\"") + reason + "\"")) {}
+
+    void record(MeetingHandle meeting, FrameKind kind) {
+        m_counter.add();
+        ZPROBE(frame_drop, meeting, static_cast<int>(kind), m_reason);
+        if (m_recordThrottle.allow(Util::monotonicNs())) {
+            Util::FlightRecorder::getInstance().record(m_event.c_str(), meeting, kind,
+                                                       static_cast<int64_t>(m_counter.value()));
+        }
+    }
+
+private:
+    const char* m_reason;
+    const std::string m_event;
+    Util::Counter& m_counter;
+    Util::RecordThrottle m_recordThrottle;
+};
+
+static Util::Gauge& sdk_instances_gauge() {
+    static auto& gauge = Util::MetricsRegistry::getInstance().gauge(
+        "zoom_sdk_instances", "SDK instances created and not destroyed");
+    return gauge;
+}
+
+static Util::Gauge& active_meetings_gauge() {
+    static auto& gauge = Util::MetricsRegistry::getInstance().gauge(
+        "zoom_meetings_active", "Meeting handles created and not destroyed");
+    return gauge;
+}
+
 // Helper to remove a handle from multiple maps safely
 template<typename Handle, typename... Maps>
 static void erase_from_maps(Handle handle, Maps&... maps) noexcept {
@@ -38,24 +271,29 @@ static void erase_from_maps(Handle handle, Maps&... maps) noexcept {
 }
 
 // C++ helper functions
-static ZoomSDKHandle create_sdk_handle(ZoomSDK* sdk) noexcept {
-    auto handle = reinterpret_cast<ZoomSDKHandle>(sdk);
+static ZoomSDKHandle create_sdk_handle(SDKInstance* instance) noexcept {
+    auto handle = reinterpret_cast<ZoomSDKHandle>(instance);
     std::lock_guard<std::mutex> lock(g_instance_mutex);
     g_sdk_instances.insert(handle);
+    sdk_instances_gauge().set(static_cast<int64_t>(g_sdk_instances.size()));
     return handle;
 }
 
 static MeetingHandle create_meeting_handle(Meeting* meeting) noexcept {
     auto handle = reinterpret_cast<MeetingHandle>(meeting);
+    auto delivery = std::make_shared<MeetingDeliveryState>(
+        handle, Util::MemoryAccounting::getInstance().meeting("media_frames", handle));
     std::lock_guard<std::mutex> lock(g_instance_mutex);
     g_meeting_instances.insert(handle);
+    g_delivery_states[handle] = std::move(delivery);
+    active_meetings_gauge().set(static_cast<int64_t>(g_meeting_instances.size()));
     return handle;
 }
 
-static ZoomSDK* get_sdk_from_handle(ZoomSDKHandle handle) noexcept {
+static SDKInstance* get_sdk_from_handle(ZoomSDKHandle handle) noexcept {
     if (!handle) return nullptr;
     std::lock_guard<std::mutex> lock(g_instance_mutex);
-    return g_sdk_instances.count(handle) ? reinterpret_cast<ZoomSDK*>(handle) : nullptr;
+    return g_sdk_instances.count(handle) ? reinterpret_cast<SDKInstance*>(handle) : nullptr;
 }
 
 static Meeting* get_meeting_from_handle(MeetingHandle handle) noexcept {
@@ -66,32 +304,199 @@ static Meeting* get_meeting_from_handle(MeetingHandle handle) noexcept {
 
 static void remove_sdk_handle(ZoomSDKHandle handle) noexcept {
     erase_from_maps(handle, g_sdk_instances);
+    std::lock_guard<std::mutex> lock(g_instance_mutex);
+    sdk_instances_gauge().set(static_cast<int64_t>(g_sdk_instances.size()));
 }
 
 static void remove_meeting_handle(MeetingHandle handle) noexcept {
-    erase_from_maps(handle, g_meeting_instances, g_audio_callbacks, g_video_callbacks);
+    erase_from_maps(handle, g_meeting_instances, g_delivery_states);
+    Util::MemoryAccounting::getInstance().removeMeeting(handle);
+    std::lock_guard<std::mutex> lock(g_instance_mutex);
+    active_meetings_gauge().set(static_cast<int64_t>(g_meeting_instances.size()));
+}
+
+static bool to_thread_options(const ZoomThreadOptions* options, Util::ThreadOptions& out) {
+    out = Util::ThreadOptions();
+    if (!options) {
+        return true;
+    }
+    if (options->cpu_count < 0 || options->policy < ZOOM_SCHED_DEFAULT || options->policy > ZOOM_SCHED_RR) {
+        return false;
+    }
+    if (options->policy != ZOOM_SCHED_DEFAULT && (options->priority < 1 || options->priority > 99)) {
+        return false;
+    }
+
+    out.name = options->name ? options->name : "";
+    if (options->cpus) {
+        out.cpus.assign(options->cpus, options->cpus + options->cpu_count);
+    }
+    out.policy = static_cast<Util::SchedPolicy>(options->policy);
+    out.priority = options->priority;
+    return true;
+}
+
+static Util::WorkStealingPool* ensure_media_pool() {
+    std::lock_guard<std::mutex> lock(g_media_pool_mutex);
+    if (!g_media_pool) {
+        if (g_media_pool_options.workerCount == 0) {
+            g_media_pool_options.workerCount = std::min(4u, std::max(1u, std::thread::hardware_concurrency()));
+        }
+        g_media_pool_options.memory = Util::MemoryAccounting::getInstance().subsystem("media_pool");
+        g_media_pool = std::make_unique<Util::WorkStealingPool>(g_media_pool_options);
+        ZLOG_INFO("Started media worker pool with {} workers", g_media_pool->workerCount());
+    }
+    return g_media_pool.get();
+}
+
+// Frame copied for a media worker; from the slab pool, since one is allocated per frame
+using FrameBuffer = std::vector<char, Util::SlabBufferAllocator<char>>;
+
+static std::shared_ptr<MeetingDeliveryState> find_delivery_state(MeetingHandle meeting_handle) {
+    std::lock_guard<std::mutex> lock(g_instance_mutex);
+    auto it = g_delivery_states.find(meeting_handle);
+    return it != g_delivery_states.end() ? it->second : nullptr;
+}
+
+// Applies the watchdog action once a meeting ran out of strikes; only inline
+// delivery is switched, a mode the user chose otherwise is left alone
+static void switch_slow_consumer(MeetingDeliveryState& state, int action) {
+    static auto& switches = Util::MetricsRegistry::getInstance().counter(
+        "zoom_slow_consumer_switches_total", "Meetings moved off inline delivery by the slow consumer watchdog");
+
+    ZoomDeliveryMode target = action == ZOOM_SLOW_CONSUMER_BUFFER ? ZOOM_DELIVERY_WORKER_POOL : ZOOM_DELIVERY_SHED;
+    if (target == ZOOM_DELIVERY_WORKER_POOL) {
+        ensure_media_pool();
+    }
+
+    ZoomDeliveryMode expected = ZOOM_DELIVERY_INLINE;
+    if (!state.mode.compare_exchange_strong(expected, target)) return;
+    switches.add();
+    Util::FlightRecorder::getInstance().record("delivery_mode_switch", state.watchdog.meeting, target);
+    ZLOG_WARN("Meeting {} consumer keeps exceeding its callback budget, switched to {} delivery", state.watchdog.meeting,
+              target == ZOOM_DELIVERY_WORKER_POOL ? "worker pool" : "shedding");
+}
+
+static void watch_callback(MeetingDeliveryState& state, FrameMetrics& metrics, uint64_t duration, uint64_t end) {
+    ConsumerWatchdog& watchdog = state.watchdog;
+    watchdog.callbacks.fetch_add(1, std::memory_order_relaxed);
+    uint64_t max = watchdog.maxNs.load(std::memory_order_relaxed);
+    while (duration > max && !watchdog.maxNs.compare_exchange_weak(max, duration, std::memory_order_relaxed)) {
+    }
+
+    uint64_t budget = watchdog.budgetNs.load(std::memory_order_relaxed);
+    if (duration <= budget) {
+        watchdog.strikes.store(0, std::memory_order_relaxed);
+        return;
+    }
+
+    metrics.callbackOverruns.add();
+    watchdog.overruns.fetch_add(1, std::memory_order_relaxed);
+    if (watchdog.overrunRecords.allow(end)) {
+        Util::FlightRecorder::getInstance().record("slow_callback", watchdog.meeting, metrics.kind,
+                                                   static_cast<int64_t>(duration));
+    }
+    // In shedding mode, frames arriving while the SDK thread catches up are dropped
+    watchdog.shedUntilNs.store(end + duration, std::memory_order_relaxed);
+
+    uint64_t lastWarn = watchdog.lastWarnNs.load(std::memory_order_relaxed);
+    if (end - lastWarn >= ConsumerWatchdog::kWarnIntervalNs &&
+        watchdog.lastWarnNs.compare_exchange_strong(lastWarn, end, std::memory_order_relaxed)) {
+        uint64_t unreported = watchdog.unreportedOverruns.exchange(0, std::memory_order_relaxed);
+        ZLOG_WARN("Slow consumer in meeting {}: {} callback took {} us (budget {} us), {} more overruns since the last warning",
+                  watchdog.meeting, metrics.type, duration / 1000, budget / 1000, unreported);
+    } else {
+        watchdog.unreportedOverruns.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    int action = watchdog.action.load(std::memory_order_relaxed);
+    uint32_t strikes = watchdog.strikes.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (action != ZOOM_SLOW_CONSUMER_WARN && strikes >= watchdog.strikeLimit.load(std::memory_order_relaxed)) {
+        watchdog.strikes.store(0, std::memory_order_relaxed);
+        switch_slow_consumer(state, action);
+    }
 }
 
-static bool authentication_timeout(std::mutex& auth_mutex, bool& auth_success, int timeout) {
-    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(timeout);
-    GMainContext* ctx = g_main_context_default();
+// In shedding mode, drops frames that arrive while the consumer is behind
+static bool shed_frame(MeetingDeliveryState& state, ZoomDeliveryMode mode, FrameKind kind, uint64_t ingress_ns) {
+    if (mode != ZOOM_DELIVERY_SHED || ingress_ns >= state.watchdog.shedUntilNs.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    static FrameDrops slowConsumer("slow_consumer");
+    slowConsumer.record(state.watchdog.meeting, kind);
+    state.watchdog.shedFrames.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+static gboolean on_auth_deadline(gpointer data) {
+    *static_cast<bool*>(data) = true;
+    return G_SOURCE_REMOVE;
+}
+
+static bool authentication_timeout(GMainContext* ctx, std::mutex& auth_mutex, bool& auth_success, int timeout) {
+    // Block in the loop until either auth completes (its callback wakes the context)
+    // or the deadline source fires, instead of polling on a short sleep
+    bool expired = false;
+    GSource* deadline = g_timeout_source_new(timeout * 1000);
+    g_source_set_callback(deadline, on_auth_deadline, &expired, nullptr);
+    g_source_attach(deadline, ctx);
+
+    bool timed_out = false;
     for (;;) {
         {
             std::lock_guard<std::mutex> lock(auth_mutex);
             if (auth_success) break;
         }
 
-        if (std::chrono::steady_clock::now() >= deadline) {
-            return true;
+        if (expired) {
+            timed_out = true;
+            break;
         }
 
-        while (g_main_context_pending(ctx)) {
-            g_main_context_iteration(ctx, FALSE);
+        g_main_context_iteration(ctx, TRUE);
+    }
+
+    g_source_destroy(deadline);
+    g_source_unref(deadline);
+    return timed_out;
+}
+
+static bool initialize_instance(SDKInstance* instance, const SDKConfig& config) {
+    SDK::SDKError result = instance->sdk.initialize(config);
+
+    if (result != SDK::SDKERR_SUCCESS) {
+        Util::Logger::getInstance().error("Failed to initialize SDK");
+        return false;
+    }
+
+    static auto& authLatency = Util::MetricsRegistry::getInstance().histogram(
+        "zoom_auth_duration_seconds", "Time from the SDK auth request to its success", "", 1e-9);
+    static auto& authFailures = Util::MetricsRegistry::getInstance().counter(
+        "zoom_auth_failures_total", "SDK authentications that failed or timed out");
+
+    std::mutex auth_mutex;
+    bool auth_success = false;
+    GMainContext* ctx = instance->context;
+    auto auth_start = std::chrono::steady_clock::now();
+
+    result = instance->sdk.authenticate([&auth_mutex, &auth_success, ctx]() {
+        {
+            std::lock_guard<std::mutex> lock(auth_mutex);
+            auth_success = true;
         }
+        g_main_context_wakeup(ctx);
+    });
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    if (result != SDK::SDKERR_SUCCESS ||
+        authentication_timeout(ctx, auth_mutex, auth_success, 10)
+    ) {
+        Util::Logger::getInstance().error("Failed to authenticate SDK");
+        authFailures.add();
+        instance->sdk.cleanup();
+        return false;
     }
-    return false;
+    authLatency.recordDuration(std::chrono::steady_clock::now() - auth_start);
+    return true;
 }
 
 
@@ -107,47 +512,49 @@ ZoomSDKHandle zoom_sdk_create(const char* sdk_key, const char* sdk_secret) {
         return nullptr;
     }
 
+    ZTRACE_SCOPE("zoom_sdk_create");
+    Util::FlightRecorder::getInstance().installFromEnv();
+    PluginRegistry::getInstance().loadFromEnv();
+    ZLOG_INFO("SIMD kernels use {} (detected {})", Util::cpuTierName(Util::activeCpuTier()),
+              Util::cpuTierName(Util::detectedCpuTier()));
+
     // Create SDK configuration
     SDKConfig config(std::string(sdk_key), std::string(sdk_secret), "https://zoom.us");
 
-    // Create and initialize SDK
-    ZoomSDK* sdk = new ZoomSDK();
-    SDK::SDKError result = sdk->initialize(config);
-
-    if (result != SDK::SDKERR_SUCCESS) {
-        Util::Logger::getInstance().error("Failed to initialize SDK");
-        delete sdk;
-        return nullptr;
+    // Create and initialize SDK with its own context as thread-default
+    auto* instance = new SDKInstance();
+    bool ready;
+    {
+        ScopedThreadDefaultContext scope(instance->context);
+        ready = initialize_instance(instance, config);
     }
 
-    std::mutex auth_mutex;
-    bool auth_success = false;
-
-    result = sdk->authenticate([&]() {
-        std::lock_guard<std::mutex> lock(auth_mutex);
-        auth_success = true;
-    });
-
-    if (result != SDK::SDKERR_SUCCESS ||
-        authentication_timeout(auth_mutex, auth_success, 10)
-    ) {
-        Util::Logger::getInstance().error("Failed to authenticate SDK");
-        delete sdk;
+    Util::FlightRecorder::getInstance().record("sdk_create", instance, ready);
+    if (!ready) {
+        delete instance;
         return nullptr;
     }
 
     Util::Logger::getInstance().success("SDK created and authenticated successfully");
-    return create_sdk_handle(sdk);
+    return create_sdk_handle(instance);
 }
 
 void zoom_sdk_destroy(ZoomSDKHandle handle) {
-    ZoomSDK* sdk = get_sdk_from_handle(handle);
-    if (!sdk) {
+    SDKInstance* instance = get_sdk_from_handle(handle);
+    if (!instance) {
         return;
     }
-    delete sdk;
     remove_sdk_handle(handle);
-    zoom_sdk_stop_loop();
+
+    // Only this instance's loop is stopped; other instances keep running
+    if (g_main_loop_is_running(instance->loop)) {
+        g_main_loop_quit(instance->loop);
+    }
+    {
+        ScopedThreadDefaultContext scope(instance->context);
+        instance->sdk.cleanup();
+    }
+    delete instance;
     std::cout << "[ZoomSDK-C] SDK destroyed successfully" << std::endl;
 }
 
@@ -158,12 +565,16 @@ MeetingHandle zoom_meeting_create_and_join(ZoomSDKHandle sdk_handle,
                                            const char* join_token,
                                            int enable_audio,
                                            int enable_video) {
-    ZoomSDK* sdk = get_sdk_from_handle(sdk_handle);
-    if (!sdk) {
+    SDKInstance* instance = get_sdk_from_handle(sdk_handle);
+    if (!instance) {
         std::cerr << "[ZoomSDK-C] Invalid SDK handle" << std::endl;
         return nullptr;
     }
 
+    ZTRACE_SCOPE("zoom_meeting_create_and_join");
+    ZoomSDK* sdk = &instance->sdk;
+    ScopedThreadDefaultContext scope(instance->context);
+
     if (!sdk->isInitialized() || !sdk->isAuthenticated()) {
         std::cerr << "[ZoomSDK-C] SDK not initialized or authenticated" << std::endl;
         return nullptr;
@@ -185,7 +596,9 @@ MeetingHandle zoom_meeting_create_and_join(ZoomSDKHandle sdk_handle,
         return nullptr;
     }
 
-    Meeting* meeting = Meeting::createMeeting(mid, pwd, name, false, token, raw_audio, raw_video, meetingService, settingService);
+    MeetingConfig meetingConfig(mid, pwd, name, false, token, raw_audio, raw_video);
+
+    Meeting* meeting = Meeting::createMeeting(meetingConfig, meetingService, settingService);
     if (!meeting) {
         std::cerr << "[ZoomSDK-C] Failed to create meeting" << std::endl;
         return nullptr;
@@ -193,11 +606,13 @@ MeetingHandle zoom_meeting_create_and_join(ZoomSDKHandle sdk_handle,
     
     MeetingHandle meeting_handle = create_meeting_handle(meeting);
     if (raw_audio) {
-        auto audioDelegate = new ZoomSDKAudioRawDataDelegate(meeting_handle);
+        auto audioDelegate = new ZoomSDKAudioRawDataDelegate(meeting_handle, &g_dispatch_thread, &meeting->timeline(),
+                                                             &meeting->capture());
         meeting->setAudioSource(audioDelegate);
     }
     if (raw_video) {
-        auto videoDelegate = new ZoomSDKVideoRendererDelegate(meeting_handle);
+        auto videoDelegate = new ZoomSDKVideoRendererDelegate(meeting_handle, &g_dispatch_thread, &meeting->timeline(),
+                                                              &meeting->capture());
         meeting->setVideoSource(videoDelegate);
     }
 
@@ -212,6 +627,10 @@ MeetingHandle zoom_meeting_create_and_join(ZoomSDKHandle sdk_handle,
         return nullptr;
     }
 
+    Util::FlightRecorder::getInstance().record("meeting_create", meeting_handle);
+    if (const char* capture = std::getenv("ZOOM_SDK_CAPTURE"); capture && *capture) {
+        zoom_meeting_start_capture(meeting_handle, capture);
+    }
     std::cout << "[ZoomSDK-C] Meeting created and joined successfully" << std::endl;
     return meeting_handle;
 }
@@ -222,13 +641,24 @@ void zoom_meeting_destroy(MeetingHandle meeting_handle) {
         return;
     }
 
+    if (auto delivery = find_delivery_state(meeting_handle)) {
+        delivery->audioCallback.store(nullptr);
+        delivery->videoCallback.store(nullptr);
+    }
+    Util::WorkStealingPool* pool;
     {
-        std::lock_guard<std::mutex> lock(g_instance_mutex);
-        g_audio_callbacks.erase(meeting_handle);
-        g_video_callbacks.erase(meeting_handle);
+        std::lock_guard<std::mutex> lock(g_media_pool_mutex);
+        pool = g_media_pool.get();
+    }
+    if (pool) {
+        // Drop frames still queued for this meeting and wait for callbacks already running,
+        // so none runs once this returns; not under the pool mutex, which callbacks may take
+        pool->removeGroup(reinterpret_cast<uint64_t>(meeting_handle));
     }
 
     meeting->leave();
+    PluginRegistry::getInstance().flushMeeting(meeting_handle);
+    Util::FlightRecorder::getInstance().record("meeting_destroy", meeting_handle);
 
     delete meeting->getAudioSource();
     delete meeting->getVideoSource();
@@ -257,99 +687,678 @@ ZoomMeetingStatus zoom_meeting_get_status(MeetingHandle meeting_handle) {
 }
 
 ZoomSDKResult zoom_meeting_set_audio_callback(MeetingHandle meeting_handle, OnAudioDataReceivedCallback callback) {
-    Meeting* meeting = get_meeting_from_handle(meeting_handle);
-    if (!meeting) {
+    auto delivery = find_delivery_state(meeting_handle);
+    if (!delivery) {
         std::cerr << "[ZoomSDK-C] Invalid meeting handle" << std::endl;
         return ZOOM_SDK_ERROR;
     }
 
-    std::lock_guard<std::mutex> lock(g_instance_mutex);
+    delivery->audioCallback.store(callback);
     if (callback) {
-        g_audio_callbacks[meeting_handle] = callback;
         std::cout << "[ZoomSDK-C] Audio callback set successfully" << std::endl;
     } else {
-        g_audio_callbacks.erase(meeting_handle);
         std::cout << "[ZoomSDK-C] Audio callback removed" << std::endl;
     }
     return ZOOM_SDK_SUCCESS;
 }
 
 ZoomSDKResult zoom_meeting_set_video_callback(MeetingHandle meeting_handle, OnVideoDataReceivedCallback callback) {
-    Meeting* meeting = get_meeting_from_handle(meeting_handle);
-    if (!meeting) {
+    auto delivery = find_delivery_state(meeting_handle);
+    if (!delivery) {
         std::cerr << "[ZoomSDK-C] Invalid meeting handle" << std::endl;
         return ZOOM_SDK_ERROR;
     }
 
-    std::lock_guard<std::mutex> lock(g_instance_mutex);
+    delivery->videoCallback.store(callback);
     if (callback) {
-        g_video_callbacks[meeting_handle] = callback;
         std::cout << "[ZoomSDK-C] Video callback set successfully" << std::endl;
     } else {
-        g_video_callbacks.erase(meeting_handle);
         std::cout << "[ZoomSDK-C] Video callback removed" << std::endl;
     }
     return ZOOM_SDK_SUCCESS;
 }
 
-void zoom_sdk_run_loop() {
-    if (g_main_loop) {
+void zoom_sdk_run_loop(ZoomSDKHandle handle) {
+    SDKInstance* instance = get_sdk_from_handle(handle);
+    if (!instance || g_main_loop_is_running(instance->loop)) {
         return;
     }
     std::cout << "[ZoomSDK-C] Starting event loop..." << std::endl;
-    g_main_loop = g_main_loop_new(nullptr, FALSE);
-    g_main_loop_run(g_main_loop);
-    g_main_loop_unref(g_main_loop);
-    g_main_loop = nullptr;
+    {
+        ScopedThreadDefaultContext scope(instance->context);
+        g_main_loop_run(instance->loop);
+    }
     std::cout << "[ZoomSDK-C] Event loop stopped" << std::endl;
 }
 
-void zoom_sdk_stop_loop() {
-    if (g_main_loop && g_main_loop_is_running(g_main_loop)) {
-        g_main_loop_quit(g_main_loop);
+void zoom_sdk_stop_loop(ZoomSDKHandle handle) {
+    SDKInstance* instance = get_sdk_from_handle(handle);
+    if (instance && g_main_loop_is_running(instance->loop)) {
+        g_main_loop_quit(instance->loop);
+    }
+}
+
+int zoom_sdk_get_poll_fds(ZoomSDKHandle handle, ZoomSDKPollFD* fds, int max_fds, int* timeout_ms) {
+    SDKInstance* instance = get_sdk_from_handle(handle);
+    if (!instance) {
+        std::cerr << "[ZoomSDK-C] Invalid SDK handle" << std::endl;
+        return -1;
+    }
+    GMainContext* ctx = instance->context;
+
+    // A previous call may have asked for a bigger array; query again without re-preparing
+    if (!instance->pollPrepared) {
+        if (!g_main_context_acquire(ctx)) {
+            std::cerr << "[ZoomSDK-C] Event loop is owned by another thread" << std::endl;
+            return -1;
+        }
+        g_main_context_prepare(ctx, &instance->pollMaxPriority);
+        instance->pollPrepared = true;
+    }
+
+    gint timeout = -1;
+    gint n_fds = g_main_context_query(ctx, instance->pollMaxPriority, &timeout,
+                                      reinterpret_cast<GPollFD*>(fds), fds ? max_fds : 0);
+    if (timeout_ms) {
+        *timeout_ms = timeout;
+    }
+    return n_fds;
+}
+
+int zoom_sdk_dispatch_pending(ZoomSDKHandle handle, ZoomSDKPollFD* fds, int n_fds) {
+    SDKInstance* instance = get_sdk_from_handle(handle);
+    if (!instance || !instance->pollPrepared) {
+        return 0;
+    }
+
+    GMainContext* ctx = instance->context;
+    gboolean ready = g_main_context_check(ctx, instance->pollMaxPriority,
+                                          reinterpret_cast<GPollFD*>(fds), fds ? n_fds : 0);
+    if (ready) {
+        ScopedThreadDefaultContext scope(ctx);
+        g_main_context_dispatch(ctx);
+    }
+
+    instance->pollPrepared = false;
+    g_main_context_release(ctx);
+    return ready ? 1 : 0;
+}
+
+ZoomSDKResult zoom_sdk_configure_media_workers(const ZoomMediaWorkerConfig* config) {
+    if (!config || config->worker_count < 0 || config->cpu_count < 0 || config->max_queued_frames < 0) {
+        return ZOOM_SDK_ERROR;
+    }
+
+    std::lock_guard<std::mutex> lock(g_media_pool_mutex);
+    if (g_media_pool) {
+        std::cerr << "[ZoomSDK-C] Media worker pool already started" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    g_media_pool_options.workerCount = static_cast<size_t>(config->worker_count);
+    g_media_pool_options.cpus.assign(config->cpus, config->cpus ? config->cpus + config->cpu_count : config->cpus);
+    if (config->max_queued_frames > 0) {
+        g_media_pool_options.maxQueuedPerStream = static_cast<size_t>(config->max_queued_frames);
+    }
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_meeting_set_delivery_mode(MeetingHandle meeting_handle, ZoomDeliveryMode mode) {
+    auto delivery = find_delivery_state(meeting_handle);
+    if (!delivery) {
+        std::cerr << "[ZoomSDK-C] Invalid meeting handle" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    if (mode == ZOOM_DELIVERY_WORKER_POOL) {
+        ensure_media_pool();
     }
+
+    Util::FlightRecorder::getInstance().record("delivery_mode", meeting_handle, mode);
+    delivery->mode.store(mode);
+    return ZOOM_SDK_SUCCESS;
 }
 
-void zoom_meeting_dispatch_audio(MeetingHandle meeting_handle, const void* data, int length, int type, unsigned int node_id) {
+ZoomSDKResult zoom_meeting_set_audio_pipeline(MeetingHandle meeting_handle, ZoomAudioPipeline pipeline) {
+    if (pipeline < ZOOM_AUDIO_PIPELINE_NONE || pipeline > ZOOM_AUDIO_PIPELINE_SPEECH) {
+        std::cerr << "[ZoomSDK-C] Invalid audio pipeline" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    auto delivery = find_delivery_state(meeting_handle);
+    if (!delivery) {
+        std::cerr << "[ZoomSDK-C] Invalid meeting handle" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    Util::FlightRecorder::getInstance().record("audio_pipeline", meeting_handle, pipeline);
+    // Frames already in flight finish on the previous pipelines, which they keep alive
+    delivery->audioPipelines.store(pipeline == ZOOM_AUDIO_PIPELINE_NONE
+                                       ? nullptr
+                                       : std::make_shared<MeetingAudioPipelines>(pipeline));
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_meeting_set_slow_consumer_policy(MeetingHandle meeting_handle, const ZoomSlowConsumerPolicy* policy) {
+    if (policy && (policy->action < ZOOM_SLOW_CONSUMER_WARN || policy->action > ZOOM_SLOW_CONSUMER_DROP)) {
+        std::cerr << "[ZoomSDK-C] Invalid slow consumer action" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    auto delivery = find_delivery_state(meeting_handle);
+    if (!delivery) {
+        std::cerr << "[ZoomSDK-C] Invalid meeting handle" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    ConsumerWatchdog& watchdog = delivery->watchdog;
+    uint64_t budget = policy && policy->budget_us ? policy->budget_us * 1000ULL : ConsumerWatchdog::kDefaultBudgetNs;
+    watchdog.budgetNs.store(budget, std::memory_order_relaxed);
+    watchdog.strikeLimit.store(policy && policy->strikes ? policy->strikes : ConsumerWatchdog::kDefaultStrikes,
+                               std::memory_order_relaxed);
+    watchdog.action.store(policy ? policy->action : ZOOM_SLOW_CONSUMER_WARN, std::memory_order_relaxed);
+    watchdog.strikes.store(0, std::memory_order_relaxed);
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_meeting_get_slow_consumer_stats(MeetingHandle meeting_handle, ZoomSlowConsumerStats* stats) {
+    if (!stats) {
+        return ZOOM_SDK_ERROR;
+    }
+
+    auto delivery = find_delivery_state(meeting_handle);
+    if (!delivery) {
+        std::cerr << "[ZoomSDK-C] Invalid meeting handle" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    const ConsumerWatchdog& watchdog = delivery->watchdog;
+    stats->callbacks = watchdog.callbacks.load(std::memory_order_relaxed);
+    stats->overruns = watchdog.overruns.load(std::memory_order_relaxed);
+    stats->max_ns = watchdog.maxNs.load(std::memory_order_relaxed);
+    stats->shed_frames = watchdog.shedFrames.load(std::memory_order_relaxed);
+    stats->mode = delivery->mode.load();
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_meeting_get_timeline(MeetingHandle meeting_handle, ZoomMeetingTimeline* timeline) {
+    if (!timeline) {
+        return ZOOM_SDK_ERROR;
+    }
+
+    Meeting* meeting = get_meeting_from_handle(meeting_handle);
+    if (!meeting) {
+        std::cerr << "[ZoomSDK-C] Invalid meeting handle" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    const MeetingTimeline& steps = meeting->timeline();
+    timeline->join_requested_ns = steps.joinRequestedNs();
+    timeline->in_meeting_ns = steps.elapsed(MeetingTimeline::IN_MEETING);
+    timeline->recording_privilege_ns = steps.elapsed(MeetingTimeline::RECORDING_PRIVILEGE);
+    timeline->recording_started_ns = steps.elapsed(MeetingTimeline::RECORDING_STARTED);
+    timeline->audio_subscribed_ns = steps.elapsed(MeetingTimeline::AUDIO_SUBSCRIBED);
+    timeline->first_audio_ns = steps.elapsed(MeetingTimeline::FIRST_AUDIO);
+    timeline->first_video_ns = steps.elapsed(MeetingTimeline::FIRST_VIDEO);
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_meeting_start_capture(MeetingHandle meeting_handle, const char* path) {
+    if (!path || !*path) {
+        return ZOOM_SDK_ERROR;
+    }
+
+    Meeting* meeting = get_meeting_from_handle(meeting_handle);
+    if (!meeting) {
+        std::cerr << "[ZoomSDK-C] Invalid meeting handle" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    std::string resolved = Util::expandPathTemplate(path, meeting->getConfig().meetingId());
+    if (!meeting->capture().start(resolved)) {
+        std::cerr << "[ZoomSDK-C] Failed to start media capture: " << resolved << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_meeting_stop_capture(MeetingHandle meeting_handle) {
+    Meeting* meeting = get_meeting_from_handle(meeting_handle);
+    if (!meeting) {
+        std::cerr << "[ZoomSDK-C] Invalid meeting handle" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    meeting->capture().stop();
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_meeting_replay_capture(MeetingHandle meeting_handle, const char* path, double speed,
+                                          unsigned long long* frames) {
+    if (frames) *frames = 0;
+    if (!path || !std::isfinite(speed) || speed < 0 || !get_meeting_from_handle(meeting_handle)) {
+        std::cerr << "[ZoomSDK-C] Invalid replay arguments" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    Util::MediaCaptureReader reader;
+    if (!reader.open(path)) {
+        std::cerr << "[ZoomSDK-C] Not a media capture: " << path << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    // Pace against the first frame so a slow consumer delays, rather than compresses, the rest
+    auto start = std::chrono::steady_clock::now();
+    unsigned long long replayed = 0;
+    Util::MediaRecord record;
+    while (reader.next(record)) {
+        if (speed > 0) {
+            auto due = std::chrono::nanoseconds(static_cast<int64_t>(record.offsetNs / speed));
+            std::this_thread::sleep_until(start + due);
+        }
+
+        uint64_t ingress = Util::monotonicNs();
+        if (record.type == Util::MediaRecord::VIDEO_I420) {
+            const char* y = record.data;
+            const char* u = y + static_cast<size_t>(record.width) * record.height;
+            const char* v = u + static_cast<size_t>((record.width + 1) / 2) * ((record.height + 1) / 2);
+            zoom_meeting_dispatch_video(meeting_handle, y, u, v, record.width, record.height, record.length,
+                                        record.nodeId, record.sdkTimestamp, ingress);
+        } else {
+            int type = record.type == Util::MediaRecord::AUDIO_MIXED ? ZOOM_AUDIO_TYPE_MIXED : ZOOM_AUDIO_TYPE_ONE_WAY;
+            zoom_meeting_dispatch_audio(meeting_handle, record.data, static_cast<int>(record.length), type,
+                                        record.nodeId, ingress);
+        }
+        replayed++;
+    }
+
+    if (frames) *frames = replayed;
+    if (reader.corrupt()) {
+        std::cerr << "[ZoomSDK-C] Replay stopped at a corrupt record after " << replayed << " frames: " << path
+                  << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+    return ZOOM_SDK_SUCCESS;
+}
+
+int zoom_sdk_get_media_worker_stats(ZoomMediaWorkerStats* stats, int max_workers) {
+    std::lock_guard<std::mutex> lock(g_media_pool_mutex);
+    if (!g_media_pool) {
+        return 0;
+    }
+
+    auto workers = g_media_pool->stats();
+    for (int i = 0; stats && i < max_workers && i < static_cast<int>(workers.size()); i++) {
+        stats[i].frames_processed = workers[i].tasksExecuted;
+        stats[i].streams_stolen = workers[i].streamsStolen;
+        stats[i].busy_ns = workers[i].busyNs;
+        stats[i].uptime_ns = workers[i].uptimeNs;
+        stats[i].runnable_streams = static_cast<unsigned int>(workers[i].runnableStreams);
+        static_assert(ZOOM_MEDIA_WAIT_BUCKETS == Util::WorkStealingPool::kWaitBuckets, "wait histogram size mismatch");
+        std::copy(workers[i].waitBuckets, workers[i].waitBuckets + ZOOM_MEDIA_WAIT_BUCKETS, stats[i].queue_wait);
+    }
+    return static_cast<int>(workers.size());
+}
+
+unsigned long long zoom_sdk_get_media_dropped_frames() {
+    std::lock_guard<std::mutex> lock(g_media_pool_mutex);
+    return g_media_pool ? g_media_pool->droppedTasks() : 0;
+}
+
+ZoomSDKResult zoom_sdk_set_thread_options(ZoomThreadRole role, const ZoomThreadOptions* options) {
+    Util::ThreadOptions converted;
+    if (!to_thread_options(options, converted)) {
+        std::cerr << "[ZoomSDK-C] Invalid thread options" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+
+    switch (role) {
+        case ZOOM_THREAD_SDK_DISPATCH:
+            g_dispatch_thread.set(converted);
+            return ZOOM_SDK_SUCCESS;
+        case ZOOM_THREAD_MEDIA_WORKER: {
+            std::lock_guard<std::mutex> lock(g_media_pool_mutex);
+            if (g_media_pool) {
+                std::cerr << "[ZoomSDK-C] Media worker pool already started" << std::endl;
+                return ZOOM_SDK_ERROR;
+            }
+            if (!converted.cpus.empty()) {
+                g_media_pool_options.cpus = converted.cpus;
+            }
+            g_media_pool_options.thread = converted;
+            return ZOOM_SDK_SUCCESS;
+        }
+        case ZOOM_THREAD_LOG_WRITER: {
+            std::lock_guard<std::mutex> lock(g_instance_mutex);
+            g_log_writer_options = converted;
+            return ZOOM_SDK_SUCCESS;
+        }
+    }
+    return ZOOM_SDK_ERROR;
+}
+
+ZoomSDKResult zoom_sdk_set_async_logging(int enable, int queue_capacity) {
+    if (queue_capacity < 0) {
+        return ZOOM_SDK_ERROR;
+    }
+
+    auto& logger = Util::Logger::getInstance();
+    if (enable) {
+        Util::ThreadOptions writer;
+        {
+            std::lock_guard<std::mutex> lock(g_instance_mutex);
+            writer = g_log_writer_options;
+        }
+        logger.enableAsync(queue_capacity > 0 ? static_cast<size_t>(queue_capacity) : 8192, writer);
+    } else {
+        logger.disableAsync();
+    }
+    return ZOOM_SDK_SUCCESS;
+}
+
+unsigned long long zoom_sdk_get_dropped_log_messages() {
+    return Util::Logger::getInstance().droppedMessages();
+}
+
+int zoom_sdk_get_metrics_text(char* buffer, int buffer_size) {
+    std::string text = Util::MetricsRegistry::getInstance().prometheusText();
+    if (buffer && buffer_size > 0) {
+        size_t n = std::min(text.size(), static_cast<size_t>(buffer_size) - 1);
+        std::memcpy(buffer, text.data(), n);
+        buffer[n] = '\0';
+    }
+    return static_cast<int>(text.size());
+}
+
+int zoom_sdk_get_metrics(ZoomMetricSample* samples, int max_samples) {
+    static_assert(static_cast<int>(Util::MetricType::HISTOGRAM) == ZOOM_METRIC_HISTOGRAM, "metric type mismatch");
+
+    auto snapshot = Util::MetricsRegistry::getInstance().snapshot();
+    for (int i = 0; samples && i < max_samples && i < static_cast<int>(snapshot.size()); i++) {
+        const auto& sample = snapshot[i];
+        samples[i].name = sample.name->c_str();
+        samples[i].labels = sample.labels->c_str();
+        samples[i].type = static_cast<ZoomMetricType>(sample.type);
+        samples[i].value = sample.value;
+        samples[i].count = sample.count;
+        samples[i].sum = sample.sum;
+        samples[i].p50 = sample.p50;
+        samples[i].p90 = sample.p90;
+        samples[i].p99 = sample.p99;
+        samples[i].max = sample.max;
+    }
+    return static_cast<int>(snapshot.size());
+}
+
+int zoom_sdk_get_memory_stats(ZoomMemoryStats* stats, int max_entries) {
+    auto entries = Util::MemoryAccounting::getInstance().snapshot();
+    for (int i = 0; stats && i < max_entries && i < static_cast<int>(entries.size()); i++) {
+        const auto& entry = entries[i];
+        stats[i].subsystem = entry.subsystem;
+        stats[i].meeting = static_cast<MeetingHandle>(const_cast<void*>(entry.meeting));
+        stats[i].current_bytes = entry.stats.currentBytes;
+        stats[i].peak_bytes = entry.stats.peakBytes;
+        stats[i].allocations = entry.stats.allocations;
+        stats[i].frees = entry.stats.frees;
+    }
+    return static_cast<int>(entries.size());
+}
+
+unsigned long long zoom_frame_ingress_ns() {
+    return t_frame_ingress_ns;
+}
+
+unsigned long long zoom_sdk_monotonic_ns() {
+    return Util::monotonicNs();
+}
+
+ZoomSDKResult zoom_sdk_enable_tracing(const char* path) {
+    if (!path || !*path) {
+        std::cerr << "[ZoomSDK-C] Invalid trace path" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+    Util::Tracer::getInstance().enable(path);
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_sdk_write_trace() {
+    auto& tracer = Util::Tracer::getInstance();
+    if (!tracer.isEnabled()) {
+        return ZOOM_SDK_ERROR;
+    }
+    if (!tracer.write()) {
+        std::cerr << "[ZoomSDK-C] Failed to write trace" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_sdk_disable_tracing() {
+    if (!Util::Tracer::getInstance().disable()) {
+        std::cerr << "[ZoomSDK-C] Tracing not enabled or trace not written" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_sdk_enable_flight_recorder(const char* path) {
+    if (!path || !Util::FlightRecorder::getInstance().install(path)) {
+        std::cerr << "[ZoomSDK-C] Invalid flight recorder path or handlers already installed" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_sdk_dump_flight_recorder(const char* path) {
+    if (!path || !Util::FlightRecorder::getInstance().dump(path)) {
+        std::cerr << "[ZoomSDK-C] Failed to write flight recorder dump" << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_sdk_load_plugin(const char* path, const char* config, const ZoomPluginBudget* budget) {
+    if (!path || !PluginRegistry::getInstance().load(path, config, budget)) {
+        std::cerr << "[ZoomSDK-C] Failed to load plugin " << (path ? path : "(null)") << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+    return ZOOM_SDK_SUCCESS;
+}
+
+ZoomSDKResult zoom_sdk_unload_plugin(const char* name) {
+    if (!name || !PluginRegistry::getInstance().unload(name)) {
+        std::cerr << "[ZoomSDK-C] No plugin named " << (name ? name : "(null)") << std::endl;
+        return ZOOM_SDK_ERROR;
+    }
+    return ZOOM_SDK_SUCCESS;
+}
+
+int zoom_sdk_get_plugin_stats(ZoomPluginStats* stats, int max_plugins) {
+    auto plugins = PluginRegistry::getInstance().stats();
+    for (int i = 0; stats && i < max_plugins && i < static_cast<int>(plugins.size()); i++) {
+        stats[i] = plugins[i];
+    }
+    return static_cast<int>(plugins.size());
+}
+
+// Runs a frame through the meeting's audio pipeline and hands the output to the
+// callback. Only the callback is timed against the consumer budget
+static void deliver_audio(OnAudioDataReceivedCallback callback, MeetingAudioPipelines* pipelines,
+                          MeetingHandle meeting_handle, const void* data, int length, int type, unsigned int node_id,
+                          FrameMetrics& metrics, uint64_t ingress_ns, MeetingDeliveryState& state) {
+    if (!pipelines) {
+        FrameDelivery delivery(meeting_handle, metrics, ingress_ns, state);
+        callback(meeting_handle, data, length, type, node_id);
+        return;
+    }
+
+    // Gating silence is the pipeline's job, so it is not counted as a drop
+    static auto& gated = Util::MetricsRegistry::getInstance().counter(
+        "zoom_audio_pipeline_gated_total", "Audio frames an audio pipeline held back, such as silence under VAD");
+    uint64_t stream = (static_cast<uint64_t>(type) << 32) | node_id;
+    auto pipeline = pipelines->stream(stream, ingress_ns);
+    bool delivered = process_audio_pipeline(*pipeline, data, length, [&](const Util::AudioBlock& out) {
+        FrameDelivery delivery(meeting_handle, metrics, ingress_ns, state);
+        callback(meeting_handle, out.samples, static_cast<int>(out.count * sizeof(int16_t)), type, node_id);
+    });
+    if (!delivered) {
+        gated.add();
+    }
+}
+
+void zoom_meeting_dispatch_audio(MeetingHandle meeting_handle, const void* data, int length, int type, unsigned int node_id,
+                                 unsigned long long ingress_ns) {
     if (!data || length < 0) {
         return;
     }
 
-    OnAudioDataReceivedCallback callback = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(g_instance_mutex);
-        auto it = g_audio_callbacks.find(meeting_handle);
-        if (it != g_audio_callbacks.end()) {
-            callback = it->second;
+    static FrameDrops noCallback("no_callback");
+    static FrameDrops queueFull("queue_full");
+    FrameMetrics& metrics = frame_metrics(audio_frame_kind(type));
+    metrics.framesIn.add();
+    metrics.bytesIn.add(static_cast<uint64_t>(length));
+
+    // Plugins see every frame on this thread, whether or not a consumer is attached
+    static FrameDrops pluginDrops("plugin");
+    if (!PluginRegistry::getInstance().empty()) {
+        ZoomPluginFrame view{};
+        view.struct_size = sizeof(view);
+        view.kind = ZOOM_PLUGIN_AUDIO;
+        view.meeting = meeting_handle;
+        view.ingress_ns = ingress_ns;
+        view.data = data;
+        view.length = length;
+        view.audio_type = type;
+        view.node_id = node_id;
+        if (!PluginRegistry::getInstance().process(view)) {
+            pluginDrops.record(meeting_handle, metrics.kind);
+            return;
         }
     }
 
-    if (callback) {
-        callback(meeting_handle, data, length, type, node_id);
+    auto state = find_delivery_state(meeting_handle);
+    OnAudioDataReceivedCallback callback = state ? state->audioCallback.load() : nullptr;
+    if (!callback) {
+        noCallback.record(meeting_handle, metrics.kind);
+        return;
+    }
+
+    ZoomDeliveryMode mode = state->mode.load(std::memory_order_relaxed);
+    if (mode == ZOOM_DELIVERY_WORKER_POOL) {
+        // The SDK buffer is only valid during this call, so the worker gets a copy
+        const char* bytes = static_cast<const char*>(data);
+        FrameBuffer frame(bytes, bytes + length, Util::SlabBufferAllocator<char>(state->frameMemory));
+        uint64_t stream = (static_cast<uint64_t>(type) << 32) | node_id;
+        auto pipelines = state->audioPipelines.load();
+
+        bool queued = g_media_pool->submit({reinterpret_cast<uint64_t>(meeting_handle), stream},
+            [meeting_handle, frame = std::move(frame), type, node_id, ingress_ns, &metrics = metrics,
+             state = std::move(state), pipelines = std::move(pipelines)]() {
+                // Read again: the callback may have changed while the frame was queued
+                if (auto cb = state->audioCallback.load()) {
+                    deliver_audio(cb, pipelines.get(), meeting_handle, frame.data(), static_cast<int>(frame.size()),
+                                  type, node_id, metrics, ingress_ns, *state);
+                } else {
+                    noCallback.record(meeting_handle, metrics.kind);
+                }
+            });
+        if (!queued) {
+            queueFull.record(meeting_handle, metrics.kind);
+        }
+        return;
     }
+
+    if (shed_frame(*state, mode, metrics.kind, ingress_ns)) {
+        return;
+    }
+    deliver_audio(callback, state->audioPipelines.load().get(), meeting_handle, data, length, type, node_id, metrics,
+                  ingress_ns, *state);
 }
 
 void zoom_meeting_dispatch_video(MeetingHandle meeting_handle, 
                                  const char* y_buffer, const char* u_buffer, const char* v_buffer,
                                  unsigned int width, unsigned int height,
                                  unsigned int buffer_len, unsigned int source_id,
-                                 unsigned long long timestamp) {
+                                 unsigned long long timestamp, unsigned long long ingress_ns) {
     if (!y_buffer || !u_buffer || !v_buffer || buffer_len == 0) {
         return;
     }
 
-    OnVideoDataReceivedCallback callback = nullptr;
-    {
-        std::lock_guard<std::mutex> lock(g_instance_mutex);
-        auto it = g_video_callbacks.find(meeting_handle);
-        if (it != g_video_callbacks.end()) {
-            callback = it->second;
+    static FrameDrops noCallback("no_callback");
+    static FrameDrops queueFull("queue_full");
+    static FrameDrops malformed("malformed");
+    FrameMetrics& metrics = frame_metrics(FRAME_VIDEO);
+    metrics.framesIn.add();
+    metrics.bytesIn.add(buffer_len);
+
+    static FrameDrops pluginDrops("plugin");
+    if (!PluginRegistry::getInstance().empty()) {
+        ZoomPluginFrame view{};
+        view.struct_size = sizeof(view);
+        view.kind = ZOOM_PLUGIN_VIDEO;
+        view.meeting = meeting_handle;
+        view.ingress_ns = ingress_ns;
+        view.y_buffer = y_buffer;
+        view.u_buffer = u_buffer;
+        view.v_buffer = v_buffer;
+        view.width = width;
+        view.height = height;
+        view.buffer_len = buffer_len;
+        view.source_id = source_id;
+        view.timestamp = timestamp;
+        if (!PluginRegistry::getInstance().process(view)) {
+            pluginDrops.record(meeting_handle, metrics.kind);
+            return;
         }
     }
 
-    if (callback) {
-        callback(meeting_handle, y_buffer, u_buffer, v_buffer, width, height, buffer_len, source_id, timestamp);
+    auto state = find_delivery_state(meeting_handle);
+    OnVideoDataReceivedCallback callback = state ? state->videoCallback.load() : nullptr;
+    if (!callback) {
+        noCallback.record(meeting_handle, metrics.kind);
+        return;
+    }
+
+    ZoomDeliveryMode mode = state->mode.load(std::memory_order_relaxed);
+    if (mode == ZOOM_DELIVERY_WORKER_POOL) {
+        // Copy the three I420 planes into one contiguous frame for the worker
+        size_t ySize = static_cast<size_t>(width) * height;
+        if (ySize > buffer_len) {
+            malformed.record(meeting_handle, metrics.kind);
+            return;
+        }
+        size_t uvSize = (buffer_len - ySize) / 2;
+
+        FrameBuffer frame(Util::SlabBufferAllocator<char>(state->frameMemory));
+        frame.reserve(buffer_len);
+        frame.insert(frame.end(), y_buffer, y_buffer + ySize);
+        frame.insert(frame.end(), u_buffer, u_buffer + uvSize);
+        frame.insert(frame.end(), v_buffer, v_buffer + uvSize);
+        frame.resize(buffer_len);
+
+        bool queued = g_media_pool->submit({reinterpret_cast<uint64_t>(meeting_handle), kVideoStreamTag | source_id},
+            [meeting_handle, frame = std::move(frame), ySize, uvSize, width, height, buffer_len, source_id, timestamp,
+             ingress_ns, &metrics = metrics, state = std::move(state)]() {
+                if (auto cb = state->videoCallback.load()) {
+                    FrameDelivery delivery(meeting_handle, metrics, ingress_ns, *state);
+                    const char* y = frame.data();
+                    cb(meeting_handle, y, y + ySize, y + ySize + uvSize,
+                       width, height, buffer_len, source_id, timestamp);
+                } else {
+                    noCallback.record(meeting_handle, metrics.kind);
+                }
+            });
+        if (!queued) {
+            queueFull.record(meeting_handle, metrics.kind);
+        }
+        return;
+    }
+
+    if (shed_frame(*state, mode, metrics.kind, ingress_ns)) {
+        return;
     }
+    FrameDelivery delivery(meeting_handle, metrics, ingress_ns, *state);
+    callback(meeting_handle, y_buffer, u_buffer, v_buffer, width, height, buffer_len, source_id, timestamp);
 }
 
 #ifdef __cplusplus
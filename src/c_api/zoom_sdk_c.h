@@ -5,6 +5,11 @@
 extern "C" {
 #endif
 
+// libzoomsdk_c builds with -fvisibility=hidden; everything declared here is the exported API
+#if defined(__GNUC__)
+#pragma GCC visibility push(default)
+#endif
+
 // Return codes for the C API
 typedef enum {
     ZOOM_SDK_SUCCESS = 0,
@@ -25,6 +30,163 @@ typedef void (*OnVideoDataReceivedCallback)(MeetingHandle meeting_handle,
                                             unsigned int buffer_len, unsigned int source_id,
                                             unsigned long long timestamp);
 
+// Poll descriptor used to embed the SDK event loop into a host loop
+// Layout-compatible with struct pollfd (and GPollFD) on Linux
+typedef struct {
+    int fd;
+    unsigned short events;
+    unsigned short revents;
+} ZoomSDKPollFD;
+
+// Frame delivery modes for a meeting
+typedef enum {
+    ZOOM_DELIVERY_INLINE = 0,       // Callbacks run on the SDK delivery thread (default)
+    ZOOM_DELIVERY_WORKER_POOL = 1,  // Frames are copied and delivered from the media worker pool
+    ZOOM_DELIVERY_SHED = 2          // Inline, but after a callback over budget, frames arriving
+                                    // within its duration are dropped
+} ZoomDeliveryMode;
+
+// Preset native processing applied to a meeting's audio before its callback
+typedef enum {
+    ZOOM_AUDIO_PIPELINE_NONE = 0,     // Frames are delivered as received (default)
+    ZOOM_AUDIO_PIPELINE_VAD = 1,      // Silent frames are dropped; others are delivered unchanged
+    ZOOM_AUDIO_PIPELINE_DC_BLOCK = 2, // DC offset and rumble below ~25 Hz are removed
+    ZOOM_AUDIO_PIPELINE_SPEECH = 3    // DC block, half sample rate (32 kHz in, 16 kHz out), silent frames dropped
+} ZoomAudioPipeline;
+
+// What the watchdog does once a meeting's callbacks keep exceeding their budget
+typedef enum {
+    ZOOM_SLOW_CONSUMER_WARN = 0,    // Only log (rate-limited) and count (default)
+    ZOOM_SLOW_CONSUMER_BUFFER = 1,  // Switch the meeting to ZOOM_DELIVERY_WORKER_POOL
+    ZOOM_SLOW_CONSUMER_DROP = 2     // Switch the meeting to ZOOM_DELIVERY_SHED
+} ZoomSlowConsumerAction;
+
+// Slow consumer watchdog settings of a meeting
+typedef struct {
+    unsigned int budget_us;         // Callback time allowed per frame, 0 for the default (5000)
+    unsigned int strikes;           // Consecutive overruns before acting, 0 for the default (3)
+    ZoomSlowConsumerAction action;
+} ZoomSlowConsumerPolicy;
+
+// Slow consumer watchdog counters of a meeting
+typedef struct {
+    unsigned long long callbacks;   // Callbacks timed
+    unsigned long long overruns;    // Callbacks that exceeded the budget
+    unsigned long long max_ns;      // Longest callback
+    unsigned long long shed_frames; // Frames dropped in ZOOM_DELIVERY_SHED mode
+    ZoomDeliveryMode mode;          // Current delivery mode
+} ZoomSlowConsumerStats;
+
+// Steps from the join request to the first frames of a meeting, in nanoseconds since
+// the request (0 until the step is reached); restarted by every join or start
+typedef struct {
+    unsigned long long join_requested_ns;       // CLOCK_MONOTONIC time of the request, 0 before it
+    unsigned long long in_meeting_ns;           // Meeting status INMEETING
+    unsigned long long recording_privilege_ns;  // Raw recording allowed
+    unsigned long long recording_started_ns;    // StartRawRecording succeeded
+    unsigned long long audio_subscribed_ns;     // Raw audio subscribed
+    unsigned long long first_audio_ns;          // Time to first audio frame
+    unsigned long long first_video_ns;          // Time to first video frame
+} ZoomMeetingTimeline;
+
+// Media worker pool configuration
+typedef struct {
+    int worker_count;        // Number of workers, 0 for one per CPU (at most 4)
+    const int* cpus;         // CPUs to pin workers to (worker i uses cpus[i % cpu_count]), can be NULL
+    int cpu_count;           // Number of entries in cpus, 0 for no pinning
+    int max_queued_frames;   // Frames queued per stream before new ones are dropped, 0 for default (256)
+} ZoomMediaWorkerConfig;
+
+// Queue wait histogram size: bucket i counts frames that waited less than 2^i microseconds
+// between the SDK callback and the start of the consumer callback (last bucket: anything longer)
+#define ZOOM_MEDIA_WAIT_BUCKETS 24
+
+// Per-worker utilization counters
+typedef struct {
+    unsigned long long frames_processed;
+    unsigned long long streams_stolen;   // Streams taken from another worker's queue
+    unsigned long long busy_ns;          // Time spent running callbacks
+    unsigned long long uptime_ns;        // Time since the pool started; busy_ns / uptime_ns is utilization
+    unsigned int runnable_streams;       // Streams currently waiting in this worker's queue
+    unsigned long long queue_wait[ZOOM_MEDIA_WAIT_BUCKETS];
+} ZoomMediaWorkerStats;
+
+// Metric kinds
+typedef enum {
+    ZOOM_METRIC_COUNTER = 0,
+    ZOOM_METRIC_GAUGE = 1,
+    ZOOM_METRIC_HISTOGRAM = 2
+} ZoomMetricType;
+
+// One metric series; durations are in seconds
+typedef struct {
+    const char* name;        // Prometheus metric name, e.g. zoom_frames_in_total
+    const char* labels;      // Label set without braces, e.g. type="video", or ""
+    ZoomMetricType type;
+    double value;            // Counter or gauge value; sample count for histograms
+    unsigned long long count;  // Histogram sample count
+    double sum;              // Histogram sum of samples
+    double p50;              // Histogram quantiles, upper bound of the containing bucket (within 25%)
+    double p90;
+    double p99;
+    double max;
+} ZoomMetricSample;
+
+// Memory held by one library subsystem, in total or for one meeting
+typedef struct {
+    const char* subsystem;          // "media_frames", "media_pool", "log_ring", "trace", "flight_recorder"
+    MeetingHandle meeting;          // NULL for the subsystem total
+    long long current_bytes;
+    long long peak_bytes;
+    unsigned long long allocations;
+    unsigned long long frees;
+} ZoomMemoryStats;
+
+// Time allowed to a media plugin, see zoom_sdk_load_plugin(). Checked after each
+// call returns, so it suspends a plugin that keeps overrunning but does not cut
+// short a call that hangs
+typedef struct {
+    unsigned int budget_us;         // process_frame time allowed per frame, 0 for the default (1000)
+    unsigned int strikes;           // Consecutive overruns before the plugin is suspended, 0 for the default (3)
+    unsigned int suspend_ms;        // How long a suspended plugin is skipped, 0 for the default (10000)
+} ZoomPluginBudget;
+
+// Counters of a loaded media plugin
+typedef struct {
+    char name[64];
+    unsigned long long frames;      // process_frame calls
+    unsigned long long dropped;     // Frames the plugin returned ZOOM_PLUGIN_DROP for
+    unsigned long long skipped;     // Frames that bypassed it while suspended
+    unsigned long long overruns;    // Calls over budget
+    unsigned long long total_ns;    // Time spent in process_frame
+    unsigned long long max_ns;      // Longest call
+    unsigned int suspensions;
+    int suspended;                  // 1 while suspended
+} ZoomPluginStats;
+
+// Threads owned or driven by the library
+typedef enum {
+    ZOOM_THREAD_SDK_DISPATCH = 0,   // SDK threads delivering raw data to the callbacks, configured on first frame
+    ZOOM_THREAD_MEDIA_WORKER = 1,   // Media worker pool threads, named zoom-media-<n>
+    ZOOM_THREAD_LOG_WRITER = 2      // Async log writer thread, named zoom-log
+} ZoomThreadRole;
+
+// Scheduling policies
+typedef enum {
+    ZOOM_SCHED_DEFAULT = 0,     // SCHED_OTHER, priority is a nice value (0 = unchanged)
+    ZOOM_SCHED_FIFO = 1,        // SCHED_FIFO, priority 1..99, needs CAP_SYS_NICE or RLIMIT_RTPRIO
+    ZOOM_SCHED_RR = 2           // SCHED_RR, priority 1..99, needs CAP_SYS_NICE or RLIMIT_RTPRIO
+} ZoomSchedPolicy;
+
+// Placement and scheduling of a thread
+typedef struct {
+    const char* name;        // Thread name shown in top -H and perf (max 15 chars), NULL for the default
+    const int* cpus;         // CPUs the thread may run on, can be NULL
+    int cpu_count;           // Number of entries in cpus, 0 to leave affinity unchanged
+    ZoomSchedPolicy policy;
+    int priority;
+} ZoomThreadOptions;
+
 // Audio type constants
 #define ZOOM_AUDIO_TYPE_MIXED 0
 #define ZOOM_AUDIO_TYPE_ONE_WAY 1
@@ -88,6 +250,8 @@ MeetingHandle zoom_meeting_create_and_join(ZoomSDKHandle sdk_handle,
 
 /**
  * Leave and destroy a meeting
+ * Callbacks of the meeting already running on media workers finish before this
+ * returns, and none is called afterwards, so callback state can be freed then.
  * @param meeting_handle The meeting handle
  */
 void zoom_meeting_destroy(MeetingHandle meeting_handle);
@@ -117,26 +281,325 @@ ZoomSDKResult zoom_meeting_set_audio_callback(MeetingHandle meeting_handle, OnAu
 ZoomSDKResult zoom_meeting_set_video_callback(MeetingHandle meeting_handle, OnVideoDataReceivedCallback callback);
 
 /**
- * Run the main event loop to process SDK callbacks
- * This function blocks until interrupted (Ctrl+C) or the loop is stopped
- * Call this after setting up your meetings and callbacks
+ * Run the event loop of an SDK instance to process its callbacks
+ * This function blocks until the loop is stopped with zoom_sdk_stop_loop()
+ * Each SDK instance has its own loop context, so several instances can run side by side
+ * @param handle The SDK handle
  */
-void zoom_sdk_run_loop();
+void zoom_sdk_run_loop(ZoomSDKHandle handle);
 
 /**
- * Request the main event loop to stop
+ * Request the event loop of an SDK instance to stop
  * This function is safe to call from another thread. It will wake the loop
- * and cause zoom_sdk_run_loop() to return shortly.
+ * and cause zoom_sdk_run_loop() to return shortly. Other instances are unaffected.
+ * @param handle The SDK handle
+ */
+void zoom_sdk_stop_loop(ZoomSDKHandle handle);
+
+/**
+ * Prepare one iteration of an SDK instance's event loop for an external poller
+ * Use this together with zoom_sdk_dispatch_pending() instead of zoom_sdk_run_loop()
+ * when the host already runs its own epoll/io_uring/selector loop
+ * @param handle The SDK handle
+ * @param fds Array that receives the descriptors to wait on (can be NULL if max_fds is 0)
+ * @param max_fds Capacity of the fds array
+ * @param timeout_ms Receives the maximum time to wait in milliseconds, -1 to wait indefinitely
+ * @return Number of descriptors needed, or -1 if the handle is invalid or its loop is owned by another thread.
+ *         If the result is larger than max_fds, call again with a bigger array before polling
+ * @note Must be called from the same thread as zoom_sdk_dispatch_pending()
+ */
+int zoom_sdk_get_poll_fds(ZoomSDKHandle handle, ZoomSDKPollFD* fds, int max_fds, int* timeout_ms);
+
+/**
+ * Dispatch SDK callbacks that became ready after polling
+ * Call once the host loop has waited on the descriptors from zoom_sdk_get_poll_fds()
+ * (or the timeout expired), with revents filled in
+ * @param handle The SDK handle
+ * @param fds The descriptors returned by zoom_sdk_get_poll_fds() with revents set
+ * @param n_fds Number of descriptors in fds
+ * @return 1 if any callbacks were dispatched, 0 otherwise
+ */
+int zoom_sdk_dispatch_pending(ZoomSDKHandle handle, ZoomSDKPollFD* fds, int n_fds);
+
+/**
+ * Configure the media worker pool
+ * Must be called before any meeting switches to ZOOM_DELIVERY_WORKER_POOL
+ * @param config The pool configuration
+ * @return ZoomSDKResult indicating success, or failure if the pool is already running
+ */
+ZoomSDKResult zoom_sdk_configure_media_workers(const ZoomMediaWorkerConfig* config);
+
+/**
+ * Choose how frames of a meeting are delivered to its callbacks
+ * In ZOOM_DELIVERY_WORKER_POOL mode each frame is copied and handed to the media worker pool,
+ * keyed by stream (audio type + node_id, or video source), so the SDK thread is never blocked
+ * by the callback while per-stream order is preserved
+ * @param meeting_handle The meeting handle
+ * @param mode The delivery mode
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_meeting_set_delivery_mode(MeetingHandle meeting_handle, ZoomDeliveryMode mode);
+
+/**
+ * Choose the native processing applied to a meeting's audio
+ * Each stream (audio type + node_id) gets its own pipeline state, and the stages
+ * run before the callback on whichever thread delivers the frame, outside the
+ * slow consumer budget. Changing the pipeline restarts the state of every stream,
+ * and a stream without frames for 30 s gives its state up. Frames held back as
+ * silence count in zoom_audio_pipeline_gated_total, not as drops
+ * @param meeting_handle The meeting handle
+ * @param pipeline The preset
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_meeting_set_audio_pipeline(MeetingHandle meeting_handle, ZoomAudioPipeline pipeline);
+
+/**
+ * Configure the slow consumer watchdog of a meeting
+ * Every audio and video callback is timed. A callback over budget logs a warning
+ * (at most one per meeting every 10 seconds); after policy->strikes overruns in a
+ * row the meeting switches delivery mode as the action says. Switching only
+ * happens from ZOOM_DELIVERY_INLINE
+ * @param meeting_handle The meeting handle
+ * @param policy The watchdog settings, NULL to restore the defaults
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_meeting_set_slow_consumer_policy(MeetingHandle meeting_handle, const ZoomSlowConsumerPolicy* policy);
+
+/**
+ * Get the slow consumer watchdog counters of a meeting
+ * @param meeting_handle The meeting handle
+ * @param stats Receives the counters
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_meeting_get_slow_consumer_stats(MeetingHandle meeting_handle, ZoomSlowConsumerStats* stats);
+
+/**
+ * Get the join timeline of a meeting, including time-to-first-audio and time-to-first-video
+ * Each step is also recorded in the zoom_join_step_seconds histogram and the trace
+ * @param meeting_handle The meeting handle
+ * @param timeline Receives the step times
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_meeting_get_timeline(MeetingHandle meeting_handle, ZoomMeetingTimeline* timeline);
+
+/**
+ * Start writing every raw audio and video callback of a meeting to a capture file
+ * Each record holds the frame type, node or source id, arrival time and payload;
+ * see src/util/MediaCapture.h for the format. Disk writes happen on a background
+ * thread. Setting ZOOM_SDK_CAPTURE=<path> captures every meeting from its creation;
+ * "%p" in the path is replaced by the process id and "%m" by the meeting id
+ * @param meeting_handle The meeting handle
+ * @param path Capture file, replaced if it exists
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_meeting_start_capture(MeetingHandle meeting_handle, const char* path);
+
+/**
+ * Stop capturing a meeting's media and flush the capture file
+ * @param meeting_handle The meeting handle
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_meeting_stop_capture(MeetingHandle meeting_handle);
+
+/**
+ * Feed a capture file through a meeting's delivery path
+ * Frames are dispatched as zoom_meeting_dispatch_audio()/zoom_meeting_dispatch_video()
+ * would from the SDK thread, through the delivery mode, watchdog and metrics, to the
+ * registered callbacks. Blocks the calling thread until the capture ends
+ * @param meeting_handle The meeting handle
+ * @param path Capture file from zoom_meeting_start_capture()
+ * @param speed 1.0 keeps the captured pacing, 2.0 replays twice as fast, 0 as fast as possible
+ * @param frames Receives the number of frames replayed (can be NULL)
+ * @return ZoomSDKResult indicating success, or failure if the arguments are invalid, the
+ * file is not a capture, or replay stopped at a truncated or corrupt record
+ */
+ZoomSDKResult zoom_meeting_replay_capture(MeetingHandle meeting_handle, const char* path, double speed,
+                                          unsigned long long* frames);
+
+/**
+ * Get utilization counters of the media worker pool
+ * @param stats Array that receives one entry per worker (can be NULL)
+ * @param max_workers Capacity of the stats array
+ * @return Number of workers in the pool, 0 if the pool has not started
+ */
+int zoom_sdk_get_media_worker_stats(ZoomMediaWorkerStats* stats, int max_workers);
+
+/**
+ * Get the number of frames dropped because a stream queue in the worker pool was full
+ * @return Total dropped frames since the pool started
+ */
+unsigned long long zoom_sdk_get_media_dropped_frames();
+
+/**
+ * Set affinity and scheduling for a class of library threads
+ * ZOOM_THREAD_SDK_DISPATCH options apply to every SDK thread delivering raw data, from the
+ * next frame it hands over; the SDK shares these threads between meetings, so they are process-wide.
+ * ZOOM_THREAD_MEDIA_WORKER options must be set before the pool starts; cpus, if given,
+ * replace ZoomMediaWorkerConfig.cpus (worker i is pinned to cpus[i % cpu_count]).
+ * ZOOM_THREAD_LOG_WRITER options apply the next time async logging is enabled.
+ * Failures to apply a policy at runtime (e.g. EPERM for SCHED_FIFO) are logged, not fatal.
+ * @param role The thread class
+ * @param options The options, NULL to reset to defaults
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_sdk_set_thread_options(ZoomThreadRole role, const ZoomThreadOptions* options);
+
+/**
+ * Switch library logging between synchronous and asynchronous output
+ * In async mode logging threads only enqueue the message into a lock-free ring;
+ * a background thread formats and writes in batches. Messages are dropped
+ * (and counted) rather than blocking when the ring is full.
+ * @param enable 1 for async, 0 to drain the ring and return to synchronous output
+ * @param queue_capacity ring size in messages, 0 for the default (8192);
+ *                       only the first enable allocates the ring
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_sdk_set_async_logging(int enable, int queue_capacity);
+
+/**
+ * Get the number of log messages dropped because the async ring was full
+ * @return Total dropped messages since the process started
+ */
+unsigned long long zoom_sdk_get_dropped_log_messages();
+
+/**
+ * Render all library metrics in the Prometheus text exposition format
+ * Covers frames and bytes in/out per type, drops by reason, consumer callback
+ * durations, audio subscribe retries, auth and join latency, live handles
+ * @param buffer Receives the NUL-terminated text, truncated to fit (can be NULL)
+ * @param buffer_size Capacity of buffer in bytes
+ * @return Length of the full text without the terminator; call again with a
+ *         bigger buffer if it is >= buffer_size
+ */
+int zoom_sdk_get_metrics_text(char* buffer, int buffer_size);
+
+/**
+ * Get a structured snapshot of all library metrics
+ * The name and labels strings stay valid for the life of the process
+ * @param samples Array that receives one entry per metric series (can be NULL)
+ * @param max_samples Capacity of the samples array
+ * @return Number of metric series, which may exceed max_samples
+ */
+int zoom_sdk_get_metrics(ZoomMetricSample* samples, int max_samples);
+
+/**
+ * Get the memory the library holds in its own buffers, pools and queues
+ * Subsystem totals come first, then one entry per live meeting and subsystem
+ * that accounts per meeting (frame copies queued for the media workers). The
+ * totals are also exported as zoom_native_memory_bytes, zoom_native_memory_peak_bytes
+ * and zoom_native_allocations_total. Memory of the Zoom SDK itself is not included
+ * @param stats Array that receives the entries (can be NULL)
+ * @param max_entries Capacity of the stats array
+ * @return Number of entries, which may exceed max_entries
+ */
+int zoom_sdk_get_memory_stats(ZoomMemoryStats* stats, int max_entries);
+
+/**
+ * Get the ingress time of the frame being delivered
+ * Stamped when the SDK handed the frame to the library, before any queueing;
+ * compare with zoom_sdk_monotonic_ns() (or any CLOCK_MONOTONIC reading) to
+ * measure the delay added up to the consumer
+ * @return CLOCK_MONOTONIC nanoseconds, or 0 when not called from an audio or video callback
+ */
+unsigned long long zoom_frame_ingress_ns();
+
+/**
+ * Read the clock used for frame ingress times
+ * @return CLOCK_MONOTONIC nanoseconds
+ */
+unsigned long long zoom_sdk_monotonic_ns();
+
+/**
+ * Start recording a Chrome trace of the SDK lifecycle
+ * Spans cover InitSDK, service creation, JWT generation, SDK auth, meeting join,
+ * the recording privilege grant and the first audio frame. Open the file in
+ * ui.perfetto.dev or chrome://tracing. Setting ZOOM_SDK_TRACE=<path> has the same
+ * effect from process start; "%p" in the path is replaced by the process id
+ * @param path File the trace is written to
+ * @return ZoomSDKResult indicating success or failure
  */
-void zoom_sdk_stop_loop();
+ZoomSDKResult zoom_sdk_enable_tracing(const char* path);
+
+/**
+ * Write the events recorded so far to the trace file, recording continues
+ * Also happens at normal process exit; call it before exiting through a path that
+ * skips static destructors
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_sdk_write_trace();
+
+/**
+ * Write the trace file and stop recording
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_sdk_disable_tracing();
+
+/**
+ * Dump the flight recorder when the process crashes or receives SIGUSR1
+ * The recorder always keeps the last 4096 native events (status changes, auth,
+ * subscribe results, drops, slow callbacks, delivery mode switches). This installs
+ * handlers for SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT and SIGUSR1 that write it
+ * to path and then hand the signal to the previously installed handler. When that
+ * handler may recover (the Go runtime does for faults in Go code), a crash signal
+ * is dumped to the first free "<path>.<n>" instead, at most 16 of them. Setting
+ * ZOOM_SDK_FLIGHT_RECORDER=<path> installs them on the first zoom_sdk_create()
+ * @param path Dump file; "%p" is replaced by the process id
+ * @return ZoomSDKResult indicating success, or failure if already installed
+ */
+ZoomSDKResult zoom_sdk_enable_flight_recorder(const char* path);
+
+/**
+ * Write the flight recorder to a file now
+ * Text, one event per line, oldest first: monotonic ns, thread id, event,
+ * meeting handle and two event specific values
+ * @param path Dump file
+ * @return ZoomSDKResult indicating success or failure
+ */
+ZoomSDKResult zoom_sdk_dump_flight_recorder(const char* path);
+
+/**
+ * Load a media plugin (see zoom_sdk_plugin.h for the ABI)
+ * Its process_frame sees every audio and/or video frame of every meeting on the SDK
+ * thread, before the consumer callback and without a copy. Plugins run in load order.
+ * Setting ZOOM_SDK_PLUGINS to "path[=config];..." loads plugins on the first zoom_sdk_create()
+ * @param path Shared object to dlopen
+ * @param config String passed to the plugin's init, NULL for ""
+ * @param budget Time budget, NULL for the defaults
+ * @return ZoomSDKResult indicating success, or failure if the library, entry point or ABI
+ * version is unusable, init failed, or a plugin with the same name is loaded
+ */
+ZoomSDKResult zoom_sdk_load_plugin(const char* path, const char* config, const ZoomPluginBudget* budget);
+
+/**
+ * Flush and unload a media plugin
+ * Blocks until frames already inside the plugin finish, then flushes, shuts down and
+ * closes it on the calling thread. Do not call it from the plugin itself
+ * @param name Name the plugin reported
+ * @return ZoomSDKResult indicating success, or failure if no such plugin is loaded
+ */
+ZoomSDKResult zoom_sdk_unload_plugin(const char* name);
+
+/**
+ * Get the counters of the loaded media plugins, in load order
+ * @param stats Array to fill, can be NULL to only count
+ * @param max_plugins Capacity of stats
+ * @return Number of loaded plugins
+ */
+int zoom_sdk_get_plugin_stats(ZoomPluginStats* stats, int max_plugins);
 
 // Internal functions used by delegates - not part of public API
-void zoom_meeting_dispatch_audio(MeetingHandle meeting_handle, const void* data, int length, int type, unsigned int node_id);
+// ingress_ns is the CLOCK_MONOTONIC time the delegate received the frame
+void zoom_meeting_dispatch_audio(MeetingHandle meeting_handle, const void* data, int length, int type, unsigned int node_id,
+                                 unsigned long long ingress_ns);
 void zoom_meeting_dispatch_video(MeetingHandle meeting_handle, 
                                  const char* y_buffer, const char* u_buffer, const char* v_buffer,
                                  unsigned int width, unsigned int height,
                                  unsigned int buffer_len, unsigned int source_id,
-                                 unsigned long long timestamp);
+                                 unsigned long long timestamp, unsigned long long ingress_ns);
+
+#if defined(__GNUC__)
+#pragma GCC visibility pop
+#endif
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,122 @@
+#ifndef ZOOM_SDK_PLUGIN_H
+#define ZOOM_SDK_PLUGIN_H
+
+/*
+ * ABI of in-process media plugins
+ *
+ * A plugin is a shared object loaded with zoom_sdk_load_plugin() (or the
+ * ZOOM_SDK_PLUGINS environment variable). It exports one function,
+ *
+ *   const ZoomPlugin* zoom_plugin_entry(unsigned int host_abi_version);
+ *
+ * which returns a static descriptor, or NULL if the plugin cannot run on that
+ * host. The plugin only needs this header: host services are passed in
+ * ZoomPluginHost, so it does not link against libzoomsdk_c.
+ *
+ * Versioning: the major version changes when existing fields or semantics
+ * change, the minor version when fields are appended to the structs below.
+ * A plugin loads if its major version equals the host's and its minor
+ * version is not newer. Structs passed by the host start with struct_size,
+ * so a plugin built against a newer minor can check which fields exist.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ZOOM_PLUGIN_ABI_MAJOR 1
+#define ZOOM_PLUGIN_ABI_MINOR 0
+#define ZOOM_PLUGIN_ABI_VERSION ((ZOOM_PLUGIN_ABI_MAJOR << 16) | ZOOM_PLUGIN_ABI_MINOR)
+
+#define ZOOM_PLUGIN_ENTRY_SYMBOL "zoom_plugin_entry"
+
+// Frame kinds, also combined as the mask of frames a plugin wants
+#define ZOOM_PLUGIN_AUDIO 0x1u
+#define ZOOM_PLUGIN_VIDEO 0x2u
+
+// process_frame results
+#define ZOOM_PLUGIN_CONTINUE 0  // Deliver the frame to the next plugin and the consumer callback
+#define ZOOM_PLUGIN_DROP 1      // The plugin consumed the frame; it is not delivered further
+
+// Log levels of ZoomPluginHost.log
+#define ZOOM_PLUGIN_LOG_DEBUG 0
+#define ZOOM_PLUGIN_LOG_INFO 1
+#define ZOOM_PLUGIN_LOG_WARN 2
+#define ZOOM_PLUGIN_LOG_ERROR 3
+
+// View of one frame, pointing into the SDK's buffers; valid only during process_frame
+typedef struct {
+    unsigned int struct_size;       // sizeof(ZoomPluginFrame) in the host
+    unsigned int kind;              // ZOOM_PLUGIN_AUDIO or ZOOM_PLUGIN_VIDEO
+    void* meeting;                  // MeetingHandle the frame belongs to
+    unsigned long long ingress_ns;  // CLOCK_MONOTONIC time the SDK delivered the frame
+
+    // Audio: 16-bit mono PCM
+    const void* data;
+    int length;                     // Bytes
+    int audio_type;                 // ZOOM_AUDIO_TYPE_*
+    unsigned int node_id;
+
+    // Video: I420 planes
+    const char* y_buffer;
+    const char* u_buffer;
+    const char* v_buffer;
+    unsigned int width;
+    unsigned int height;
+    unsigned int buffer_len;
+    unsigned int source_id;
+    unsigned long long timestamp;
+} ZoomPluginFrame;
+
+// Services of the host, valid until shutdown returns
+typedef struct {
+    unsigned int struct_size;       // sizeof(ZoomPluginHost) in the host
+    unsigned int abi_version;       // ZOOM_PLUGIN_ABI_VERSION of the host
+
+    // Write to the libzoomsdk_c log, prefixed with the plugin name
+    void (*log)(const void* plugin, int level, const char* message);
+    const void* plugin;             // First argument of log
+
+    // CLOCK_MONOTONIC in nanoseconds, the clock of ingress_ns
+    unsigned long long (*monotonic_ns)(void);
+} ZoomPluginHost;
+
+/*
+ * Descriptor returned by zoom_plugin_entry
+ *
+ * process_frame runs on the thread that received the frame from the SDK,
+ * before the consumer callback, and is timed against the plugin's budget
+ * once it returns: after too many overruns in a row the plugin is suspended
+ * for a while and its frames skip it. The budget only bounds a plugin that is
+ * slow again and again; nothing interrupts a call, so one that blocks or
+ * loops holds up the SDK thread, the other plugins and the consumer for as
+ * long as it runs. Calls for different meetings can run concurrently; frames
+ * of one stream arrive in order and never concurrently.
+ */
+typedef struct {
+    unsigned int abi_version;       // ZOOM_PLUGIN_ABI_VERSION the plugin was built with
+    const char* name;               // Unique among loaded plugins
+    unsigned int frame_kinds;       // ZOOM_PLUGIN_AUDIO | ZOOM_PLUGIN_VIDEO
+
+    // Called once after loading; config is the string given at load (never NULL).
+    // Returns 0 on success, anything else aborts loading
+    int (*init)(const ZoomPluginHost* host, const char* config, void** state);
+
+    // Returns ZOOM_PLUGIN_CONTINUE or ZOOM_PLUGIN_DROP
+    int (*process_frame)(void* state, const ZoomPluginFrame* frame);
+
+    // Emit anything buffered for a meeting that is being destroyed, or for
+    // all meetings (meeting == NULL) before unloading. May be NULL
+    void (*flush)(void* state, void* meeting);
+
+    // Release state; no other call follows. May be NULL
+    void (*shutdown)(void* state);
+} ZoomPlugin;
+
+typedef const ZoomPlugin* (*ZoomPluginEntry)(unsigned int host_abi_version);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ZOOM_SDK_PLUGIN_H
@@ -0,0 +1,366 @@
+#include "zoom_sdk_plugin_host.h"
+#include "util/FlightRecorder.h"
+#include "util/Logger.h"
+#include "util/Metrics.h"
+
+#include <dlfcn.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+// A plugin library with its instance state, budget and counters
+class LoadedPlugin {
+public:
+    static constexpr uint64_t kDefaultBudgetNs = 1'000'000;
+    static constexpr uint32_t kDefaultStrikes = 3;
+    static constexpr uint64_t kDefaultSuspendNs = 10'000'000'000;
+
+    LoadedPlugin(void* library, const ZoomPlugin* plugin, const ZoomPluginBudget* budget)
+        : name(plugin->name)
+        , m_library(library)
+        , m_frameKinds(plugin->frame_kinds)
+        , m_init(plugin->init)
+        , m_processFrame(plugin->process_frame)
+        , m_flush(plugin->flush)
+        , m_shutdown(plugin->shutdown)
+        , m_budgetNs(budget && budget->budget_us ? budget->budget_us * 1000ULL : kDefaultBudgetNs)
+        , m_strikeLimit(budget && budget->strikes ? budget->strikes : kDefaultStrikes)
+        , m_suspendNs(budget && budget->suspend_ms ? budget->suspend_ms * 1000000ULL : kDefaultSuspendNs)
+        , m_duration(Util::MetricsRegistry::getInstance().histogram(
+              "zoom_plugin_process_seconds", "Time spent in a media plugin's process_frame",
+              "plugin=\"" + name + "\"", 1e-9))
+        , m_overrunCounter(Util::MetricsRegistry::getInstance().counter(
+              "zoom_plugin_overruns_total", "Media plugin calls over the plugin's time budget",
+              "plugin=\"" + name + "\"")) {
+        m_host.struct_size = sizeof(ZoomPluginHost);
+        m_host.abi_version = ZOOM_PLUGIN_ABI_VERSION;
+        m_host.log = &LoadedPlugin::hostLog;
+        m_host.plugin = this;
+        m_host.monotonic_ns = []() -> unsigned long long { return Util::monotonicNs(); };
+    }
+
+    ~LoadedPlugin() { close(); }
+
+    LoadedPlugin(const LoadedPlugin&) = delete;
+    LoadedPlugin& operator=(const LoadedPlugin&) = delete;
+
+    bool init(const char* config) {
+        int result = m_init(&m_host, config ? config : "", &m_state);
+        if (result != 0) {
+            ZLOG_ERROR("Plugin {} failed to initialize ({})", name, result);
+            return false;
+        }
+        m_initialized = true;
+        return true;
+    }
+
+    bool wants(unsigned int kind) const { return (m_frameKinds & kind) != 0; }
+
+    /**
+     * Stop taking frames, wait for the ones already inside the plugin, then
+     * flush, shut down and unload it on the calling thread. Frames that still
+     * hold a snapshot with this plugin skip it from here on
+     */
+    void retire() {
+        m_retired.store(true);
+        for (uint32_t n = m_inFlight.load(); n != 0; n = m_inFlight.load()) {
+            m_inFlight.wait(n);
+        }
+        close();
+    }
+
+    // Runs process_frame unless suspended or retired, and enforces the budget
+    int process(const ZoomPluginFrame& frame) {
+        InFlight guard(*this);
+        if (!guard) {
+            return ZOOM_PLUGIN_CONTINUE;
+        }
+
+        uint64_t start = Util::monotonicNs();
+        uint64_t until = m_suspendedUntilNs.load(std::memory_order_relaxed);
+        if (until != 0) {
+            if (start < until) {
+                m_skipped.fetch_add(1, std::memory_order_relaxed);
+                return ZOOM_PLUGIN_CONTINUE;
+            }
+            if (m_suspendedUntilNs.compare_exchange_strong(until, 0, std::memory_order_relaxed)) {
+                m_strikes.store(0, std::memory_order_relaxed);
+                ZLOG_INFO("Plugin {} resumed", name);
+            }
+        }
+
+        int result = m_processFrame(m_state, &frame);
+        uint64_t end = Util::monotonicNs();
+        uint64_t duration = end - start;
+
+        m_frames.fetch_add(1, std::memory_order_relaxed);
+        m_totalNs.fetch_add(duration, std::memory_order_relaxed);
+        m_duration.record(duration);
+        uint64_t max = m_maxNs.load(std::memory_order_relaxed);
+        while (duration > max && !m_maxNs.compare_exchange_weak(max, duration, std::memory_order_relaxed)) {
+        }
+        if (result == ZOOM_PLUGIN_DROP) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (duration <= m_budgetNs) {
+            m_strikes.store(0, std::memory_order_relaxed);
+        } else {
+            overrun(frame, duration, end);
+        }
+        return result;
+    }
+
+    void flush(MeetingHandle meeting) {
+        InFlight guard(*this);
+        if (guard && m_flush) m_flush(m_state, meeting);
+    }
+
+    ZoomPluginStats stats() const {
+        ZoomPluginStats s{};
+        std::strncpy(s.name, name.c_str(), sizeof(s.name) - 1);
+        s.frames = m_frames.load(std::memory_order_relaxed);
+        s.dropped = m_dropped.load(std::memory_order_relaxed);
+        s.skipped = m_skipped.load(std::memory_order_relaxed);
+        s.overruns = m_overruns.load(std::memory_order_relaxed);
+        s.total_ns = m_totalNs.load(std::memory_order_relaxed);
+        s.max_ns = m_maxNs.load(std::memory_order_relaxed);
+        s.suspensions = m_suspensions.load(std::memory_order_relaxed);
+        s.suspended = m_suspendedUntilNs.load(std::memory_order_relaxed) > Util::monotonicNs() ? 1 : 0;
+        return s;
+    }
+
+    const std::string name;
+
+private:
+    // Counts a call into the plugin; false once the plugin is retired
+    class InFlight {
+    public:
+        explicit InFlight(LoadedPlugin& plugin) : m_plugin(plugin) {
+            m_plugin.m_inFlight.fetch_add(1);
+            m_entered = !m_plugin.m_retired.load();
+        }
+        ~InFlight() {
+            if (m_plugin.m_inFlight.fetch_sub(1) == 1 && m_plugin.m_retired.load()) {
+                m_plugin.m_inFlight.notify_all();
+            }
+        }
+        InFlight(const InFlight&) = delete;
+        InFlight& operator=(const InFlight&) = delete;
+
+        explicit operator bool() const { return m_entered; }
+
+    private:
+        LoadedPlugin& m_plugin;
+        bool m_entered;
+    };
+
+    void close() {
+        if (!m_library) return;
+        if (m_initialized) {
+            if (m_flush) m_flush(m_state, nullptr);
+            if (m_shutdown) m_shutdown(m_state);
+        }
+        dlclose(m_library);
+        m_library = nullptr;
+    }
+
+    void overrun(const ZoomPluginFrame& frame, uint64_t duration, uint64_t end) {
+        m_overruns.fetch_add(1, std::memory_order_relaxed);
+        m_overrunCounter.add();
+        if (m_strikes.fetch_add(1, std::memory_order_relaxed) + 1 < m_strikeLimit) {
+            return;
+        }
+
+        // Only the call that actually starts the suspension reports it
+        uint64_t expected = 0;
+        if (!m_suspendedUntilNs.compare_exchange_strong(expected, end + m_suspendNs, std::memory_order_relaxed)) {
+            return;
+        }
+        m_suspensions.fetch_add(1, std::memory_order_relaxed);
+        Util::FlightRecorder::getInstance().record("plugin_suspended", frame.meeting, static_cast<int64_t>(duration),
+                                                   static_cast<int64_t>(m_suspensions.load()));
+        ZLOG_WARN("Plugin {} exceeded its {} us budget {} times in a row (last call {} us), suspended for {} ms", name,
+                  m_budgetNs / 1000, m_strikeLimit, duration / 1000, m_suspendNs / 1000000);
+    }
+
+    static void hostLog(const void* plugin, int level, const char* message) {
+        auto* self = static_cast<const LoadedPlugin*>(plugin);
+        Util::LogLevel logLevel = level <= ZOOM_PLUGIN_LOG_DEBUG ? Util::LogLevel::DEBUG
+                                : level == ZOOM_PLUGIN_LOG_INFO  ? Util::LogLevel::INFO
+                                : level == ZOOM_PLUGIN_LOG_WARN  ? Util::LogLevel::WARN
+                                                                 : Util::LogLevel::ERROR;
+        auto& logger = Util::Logger::getInstance();
+        if (logger.isEnabled(logLevel)) {
+            logger.log(logLevel, Util::format("[plugin {}] {}", self ? self->name : "?", message ? message : ""));
+        }
+    }
+
+    void* m_library;
+
+    // Copied from the descriptor, which lives in the library and goes away
+    // with it: frames holding an old snapshot still call wants() after close()
+    const unsigned int m_frameKinds;
+    decltype(ZoomPlugin::init) const m_init;
+    decltype(ZoomPlugin::process_frame) const m_processFrame;
+    decltype(ZoomPlugin::flush) const m_flush;
+    decltype(ZoomPlugin::shutdown) const m_shutdown;
+
+    ZoomPluginHost m_host{};
+    void* m_state = nullptr;
+    bool m_initialized = false;
+
+    const uint64_t m_budgetNs;
+    const uint32_t m_strikeLimit;
+    const uint64_t m_suspendNs;
+
+    Util::Histogram& m_duration;
+    Util::Counter& m_overrunCounter;
+
+    std::atomic<uint64_t> m_frames{0};
+    std::atomic<uint64_t> m_dropped{0};
+    std::atomic<uint64_t> m_skipped{0};
+    std::atomic<uint64_t> m_overruns{0};
+    std::atomic<uint64_t> m_totalNs{0};
+    std::atomic<uint64_t> m_maxNs{0};
+    std::atomic<uint32_t> m_strikes{0};
+    std::atomic<uint32_t> m_suspensions{0};
+    std::atomic<uint64_t> m_suspendedUntilNs{0};
+
+    // Calls inside the plugin, and whether unload() has taken it out of service
+    std::atomic<uint32_t> m_inFlight{0};
+    std::atomic<bool> m_retired{false};
+};
+
+PluginRegistry& PluginRegistry::getInstance() {
+    static PluginRegistry instance;
+    return instance;
+}
+
+void PluginRegistry::publish(std::shared_ptr<const PluginList> plugins) {
+    size_t count = plugins->size();
+    m_plugins.store(std::move(plugins), std::memory_order_release);
+    m_count.store(count, std::memory_order_relaxed);
+}
+
+bool PluginRegistry::load(const char* path, const char* config, const ZoomPluginBudget* budget) {
+    std::lock_guard<std::mutex> loadLock(m_loadMutex);
+
+    void* library = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    if (!library) {
+        ZLOG_ERROR("Cannot load plugin {}: {}", path, dlerror());
+        return false;
+    }
+    auto entry = reinterpret_cast<ZoomPluginEntry>(dlsym(library, ZOOM_PLUGIN_ENTRY_SYMBOL));
+    const ZoomPlugin* plugin = entry ? entry(ZOOM_PLUGIN_ABI_VERSION) : nullptr;
+
+    const char* problem = nullptr;
+    if (!entry) {
+        problem = "no " ZOOM_PLUGIN_ENTRY_SYMBOL " symbol";
+    } else if (!plugin) {
+        problem = "the plugin declined this host";
+    } else if ((plugin->abi_version >> 16) != ZOOM_PLUGIN_ABI_MAJOR ||
+               (plugin->abi_version & 0xffff) > ZOOM_PLUGIN_ABI_MINOR) {
+        problem = "incompatible ABI version";
+    } else if (!plugin->name || !*plugin->name || !plugin->init || !plugin->process_frame) {
+        problem = "incomplete descriptor";
+    }
+    if (problem) {
+        ZLOG_ERROR("Cannot load plugin {}: {} (host ABI {}.{}, plugin {}.{})", path, problem, ZOOM_PLUGIN_ABI_MAJOR,
+                   ZOOM_PLUGIN_ABI_MINOR, plugin ? plugin->abi_version >> 16 : 0,
+                   plugin ? plugin->abi_version & 0xffff : 0);
+        dlclose(library);
+        return false;
+    }
+
+    auto current = snapshot();
+    for (const auto& loaded : *current) {
+        if (loaded->name == plugin->name) {
+            ZLOG_ERROR("Cannot load plugin {}: a plugin named {} is already loaded", path, plugin->name);
+            dlclose(library);
+            return false;
+        }
+    }
+
+    auto loaded = std::make_shared<LoadedPlugin>(library, plugin, budget);
+    if (!loaded->init(config)) {
+        return false;
+    }
+
+    auto next = std::make_shared<PluginList>(*current);
+    next->push_back(loaded);
+    publish(std::move(next));
+    Util::FlightRecorder::getInstance().record("plugin_load", nullptr, static_cast<int64_t>(m_count.load()));
+    ZLOG_INFO("Loaded plugin {} from {} (ABI {}.{})", loaded->name, path, plugin->abi_version >> 16,
+              plugin->abi_version & 0xffff);
+    return true;
+}
+
+bool PluginRegistry::unload(const std::string& name) {
+    std::lock_guard<std::mutex> loadLock(m_loadMutex);
+    auto current = snapshot();
+    auto next = std::make_shared<PluginList>(*current);
+    auto it = std::find_if(next->begin(), next->end(), [&](const auto& p) { return p->name == name; });
+    if (it == next->end()) {
+        return false;
+    }
+    auto removed = *it;
+    next->erase(it);
+    current.reset();
+    publish(std::move(next));
+    // Frames that took the previous list may still reach the plugin; it is
+    // unloaded here rather than by whichever thread lets go of it last
+    removed->retire();
+    Util::FlightRecorder::getInstance().record("plugin_unload", nullptr, static_cast<int64_t>(m_count.load()));
+    ZLOG_INFO("Unloaded plugin {}", name);
+    return true;
+}
+
+void PluginRegistry::loadFromEnv() {
+    std::call_once(m_envOnce, [this]() {
+        const char* env = std::getenv("ZOOM_SDK_PLUGINS");
+        if (!env) return;
+        std::string list(env);
+        size_t begin = 0;
+        while (begin <= list.size()) {
+            size_t end = list.find(';', begin);
+            if (end == std::string::npos) end = list.size();
+            std::string item = list.substr(begin, end - begin);
+            begin = end + 1;
+            if (item.empty()) continue;
+
+            size_t eq = item.find('=');
+            std::string path = item.substr(0, eq);
+            std::string config = eq == std::string::npos ? "" : item.substr(eq + 1);
+            load(path.c_str(), config.c_str(), nullptr);
+        }
+    });
+}
+
+bool PluginRegistry::process(const ZoomPluginFrame& frame) {
+    auto plugins = snapshot();
+    for (const auto& plugin : *plugins) {
+        if (plugin->wants(frame.kind) && plugin->process(frame) == ZOOM_PLUGIN_DROP) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void PluginRegistry::flushMeeting(MeetingHandle meeting) {
+    if (empty()) return;
+    auto plugins = snapshot();
+    for (const auto& plugin : *plugins) {
+        plugin->flush(meeting);
+    }
+}
+
+std::vector<ZoomPluginStats> PluginRegistry::stats() const {
+    auto plugins = snapshot();
+    std::vector<ZoomPluginStats> result;
+    result.reserve(plugins->size());
+    for (const auto& plugin : *plugins) {
+        result.push_back(plugin->stats());
+    }
+    return result;
+}
@@ -0,0 +1,55 @@
+
+#ifndef ZOOM_SDK_PLUGIN_HOST_H
+#define ZOOM_SDK_PLUGIN_HOST_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "zoom_sdk_c.h"
+#include "zoom_sdk_plugin.h"
+
+class LoadedPlugin;
+
+// Media plugins loaded into the process, see zoom_sdk_load_plugin()
+class PluginRegistry {
+public:
+    static PluginRegistry& getInstance();
+
+    // Checked on every frame, so a process without plugins pays one relaxed load
+    bool empty() const { return m_count.load(std::memory_order_relaxed) == 0; }
+
+    bool load(const char* path, const char* config, const ZoomPluginBudget* budget);
+    bool unload(const std::string& name);
+
+    // Loads the plugins listed in ZOOM_SDK_PLUGINS, once per process
+    void loadFromEnv();
+
+    /**
+     * Run the plugins that want this kind of frame, in load order
+     * @return false if a plugin dropped the frame
+     */
+    bool process(const ZoomPluginFrame& frame);
+
+    // Flush every plugin for a meeting that is going away
+    void flushMeeting(MeetingHandle meeting);
+
+    std::vector<ZoomPluginStats> stats() const;
+
+private:
+    using PluginList = std::vector<std::shared_ptr<LoadedPlugin>>;
+
+    PluginRegistry() : m_plugins(std::make_shared<const PluginList>()) {}
+
+    // The list is replaced, never changed, so frames run on a snapshot without taking a lock
+    std::shared_ptr<const PluginList> snapshot() const { return m_plugins.load(std::memory_order_acquire); }
+    void publish(std::shared_ptr<const PluginList> plugins);
+
+    std::mutex m_loadMutex;  // Serializes load and unload
+    std::atomic<std::shared_ptr<const PluginList>> m_plugins;
+    std::atomic<size_t> m_count{0};
+    std::once_flag m_envOnce;
+};
+
+#endif // ZOOM_SDK_PLUGIN_HOST_H
@@ -1,4 +1,6 @@
 #include "zoom_sdk_video_delegate.h"
+#include "util/Metrics.h"
+#include "util/Probes.h"
 
 void ZoomSDKVideoRendererDelegate::onRendererBeDestroyed() {
     // Renderer is being destroyed, cleanup if needed
@@ -6,6 +8,9 @@ void ZoomSDKVideoRendererDelegate::onRendererBeDestroyed() {
 
 void ZoomSDKVideoRendererDelegate::onRawDataFrameReceived(YUVRawDataI420* data) {
     if (!data) return;
+    uint64_t ingress = Util::monotonicNs();
+    m_timeline->mark(MeetingTimeline::FIRST_VIDEO, ingress);
+    m_dispatchThread->bindCurrentThread();
     
     // Get YUV frame data
     char* yBuffer = data->GetYBuffer();
@@ -16,11 +21,15 @@ void ZoomSDKVideoRendererDelegate::onRawDataFrameReceived(YUVRawDataI420* data)
     unsigned int bufferLen = data->GetBufferLen();
     unsigned int sourceId = data->GetSourceID();
     unsigned long long timestamp = data->GetTimeStamp();
+    ZPROBE(video_frame, m_meetingHandle, sourceId, width, height, ingress);
     
     if (yBuffer && uBuffer && vBuffer && bufferLen > 0) {
+        if (m_capture->isActive()) {
+            m_capture->recordVideo(sourceId, ingress, width, height, timestamp, yBuffer, uBuffer, vBuffer);
+        }
         // Dispatch video frame to C API callback
         zoom_meeting_dispatch_video(m_meetingHandle, yBuffer, uBuffer, vBuffer, 
-                                    width, height, bufferLen, sourceId, timestamp);
+                                    width, height, bufferLen, sourceId, timestamp, ingress);
     }
 }
 
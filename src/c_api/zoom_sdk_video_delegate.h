@@ -5,12 +5,19 @@
 #include "zoom_sdk_raw_data_def.h"
 #include "rawdata/rawdata_renderer_interface.h"
 #include "zoom_sdk_c.h"
+#include "MeetingTimeline.h"
+#include "util/MediaCapture.h"
+#include "util/ThreadOptions.h"
 
 
 class ZoomSDKVideoRendererDelegate : public ZOOMSDK::IZoomSDKRendererDelegate {
 public:
-    explicit ZoomSDKVideoRendererDelegate(MeetingHandle meetingHandle)
-        : m_meetingHandle(meetingHandle) {}
+    ZoomSDKVideoRendererDelegate(MeetingHandle meetingHandle, Util::ThreadBinding* dispatchThread,
+                                 MeetingTimeline* timeline, Util::MediaCaptureWriter* capture)
+        : m_meetingHandle(meetingHandle)
+        , m_dispatchThread(dispatchThread)
+        , m_timeline(timeline)
+        , m_capture(capture) {}
 
     void onRendererBeDestroyed() override;
     void onRawDataFrameReceived(YUVRawDataI420* data) override;
@@ -18,6 +25,9 @@ public:
 
 private:
     MeetingHandle m_meetingHandle;
+    Util::ThreadBinding* m_dispatchThread;
+    MeetingTimeline* m_timeline;
+    Util::MediaCaptureWriter* m_capture;
 };
 
 #endif // ZOOM_SDK_VIDEO_DELEGATE_H
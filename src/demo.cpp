@@ -48,15 +48,6 @@ void onSignal(int signal) {
 }
 
 
-/**
- * Callback for glib event loop
- * @param data event data
- * @return always TRUE
- */
-gboolean onTimeout (gpointer data) {
-    return TRUE;
-}
-
 /**
  * Demo function showing different ways to create meetings on the fly
  */
@@ -80,7 +71,7 @@ void createMultipleMeetings() {
         meeting1->join();
     }
 
-    Util::Logger::getInstance().success("Created " + to_string(g_meetings.size()) + " meetings successfully!");
+    ZLOG_SUCCESS("Created {} meetings successfully!", g_meetings.size());
 }
 
 /**
@@ -126,9 +117,8 @@ int main(int argc, char **argv) {
     if (err != SDKERR_SUCCESS)
         return err;
 
-    // Use an event loop to receive callbacks
+    // Use an event loop to receive callbacks; no periodic timer so an idle bot stays asleep
     g_eventLoop = g_main_loop_new(NULL, FALSE);
-    g_timeout_add(100, onTimeout, g_eventLoop);
     g_main_loop_run(g_eventLoop);
 
     return err;
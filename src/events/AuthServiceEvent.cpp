@@ -1,11 +1,15 @@
 #include "AuthServiceEvent.h"
+#include "util/FlightRecorder.h"
 #include "util/Logger.h"
+#include "util/Probes.h"
 
 AuthServiceEvent::AuthServiceEvent(std::function<void()> onAuth) {
     m_onAuth = std::move(onAuth);
 }
 
 void AuthServiceEvent::onAuthenticationReturn(ZOOMSDK::AuthResult result) {
+    ZPROBE(auth_result, static_cast<int>(result));
+    Util::FlightRecorder::getInstance().record("auth_result", nullptr, result);
     std::stringstream message;
     message << "authentication failed because the ";
 
@@ -0,0 +1,29 @@
+#include "MeetingAudioCtrlEvent.h"
+
+MeetingAudioCtrlEvent::MeetingAudioCtrlEvent(std::function<unsigned int()> getSelfUserId, std::function<void()> onSelfAudioJoined)
+    : m_getSelfUserId(getSelfUserId), m_onSelfAudioJoined(onSelfAudioJoined) {
+}
+
+void MeetingAudioCtrlEvent::onUserAudioStatusChange(ZOOMSDK::IList<ZOOMSDK::IUserAudioStatus*>* lstAudioStatusChange, const zchar_t* strAudioStatusList) {
+    if (!lstAudioStatusChange || !m_getSelfUserId || !m_onSelfAudioJoined) return;
+
+    unsigned int selfId = m_getSelfUserId();
+    for (int i = 0; i < lstAudioStatusChange->GetCount(); i++) {
+        auto* status = lstAudioStatusChange->GetItem(i);
+        if (!status || status->GetUserId() != selfId) continue;
+
+        auto type = status->GetAudioType();
+        if (type == ZOOMSDK::AUDIOTYPE_VOIP || type == ZOOMSDK::AUDIOTYPE_PHONE) {
+            m_onSelfAudioJoined();
+        }
+        return;
+    }
+}
+
+void MeetingAudioCtrlEvent::onUserActiveAudioChange(ZOOMSDK::IList<unsigned int>* plstActiveAudio) {}
+
+void MeetingAudioCtrlEvent::onHostRequestStartAudio(ZOOMSDK::IRequestStartAudioHandler* handler_) {}
+
+void MeetingAudioCtrlEvent::onJoin3rdPartyTelephonyAudio(const zchar_t* audioInfo) {}
+
+void MeetingAudioCtrlEvent::onMuteOnEntryStatusChange(bool bEnabled) {}
@@ -0,0 +1,32 @@
+#ifndef HEADLESS_ZOOM_BOT_MEETINGAUDIOCTRLEVENT_H
+#define HEADLESS_ZOOM_BOT_MEETINGAUDIOCTRLEVENT_H
+
+#include <functional>
+#include "meeting_service_components/meeting_audio_interface.h"
+
+
+class MeetingAudioCtrlEvent : public ZOOMSDK::IMeetingAudioCtrlEvent {
+    std::function<unsigned int()> m_getSelfUserId;
+    std::function<void()> m_onSelfAudioJoined;
+
+public:
+    /**
+     * @param getSelfUserId returns the bot's own user id, 0 if not known yet
+     * @param onSelfAudioJoined fires when the bot's own audio connects (VoIP or phone)
+     */
+    MeetingAudioCtrlEvent(std::function<unsigned int()> getSelfUserId, std::function<void()> onSelfAudioJoined);
+
+    /**
+     * Fires when the audio status of one or more users changes
+     * @param lstAudioStatusChange users whose audio status changed
+     * @param strAudioStatusList the same list as JSON
+     */
+    void onUserAudioStatusChange(ZOOMSDK::IList<ZOOMSDK::IUserAudioStatus*>* lstAudioStatusChange, const zchar_t* strAudioStatusList) override;
+
+    void onUserActiveAudioChange(ZOOMSDK::IList<unsigned int>* plstActiveAudio) override;
+    void onHostRequestStartAudio(ZOOMSDK::IRequestStartAudioHandler* handler_) override;
+    void onJoin3rdPartyTelephonyAudio(const zchar_t* audioInfo) override;
+    void onMuteOnEntryStatusChange(bool bEnabled) override;
+};
+
+#endif //HEADLESS_ZOOM_BOT_MEETINGAUDIOCTRLEVENT_H
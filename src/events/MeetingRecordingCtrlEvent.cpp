@@ -15,7 +15,11 @@ void MeetingRecordingCtrlEvent::onRecordingStatus(ZOOMSDK::RecordingStatus statu
 
 void MeetingRecordingCtrlEvent::onCloudRecordingStatus(ZOOMSDK::RecordingStatus status) {}
 
-void MeetingRecordingCtrlEvent::onLocalRecordingPrivilegeRequestStatus(ZOOMSDK::RequestLocalRecordingStatus status) {}
+void MeetingRecordingCtrlEvent::onLocalRecordingPrivilegeRequestStatus(ZOOMSDK::RequestLocalRecordingStatus status) {
+    // A denied or expired request settles the wait for privilege just like a revoke
+    if (status != ZOOMSDK::RequestLocalRecording_Granted && m_onRecordingPrivilegeChanged)
+        m_onRecordingPrivilegeChanged(false);
+}
 
 void MeetingRecordingCtrlEvent::onLocalRecordingPrivilegeRequested(ZOOMSDK::IRequestLocalRecordingPrivilegeHandler* handler) {}
 
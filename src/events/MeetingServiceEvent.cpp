@@ -1,10 +1,14 @@
 #include "MeetingServiceEvent.h"
+#include "util/FlightRecorder.h"
 #include "util/Logger.h"
+#include "util/Probes.h"
 
 MeetingServiceEvent::MeetingServiceEvent(std::function<void()> onJoin, std::function<void()> onEnd)
     : m_onMeetingJoin(onJoin), m_onMeetingEnd(onEnd) {
 }
 void MeetingServiceEvent::onMeetingStatusChanged(ZOOMSDK::MeetingStatus status, int iResult) {
+    ZPROBE(meeting_status, static_cast<int>(status), iResult);
+    Util::FlightRecorder::getInstance().record("meeting_status", nullptr, status, iResult);
 
     std::string message;
     std::string icon = "⏳";
@@ -9,13 +9,13 @@ MeetingShareEvent::MeetingShareEvent(std::function<void(const ZOOMSDK::ZoomSDKSh
 void MeetingShareEvent::onSharingStatus(ZOOMSDK::ZoomSDKSharingSourceInfo shareInfo) {
     switch (shareInfo.status) {
         case ZOOMSDK::Sharing_Other_Share_Begin:
-            Util::Logger::getInstance().info("Share started from user " + std::to_string(shareInfo.userid));
+            ZLOG_INFO("Share started from user {}", shareInfo.userid);
             if (m_onShareStart) {
                 m_onShareStart(shareInfo);
             }
             break;
         case ZOOMSDK::Sharing_Other_Share_End:
-            Util::Logger::getInstance().info("Share ended from user " + std::to_string(shareInfo.userid));
+            ZLOG_INFO("Share ended from user {}", shareInfo.userid);
             if (m_onShareEnd) {
                 m_onShareEnd(shareInfo);
             }
@@ -0,0 +1,70 @@
+#include "FakeConfig.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace FakeSDK {
+
+static unsigned env_unsigned(const char* name, unsigned fallback, unsigned max = 3600000) {
+    const char* value = std::getenv(name);
+    if (!value || !*value) {
+        return fallback;
+    }
+    char* end = nullptr;
+    unsigned long parsed = std::strtoul(value, &end, 10);
+    if (*end || parsed > max) {
+        std::cerr << "[FakeSDK] Ignoring invalid " << name << "=" << value << std::endl;
+        return fallback;
+    }
+    return static_cast<unsigned>(parsed);
+}
+
+Config Config::fromEnv() {
+    Config config;
+    config.participants = static_cast<int>(env_unsigned("ZOOM_FAKE_SDK_PARTICIPANTS", config.participants, 1000));
+    config.sampleRate = env_unsigned("ZOOM_FAKE_SDK_SAMPLE_RATE", config.sampleRate, 192000);
+    config.audioIntervalMs = env_unsigned("ZOOM_FAKE_SDK_AUDIO_INTERVAL_MS", config.audioIntervalMs, 1000);
+    config.unpaced = env_unsigned("ZOOM_FAKE_SDK_UNPACED", 0, 1) != 0;
+    config.audioFrames = env_unsigned("ZOOM_FAKE_SDK_AUDIO_FRAMES", config.audioFrames, 0xffffffffu);
+    if (const char* report = std::getenv("ZOOM_FAKE_SDK_DELIVERY_REPORT")) {
+        config.deliveryReport = report;
+    }
+    config.shareFps = env_unsigned("ZOOM_FAKE_SDK_SHARE_FPS", config.shareFps, 120);
+    config.authMs = env_unsigned("ZOOM_FAKE_SDK_AUTH_MS", config.authMs);
+    config.joinMs = env_unsigned("ZOOM_FAKE_SDK_JOIN_MS", config.joinMs);
+    config.audioJoinMs = env_unsigned("ZOOM_FAKE_SDK_AUDIO_JOIN_MS", config.audioJoinMs);
+    config.privilegeMs = env_unsigned("ZOOM_FAKE_SDK_PRIVILEGE_MS", config.privilegeMs);
+    config.shareMs = env_unsigned("ZOOM_FAKE_SDK_SHARE_MS", config.shareMs);
+    config.durationMs = env_unsigned("ZOOM_FAKE_SDK_DURATION_MS", config.durationMs, 0xffffffffu);
+
+    if (config.sampleRate < 8000) config.sampleRate = 8000;
+    if (config.audioIntervalMs == 0) config.audioIntervalMs = 1;
+
+    if (const char* privilege = std::getenv("ZOOM_FAKE_SDK_PRIVILEGE")) {
+        if (std::strcmp(privilege, "granted") == 0) {
+            config.privilege = Privilege::GRANTED;
+        } else if (std::strcmp(privilege, "host") == 0) {
+            config.privilege = Privilege::HOST;
+        } else if (std::strcmp(privilege, "denied") == 0) {
+            config.privilege = Privilege::DENIED;
+        } else if (*privilege) {
+            std::cerr << "[FakeSDK] Ignoring invalid ZOOM_FAKE_SDK_PRIVILEGE=" << privilege << std::endl;
+        }
+    }
+    return config;
+}
+
+std::string Config::describe() const {
+    static const char* const privileges[] = {"granted", "host", "denied"};
+    std::string text = std::to_string(participants) + " participants, audio " + std::to_string(sampleRate) +
+                       " Hz every " + std::to_string(audioIntervalMs) + " ms" + (unpaced ? " unpaced" : "");
+    if (audioFrames) text += ", " + std::to_string(audioFrames) + " frames";
+    text += ", share ";
+    text += shareFps ? std::to_string(shareFps) + " fps" : std::string("off");
+    text += ", join " + std::to_string(joinMs) + " ms, privilege " +
+            privileges[static_cast<int>(privilege)];
+    return text;
+}
+
+} // namespace FakeSDK
@@ -0,0 +1,54 @@
+#ifndef HEADLESS_ZOOM_BOT_FAKE_CONFIG_H
+#define HEADLESS_ZOOM_BOT_FAKE_CONFIG_H
+
+#include <string>
+
+namespace FakeSDK {
+
+// How the host answers RequestLocalRecordingPrivilege
+enum class Privilege {
+    GRANTED,    // CanStartRawRecording succeeds right away
+    HOST,       // Needs a request; the host grants it after privilegeMs
+    DENIED      // Needs a request; the host denies it after privilegeMs
+};
+
+/**
+ * Simulated meeting, read from ZOOM_FAKE_SDK_* environment variables
+ *
+ * Read again for every meeting service, so a process can vary the load
+ * between meetings. A join token or starting the meeting as host always
+ * grants the recording privilege.
+ *
+ * With a delivery report and an audio frame limit, the media thread times
+ * every audio callback it makes (the C API's delegate, dispatch and whatever
+ * the consumer's callback does) and, once the last frame is delivered, writes
+ * one line to the report file:
+ *
+ *   frames=<callbacks> elapsed_ns=<n> p50_ns=<n> p99_ns=<n> max_ns=<n> late=<n>
+ *
+ * late counts paced frames delivered more than one period after they were due.
+ * The file is renamed into place, so it appearing means the run is over.
+ */
+struct Config {
+    int participants = 3;             // ZOOM_FAKE_SDK_PARTICIPANTS, one-way audio streams besides the bot
+    unsigned sampleRate = 32000;      // ZOOM_FAKE_SDK_SAMPLE_RATE, mono 16-bit PCM
+    unsigned audioIntervalMs = 10;    // ZOOM_FAKE_SDK_AUDIO_INTERVAL_MS, audio frame period
+    bool unpaced = false;             // ZOOM_FAKE_SDK_UNPACED=1, audio frames back to back instead of every period
+    unsigned audioFrames = 0;         // ZOOM_FAKE_SDK_AUDIO_FRAMES, frames per stream before audio stops, 0 for no end
+    std::string deliveryReport;       // ZOOM_FAKE_SDK_DELIVERY_REPORT, file for audio callback timings, see below
+    unsigned shareFps = 10;           // ZOOM_FAKE_SDK_SHARE_FPS, I420 share frame rate, 0 for no share
+    unsigned authMs = 50;             // ZOOM_FAKE_SDK_AUTH_MS, SDKAuth to onAuthenticationReturn
+    unsigned joinMs = 300;            // ZOOM_FAKE_SDK_JOIN_MS, CONNECTING to INMEETING
+    unsigned audioJoinMs = 200;       // ZOOM_FAKE_SDK_AUDIO_JOIN_MS, JoinVoip to VoIP connected
+    Privilege privilege = Privilege::GRANTED;  // ZOOM_FAKE_SDK_PRIVILEGE: granted, host or denied
+    unsigned privilegeMs = 500;       // ZOOM_FAKE_SDK_PRIVILEGE_MS, request to the host's answer
+    unsigned shareMs = 1000;          // ZOOM_FAKE_SDK_SHARE_MS, INMEETING to a participant sharing
+    unsigned durationMs = 0;          // ZOOM_FAKE_SDK_DURATION_MS, INMEETING to ENDED, 0 for no end
+
+    static Config fromEnv();
+    std::string describe() const;
+};
+
+} // namespace FakeSDK
+
+#endif // HEADLESS_ZOOM_BOT_FAKE_CONFIG_H
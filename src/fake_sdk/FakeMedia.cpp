@@ -0,0 +1,88 @@
+#include "FakeMedia.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace FakeSDK {
+
+static constexpr int kSineBits = 10;
+static constexpr int kToneAmplitude = 8000;
+static constexpr int kNoiseAmplitude = 64;
+static constexpr unsigned kTurnMs = 2000;
+
+static const int16_t* sine_table() {
+    static const auto* table = [] {
+        static int16_t values[1 << kSineBits];
+        for (int i = 0; i < (1 << kSineBits); i++) {
+            values[i] = static_cast<int16_t>(std::lround(kToneAmplitude * std::sin(2 * M_PI * i / (1 << kSineBits))));
+        }
+        return values;
+    }();
+    return table;
+}
+
+AudioSynth::AudioSynth(int participants, unsigned sampleRate, unsigned intervalMs)
+    : m_samplesPerFrame(static_cast<size_t>(sampleRate) * intervalMs / 1000)
+    , m_framesPerTurn(kTurnMs / intervalMs ? kTurnMs / intervalMs : 1) {
+    m_streams.resize(participants);
+    for (int i = 0; i < participants; i++) {
+        Stream& stream = m_streams[i];
+        uint64_t hz = 200 + 40 * static_cast<uint64_t>(i);
+        stream.phaseStep = static_cast<uint32_t>((hz << 32) / sampleRate);
+        stream.noise = 0x9E3779B9u * static_cast<uint32_t>(i + 1);
+        stream.samples.resize(m_samplesPerFrame);
+    }
+    m_mixed.resize(m_samplesPerFrame);
+    m_mix.resize(m_samplesPerFrame);
+}
+
+void AudioSynth::next() {
+    const int16_t* sine = sine_table();
+    int speaker = m_streams.empty() ? -1 : static_cast<int>((m_frame / m_framesPerTurn) % m_streams.size());
+    std::fill(m_mix.begin(), m_mix.end(), 0);
+    int32_t* mix = m_mix.data();
+
+    for (int i = 0; i < static_cast<int>(m_streams.size()); i++) {
+        Stream& stream = m_streams[i];
+        for (size_t n = 0; n < m_samplesPerFrame; n++) {
+            int16_t sample;
+            if (i == speaker) {
+                sample = sine[stream.phase >> (32 - kSineBits)];
+                stream.phase += stream.phaseStep;
+            } else {
+                // xorshift32, so every participant has its own repeatable noise
+                stream.noise ^= stream.noise << 13;
+                stream.noise ^= stream.noise >> 17;
+                stream.noise ^= stream.noise << 5;
+                sample = static_cast<int16_t>(static_cast<int>(stream.noise % (2 * kNoiseAmplitude)) - kNoiseAmplitude);
+            }
+            stream.samples[n] = sample;
+            mix[n] += sample;
+        }
+    }
+
+    for (size_t n = 0; n < m_samplesPerFrame; n++) {
+        m_mixed[n] = static_cast<int16_t>(mix[n] > INT16_MAX ? INT16_MAX : mix[n] < INT16_MIN ? INT16_MIN : mix[n]);
+    }
+    m_frame++;
+}
+
+void ShareSynth::resize(unsigned width, unsigned height) {
+    if (width == m_width && height == m_height) return;
+    m_width = width;
+    m_height = height;
+    m_ySize = static_cast<size_t>(width) * height;
+    m_buffer.assign(m_ySize + m_ySize / 2, static_cast<char>(128));
+}
+
+void ShareSynth::next() {
+    // Chroma stays neutral grey; 32-row luma bars move 8 rows per frame
+    for (unsigned row = 0; row < m_height; row++) {
+        bool light = ((row + m_frame * 8) / 32) % 2;
+        std::memset(m_buffer.data() + static_cast<size_t>(row) * m_width, light ? 180 : 60, m_width);
+    }
+    m_frame++;
+}
+
+} // namespace FakeSDK
@@ -0,0 +1,122 @@
+#ifndef HEADLESS_ZOOM_BOT_FAKE_MEDIA_H
+#define HEADLESS_ZOOM_BOT_FAKE_MEDIA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "zoom_sdk_raw_data_def.h"
+
+namespace FakeSDK {
+
+/**
+ * Deterministic PCM for a meeting's participants
+ *
+ * Participant i hums a sine at 200 + 40 * i Hz while it has the floor and
+ * emits quiet noise otherwise; the floor passes to the next participant every
+ * two seconds. The same configuration always yields the same samples.
+ */
+class AudioSynth {
+public:
+    AudioSynth(int participants, unsigned sampleRate, unsigned intervalMs);
+
+    // Generate the next frame of every participant and their mix
+    void next();
+
+    int participants() const { return static_cast<int>(m_streams.size()); }
+    size_t samplesPerFrame() const { return m_samplesPerFrame; }
+    const int16_t* participant(int index) const { return m_streams[index].samples.data(); }
+    const int16_t* mixed() const { return m_mixed.data(); }
+
+private:
+    struct Stream {
+        uint32_t phase = 0;
+        uint32_t phaseStep = 0;
+        uint32_t noise = 0;
+        std::vector<int16_t> samples;
+    };
+
+    std::vector<Stream> m_streams;
+    std::vector<int16_t> m_mixed;
+    std::vector<int32_t> m_mix;  // Unclipped sum, reused by every frame
+    size_t m_samplesPerFrame;
+    uint64_t m_framesPerTurn;
+    uint64_t m_frame = 0;
+};
+
+// Scrolling bars in I420, one contiguous buffer like the SDK's frames
+class ShareSynth {
+public:
+    void resize(unsigned width, unsigned height);
+
+    // Draw the next frame
+    void next();
+
+    unsigned width() const { return m_width; }
+    unsigned height() const { return m_height; }
+    char* y() { return m_buffer.data(); }
+    char* u() { return m_buffer.data() + m_ySize; }
+    char* v() { return m_buffer.data() + m_ySize + m_ySize / 4; }
+    char* buffer() { return m_buffer.data(); }
+    size_t size() const { return m_buffer.size(); }
+
+private:
+    unsigned m_width = 0;
+    unsigned m_height = 0;
+    size_t m_ySize = 0;
+    uint64_t m_frame = 0;
+    std::vector<char> m_buffer;
+};
+
+// AudioRawData over a buffer owned by the caller, valid during the callback only
+class AudioFrame : public AudioRawData {
+public:
+    AudioFrame(const int16_t* samples, size_t count, unsigned sampleRate)
+        : m_buffer(reinterpret_cast<char*>(const_cast<int16_t*>(samples)))
+        , m_length(static_cast<unsigned int>(count * sizeof(int16_t)))
+        , m_sampleRate(sampleRate) {}
+
+    bool CanAddRef() override { return false; }
+    bool AddRef() override { return false; }
+    int Release() override { return 0; }
+    char* GetBuffer() override { return m_buffer; }
+    unsigned int GetBufferLen() override { return m_length; }
+    unsigned int GetSampleRate() override { return m_sampleRate; }
+    unsigned int GetChannelNum() override { return 1; }
+
+private:
+    char* m_buffer;
+    unsigned int m_length;
+    unsigned int m_sampleRate;
+};
+
+// YUVRawDataI420 over a ShareSynth frame
+class VideoFrame : public YUVRawDataI420 {
+public:
+    VideoFrame(ShareSynth& synth, unsigned int sourceId, unsigned long long timestamp)
+        : m_synth(synth), m_sourceId(sourceId), m_timestamp(timestamp) {}
+
+    bool CanAddRef() override { return false; }
+    bool AddRef() override { return false; }
+    int Release() override { return 0; }
+    char* GetYBuffer() override { return m_synth.y(); }
+    char* GetUBuffer() override { return m_synth.u(); }
+    char* GetVBuffer() override { return m_synth.v(); }
+    char* GetBuffer() override { return m_synth.buffer(); }
+    unsigned int GetBufferLen() override { return static_cast<unsigned int>(m_synth.size()); }
+    bool IsLimitedI420() override { return false; }
+    unsigned int GetStreamWidth() override { return m_synth.width(); }
+    unsigned int GetStreamHeight() override { return m_synth.height(); }
+    unsigned int GetRotation() override { return 0; }
+    unsigned int GetSourceID() override { return m_sourceId; }
+    unsigned long long GetTimeStamp() override { return m_timestamp; }
+
+private:
+    ShareSynth& m_synth;
+    unsigned int m_sourceId;
+    unsigned long long m_timestamp;
+};
+
+} // namespace FakeSDK
+
+#endif // HEADLESS_ZOOM_BOT_FAKE_MEDIA_H
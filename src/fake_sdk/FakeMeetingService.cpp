@@ -0,0 +1,509 @@
+#include "FakeMeetingService.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+#include <pthread.h>
+
+namespace FakeSDK {
+
+static constexpr unsigned int kSelfUserId = 1;
+static constexpr unsigned int kFirstParticipantId = 100;
+static constexpr unsigned int kShareSourceId = 1;
+
+static void resolution_size(ZoomSDKResolution resolution, unsigned& width, unsigned& height) {
+    switch (resolution) {
+        case ZoomSDKResolution_90P:  width = 160;  height = 90;   break;
+        case ZoomSDKResolution_180P: width = 320;  height = 180;  break;
+        case ZoomSDKResolution_360P: width = 640;  height = 360;  break;
+        case ZoomSDKResolution_1080P: width = 1920; height = 1080; break;
+        default:                     width = 1280; height = 720;  break;
+    }
+}
+
+Renderer::Renderer(MeetingService* service, IZoomSDKRendererDelegate* delegate)
+    : m_service(service), m_delegate(delegate) {}
+
+SDKError Renderer::setRawDataResolution(ZoomSDKResolution resolution) {
+    if (!m_service) return SDKERR_UNINITIALIZE;
+    std::lock_guard<std::mutex> lock(m_service->sinkMutex());
+    m_resolution = resolution;
+    return SDKERR_SUCCESS;
+}
+
+SDKError Renderer::subscribe(uint32_t subscribeId, ZoomSDKRawDataType type) {
+    if (!m_service) return SDKERR_UNINITIALIZE;
+    // The bot only ever renders shares; camera video is not simulated
+    if (type != RAW_DATA_TYPE_SHARE) return SDKERR_NO_IMPL;
+
+    {
+        std::lock_guard<std::mutex> lock(m_service->sinkMutex());
+        m_subscribeId = subscribeId;
+        m_type = type;
+        m_subscribed = true;
+    }
+    m_delegate->onRawDataStatusChanged(RawData_On);
+    return SDKERR_SUCCESS;
+}
+
+SDKError Renderer::unSubscribe() {
+    if (!m_service) return SDKERR_UNINITIALIZE;
+
+    bool wasSubscribed;
+    {
+        std::lock_guard<std::mutex> lock(m_service->sinkMutex());
+        wasSubscribed = m_subscribed;
+        m_subscribed = false;
+    }
+    if (wasSubscribed) {
+        m_delegate->onRawDataStatusChanged(RawData_Off);
+    }
+    return SDKERR_SUCCESS;
+}
+
+MeetingService::MeetingService()
+    : m_config(Config::fromEnv())
+    , m_audioSynth(m_config.participants, m_config.sampleRate, m_config.audioIntervalMs) {
+    m_self.muted = true;
+    m_users.reserve(m_config.participants);
+    for (int i = 0; i < m_config.participants; i++) {
+        m_users.emplace_back(kFirstParticipantId + i, "Participant " + std::to_string(i + 1));
+        m_users.back().audioType = AUDIOTYPE_VOIP;
+    }
+    m_userIds.items.push_back(kSelfUserId);
+    for (auto& user : m_users) {
+        m_userIds.items.push_back(user.GetUserID());
+    }
+    std::cerr << "[FakeSDK] meeting service: " << m_config.describe() << std::endl;
+}
+
+MeetingService::~MeetingService() {
+    stopMedia();
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    for (auto* renderer : m_renderers) {
+        renderer->m_service = nullptr;
+    }
+}
+
+void MeetingService::addRenderer(Renderer* renderer) {
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    m_renderers.push_back(renderer);
+}
+
+void MeetingService::removeRenderer(Renderer* renderer) {
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    for (auto it = m_renderers.begin(); it != m_renderers.end(); ++it) {
+        if (*it == renderer) {
+            m_renderers.erase(it);
+            break;
+        }
+    }
+}
+
+SDKError MeetingService::SetEvent(IMeetingServiceEvent* pEvent) {
+    m_event = pEvent;
+    return SDKERR_SUCCESS;
+}
+
+SDKError MeetingService::Join(JoinParam& joinParam) {
+    if (joinParam.userType != SDK_UT_WITHOUT_LOGIN) return SDKERR_INVALID_PARAMETER;
+    const JoinParam4WithoutLogin& param = joinParam.param.withoutloginuserJoin;
+    if (!param.meetingNumber && !param.vanityID) return SDKERR_INVALID_PARAMETER;
+
+    bool hasToken = param.app_privilege_token && *param.app_privilege_token;
+    return begin(hasToken || m_config.privilege == Privilege::GRANTED);
+}
+
+SDKError MeetingService::Start(StartParam& startParam) {
+    // The host may always record
+    return begin(true);
+}
+
+SDKError MeetingService::begin(bool privileged) {
+    MeetingStatus status = m_status.load();
+    if (status != MEETING_STATUS_IDLE && status != MEETING_STATUS_ENDED && status != MEETING_STATUS_FAILED) {
+        return SDKERR_WRONG_USAGE;
+    }
+
+    m_session++;
+    m_privileged = privileged;
+    m_status = MEETING_STATUS_CONNECTING;
+    post(0, [this] { setStatus(MEETING_STATUS_CONNECTING); });
+    post(m_config.joinMs, [this] { enterMeeting(); });
+    return SDKERR_SUCCESS;
+}
+
+SDKError MeetingService::Leave(LeaveMeetingCmd leaveCmd) {
+    MeetingStatus status = m_status.load();
+    if (status != MEETING_STATUS_CONNECTING && status != MEETING_STATUS_INMEETING) {
+        return SDKERR_WRONG_USAGE;
+    }
+
+    // Drops whatever the join or meeting still had scheduled
+    m_session++;
+    stopMedia();
+    m_status = MEETING_STATUS_DISCONNECTING;
+    post(0, [this] { setStatus(MEETING_STATUS_DISCONNECTING); });
+    post(0, [this] { endMeeting(); });
+    return SDKERR_SUCCESS;
+}
+
+void MeetingService::setStatus(MeetingStatus status) {
+    m_status = status;
+    if (m_event) {
+        m_event->onMeetingStatusChanged(status, 0);
+    }
+}
+
+void MeetingService::post(unsigned delayMs, std::function<void()> fn) {
+    m_scheduler.post(delayMs, [this, session = m_session, fn = std::move(fn)] {
+        if (session == m_session) fn();
+    });
+}
+
+void MeetingService::enterMeeting() {
+    setStatus(MEETING_STATUS_INMEETING);
+    if (!inMeeting()) return;
+
+    if (autoJoinAudioEnabled()) {
+        joinAudio();
+    }
+    if (m_config.shareFps && !m_users.empty()) {
+        post(m_config.shareMs, [this] { startShare(); });
+    }
+    if (m_config.durationMs) {
+        post(m_config.durationMs, [this] {
+            m_session++;
+            stopMedia();
+            endMeeting();
+        });
+    }
+    startMedia();
+}
+
+void MeetingService::endMeeting() {
+    m_privileged = false;
+    m_audioJoining = false;
+    m_recordingOn = false;
+    m_audioJoined = false;
+    m_sharing = false;
+    m_self.audioType = AUDIOTYPE_NONE;
+    m_sharers.items.clear();
+    m_shareSources.items.clear();
+    setStatus(MEETING_STATUS_ENDED);
+}
+
+void MeetingService::joinAudio() {
+    if (m_audioJoining || m_audioJoined) return;
+    m_audioJoining = true;
+
+    post(m_config.audioJoinMs, [this] {
+        m_audioJoining = false;
+        m_audioJoined = true;
+        m_self.audioType = AUDIOTYPE_VOIP;
+        if (m_audioEvent) {
+            List<IUserAudioStatus*> changes;
+            changes.items.push_back(&m_self);
+            m_audioEvent->onUserAudioStatusChange(&changes, nullptr);
+        }
+    });
+}
+
+void MeetingService::startShare() {
+    ZoomSDKSharingSourceInfo info;
+    info.userid = kFirstParticipantId;
+    info.shareSourceID = kShareSourceId;
+    info.status = Sharing_Other_Share_Begin;
+    info.isShowingInFirstView = true;
+
+    m_sharers.items = {info.userid};
+    m_shareSources.items = {info};
+    m_sharing = true;
+    if (m_shareEvent) {
+        m_shareEvent->onSharingStatus(info);
+    }
+}
+
+void MeetingService::startMedia() {
+    stopMedia();
+    m_mediaStop = false;
+    m_mediaThread = std::thread([this] { runMedia(); });
+}
+
+void MeetingService::stopMedia() {
+    if (!m_mediaThread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(m_mediaMutex);
+        m_mediaStop = true;
+    }
+    m_mediaWake.notify_one();
+    m_mediaThread.join();
+}
+
+void MeetingService::runMedia() {
+    using Clock = std::chrono::steady_clock;
+    pthread_setname_np(pthread_self(), "fake-sdk-media");
+
+    const auto audioPeriod = std::chrono::milliseconds(m_config.audioIntervalMs);
+    const auto sharePeriod = m_config.shareFps
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)) / m_config.shareFps
+        : Clock::duration::max();
+    const auto start = Clock::now();
+    auto nextAudio = m_config.unpaced ? start : start + audioPeriod;
+    auto nextShare = m_config.shareFps ? start + sharePeriod : Clock::time_point::max();
+
+    m_audioDelivered = 0;
+    m_lateFrames = 0;
+    m_callbackNs.clear();
+    if (!m_config.deliveryReport.empty() && m_config.audioFrames) {
+        m_callbackNs.reserve(static_cast<size_t>(m_config.audioFrames) * (m_audioSynth.participants() + 1));
+    }
+
+    std::unique_lock<std::mutex> lock(m_mediaMutex);
+    while (!m_mediaStop) {
+        // Unpaced audio is due again right after a delivery; don't pay for a timed wait per frame
+        auto due = std::min(nextAudio, nextShare);
+        if (Clock::now() < due && m_mediaWake.wait_until(lock, due, [this] { return m_mediaStop; })) {
+            break;
+        }
+        lock.unlock();
+
+        auto now = Clock::now();
+        if (now >= nextAudio) {
+            bool delivered = deliverAudio(nextAudio);
+            if (m_config.audioFrames && m_audioDelivered == m_config.audioFrames) {
+                writeDeliveryReport();
+                nextAudio = Clock::time_point::max();
+            } else if (m_config.unpaced) {
+                // Until joining and the recording privilege let frames through, poll at
+                // the paced rate rather than spin next to the threads being measured
+                nextAudio = delivered ? now : now + audioPeriod;
+            } else {
+                nextAudio += audioPeriod;
+                // Keep the cadence through short stalls but don't burst after long ones
+                if (now - nextAudio > std::chrono::seconds(1)) nextAudio = now + audioPeriod;
+            }
+        }
+        if (now >= nextShare) {
+            auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count();
+            deliverShare(static_cast<unsigned long long>(timestamp));
+            nextShare += sharePeriod;
+            if (now - nextShare > std::chrono::seconds(1)) nextShare = now + sharePeriod;
+        }
+
+        lock.lock();
+    }
+}
+
+bool MeetingService::deliverAudio(std::chrono::steady_clock::time_point due) {
+    using Clock = std::chrono::steady_clock;
+    if (!m_recordingOn || !m_audioJoined) return false;
+
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    if (!m_audioSink) return false;
+
+    m_audioSynth.next();
+    size_t samples = m_audioSynth.samplesPerFrame();
+    bool timed = m_config.audioFrames && !m_config.deliveryReport.empty();
+    auto start = Clock::now();
+    if (timed) {
+        if (m_audioDelivered == 0) m_firstDelivery = start;
+        if (!m_config.unpaced && start - due > std::chrono::milliseconds(m_config.audioIntervalMs)) m_lateFrames++;
+    }
+
+    // Times each callback, from the end of the one before
+    auto record = [&]() {
+        if (!timed) return;
+        auto end = Clock::now();
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        m_callbackNs.push_back(static_cast<uint32_t>(std::min<int64_t>(ns, UINT32_MAX)));
+        start = m_lastDelivery = end;
+    };
+
+    AudioFrame mixed(m_audioSynth.mixed(), samples, m_config.sampleRate);
+    m_audioSink->onMixedAudioRawDataReceived(&mixed);
+    record();
+    for (int i = 0; i < m_audioSynth.participants(); i++) {
+        AudioFrame frame(m_audioSynth.participant(i), samples, m_config.sampleRate);
+        m_audioSink->onOneWayAudioRawDataReceived(&frame, kFirstParticipantId + i);
+        record();
+    }
+    m_audioDelivered++;
+    return true;
+}
+
+void MeetingService::writeDeliveryReport() {
+    if (m_config.deliveryReport.empty() || m_callbackNs.empty()) return;
+
+    auto& times = m_callbackNs;
+    auto percentile = [&times](double p) {
+        size_t index = std::min(times.size() - 1, static_cast<size_t>(times.size() * p));
+        std::nth_element(times.begin(), times.begin() + index, times.end());
+        return static_cast<unsigned long long>(times[index]);
+    };
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(m_lastDelivery - m_firstDelivery).count();
+    unsigned long long frames = times.size();
+    unsigned long long maxNs = *std::max_element(times.begin(), times.end());
+    unsigned long long p50 = percentile(0.5);
+    unsigned long long p99 = percentile(0.99);
+
+    std::string partial = m_config.deliveryReport + ".tmp";
+    FILE* file = std::fopen(partial.c_str(), "w");
+    if (!file) {
+        std::cerr << "[FakeSDK] Cannot write " << partial << std::endl;
+        return;
+    }
+    std::fprintf(file, "frames=%llu elapsed_ns=%llu p50_ns=%llu p99_ns=%llu max_ns=%llu late=%llu\n", frames,
+                 static_cast<unsigned long long>(elapsed), p50, p99, maxNs,
+                 static_cast<unsigned long long>(m_lateFrames));
+    std::fclose(file);
+    std::rename(partial.c_str(), m_config.deliveryReport.c_str());
+}
+
+void MeetingService::deliverShare(unsigned long long timestamp) {
+    if (!m_recordingOn || !m_sharing) return;
+
+    std::lock_guard<std::mutex> lock(m_sinkMutex);
+    for (auto* renderer : m_renderers) {
+        if (!renderer->m_subscribed || renderer->m_type != RAW_DATA_TYPE_SHARE ||
+            renderer->m_subscribeId != kShareSourceId) {
+            continue;
+        }
+        unsigned width, height;
+        resolution_size(renderer->m_resolution, width, height);
+        m_shareSynth.resize(width, height);
+        m_shareSynth.next();
+        VideoFrame frame(m_shareSynth, kShareSourceId, timestamp);
+        renderer->m_delegate->onRawDataFrameReceived(&frame);
+    }
+}
+
+SDKError MeetingService::AudioController::SetEvent(IMeetingAudioCtrlEvent* pEvent) {
+    m_service.m_audioEvent = pEvent;
+    return SDKERR_SUCCESS;
+}
+
+SDKError MeetingService::AudioController::JoinVoip() {
+    if (!m_service.inMeeting()) return SDKERR_WRONG_USAGE;
+    m_service.joinAudio();
+    return SDKERR_SUCCESS;
+}
+
+SDKError MeetingService::AudioController::LeaveVoip() {
+    if (!m_service.m_audioJoined) return SDKERR_WRONG_USAGE;
+    m_service.m_audioJoined = false;
+    m_service.m_self.audioType = AUDIOTYPE_NONE;
+    return SDKERR_SUCCESS;
+}
+
+SDKError MeetingService::AudioController::MuteAudio(unsigned int userid, bool allowUnmuteBySelf) {
+    if (userid != kSelfUserId) return SDKERR_NO_PERMISSION;
+    m_service.m_self.muted = true;
+    return SDKERR_SUCCESS;
+}
+
+SDKError MeetingService::AudioController::UnMuteAudio(unsigned int userid) {
+    if (userid != kSelfUserId) return SDKERR_NO_PERMISSION;
+    m_service.m_self.muted = false;
+    return SDKERR_SUCCESS;
+}
+
+IList<unsigned int>* MeetingService::ParticipantsController::GetParticipantsList() {
+    return m_service.inMeeting() ? &m_service.m_userIds : nullptr;
+}
+
+IUserInfo* MeetingService::ParticipantsController::GetUserByUserID(unsigned int userid) {
+    if (!m_service.inMeeting()) return nullptr;
+    if (userid == kSelfUserId) return &m_service.m_self;
+    if (userid >= kFirstParticipantId && userid - kFirstParticipantId < m_service.m_users.size()) {
+        return &m_service.m_users[userid - kFirstParticipantId];
+    }
+    return nullptr;
+}
+
+IUserInfo* MeetingService::ParticipantsController::GetMySelfUser() {
+    return m_service.inMeeting() ? &m_service.m_self : nullptr;
+}
+
+SDKError MeetingService::RecordingController::SetEvent(IMeetingRecordingCtrlEvent* pEvent) {
+    m_service.m_recordingEvent = pEvent;
+    return SDKERR_SUCCESS;
+}
+
+SDKError MeetingService::RecordingController::CanStartRawRecording() {
+    if (!m_service.inMeeting()) return SDKERR_WRONG_USAGE;
+    return m_service.m_privileged ? SDKERR_SUCCESS : SDKERR_NO_PERMISSION;
+}
+
+SDKError MeetingService::RecordingController::StartRawRecording() {
+    SDKError err = CanStartRawRecording();
+    if (err != SDKERR_SUCCESS) return err;
+
+    m_service.m_recordingOn = true;
+    m_service.post(0, [this] {
+        if (m_service.m_recordingEvent) m_service.m_recordingEvent->onRecordingStatus(Recording_Start);
+    });
+    return SDKERR_SUCCESS;
+}
+
+SDKError MeetingService::RecordingController::StopRawRecording() {
+    if (!m_service.m_recordingOn) return SDKERR_NORECORDINGINPROCESS;
+
+    m_service.m_recordingOn = false;
+    m_service.post(0, [this] {
+        if (m_service.m_recordingEvent) m_service.m_recordingEvent->onRecordingStatus(Recording_Stop);
+    });
+    return SDKERR_SUCCESS;
+}
+
+SDKError MeetingService::RecordingController::RequestLocalRecordingPrivilege() {
+    if (!m_service.inMeeting()) return SDKERR_WRONG_USAGE;
+    if (m_service.m_privileged) return SDKERR_SUCCESS;
+
+    bool grant = m_service.m_config.privilege == Privilege::HOST;
+    m_service.post(m_service.m_config.privilegeMs, [this, grant] {
+        auto* event = m_service.m_recordingEvent;
+        if (grant) {
+            m_service.m_privileged = true;
+            if (event) event->onLocalRecordingPrivilegeRequestStatus(RequestLocalRecording_Granted);
+            if (event) event->onRecordPrivilegeChanged(true);
+        } else if (event) {
+            event->onLocalRecordingPrivilegeRequestStatus(RequestLocalRecording_Denied);
+        }
+    });
+    return SDKERR_SUCCESS;
+}
+
+SDKError MeetingService::ShareController::SetEvent(IMeetingShareCtrlEvent* pEvent) {
+    m_service.m_shareEvent = pEvent;
+    return SDKERR_SUCCESS;
+}
+
+IList<unsigned int>* MeetingService::ShareController::GetViewableSharingUserList() {
+    return &m_service.m_sharers;
+}
+
+IList<ZoomSDKSharingSourceInfo>* MeetingService::ShareController::GetSharingSourceInfoList(unsigned int userid) {
+    return m_service.m_sharing && userid == kFirstParticipantId ? &m_service.m_shareSources : nullptr;
+}
+
+SDKError MeetingService::AudioHelper::subscribe(IZoomSDKAudioRawDataDelegate* pDelegate, bool bWithInterpreters) {
+    if (!pDelegate) return SDKERR_INVALID_PARAMETER;
+    if (!m_service.inMeeting()) return SDKERR_NOT_IN_MEETING;
+    if (!m_service.m_recordingOn) return SDKERR_NO_PERMISSION;
+    if (!m_service.m_audioJoined) return SDKERR_NOT_JOIN_AUDIO;
+
+    std::lock_guard<std::mutex> lock(m_service.m_sinkMutex);
+    m_service.m_audioSink = pDelegate;
+    return SDKERR_SUCCESS;
+}
+
+SDKError MeetingService::AudioHelper::unSubscribe() {
+    std::lock_guard<std::mutex> lock(m_service.m_sinkMutex);
+    m_service.m_audioSink = nullptr;
+    return SDKERR_SUCCESS;
+}
+
+} // namespace FakeSDK
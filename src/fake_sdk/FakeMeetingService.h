@@ -0,0 +1,259 @@
+#ifndef HEADLESS_ZOOM_BOT_FAKE_MEETING_SERVICE_H
+#define HEADLESS_ZOOM_BOT_FAKE_MEETING_SERVICE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "meeting_service_interface.h"
+#include "meeting_service_components/meeting_audio_interface.h"
+#include "meeting_service_components/meeting_participants_ctrl_interface.h"
+#include "meeting_service_components/meeting_recording_interface.h"
+#include "meeting_service_components/meeting_reminder_ctrl_interface.h"
+#include "meeting_service_components/meeting_sharing_interface.h"
+#include "meeting_service_components/meeting_video_interface.h"
+#include "rawdata/rawdata_audio_helper_interface.h"
+#include "rawdata/rawdata_renderer_interface.h"
+
+#include "FakeConfig.h"
+#include "FakeMedia.h"
+#include "FakeScheduler.h"
+
+namespace FakeSDK {
+
+using namespace ZOOMSDK;
+
+// Process-wide, set through ISettingService like the SDK's global settings
+bool autoJoinAudioEnabled();
+
+template<class T>
+class List : public IList<T> {
+public:
+    int GetCount() override { return static_cast<int>(items.size()); }
+    T GetItem(int index) override {
+        return index >= 0 && index < static_cast<int>(items.size()) ? items[index] : T{};
+    }
+
+    std::vector<T> items;
+};
+
+class User : public IUserInfo, public IUserAudioStatus {
+public:
+    User(unsigned int id, std::string name) : m_id(id), m_name(std::move(name)) {}
+
+    const zchar_t* GetUserName() override { return m_name.c_str(); }
+    unsigned int GetUserID() override { return m_id; }
+    AudioType GetAudioJoinType() override { return audioType; }
+
+    unsigned int GetUserId() override { return m_id; }
+    AudioStatus GetStatus() override { return muted ? Audio_Muted : Audio_UnMuted; }
+    AudioType GetAudioType() override { return audioType; }
+
+    AudioType audioType = AUDIOTYPE_NONE;
+    bool muted = false;
+
+private:
+    unsigned int m_id;
+    std::string m_name;
+};
+
+class MeetingService;
+
+class Renderer : public IZoomSDKRenderer {
+public:
+    Renderer(MeetingService* service, IZoomSDKRendererDelegate* delegate);
+
+    SDKError setRawDataResolution(ZoomSDKResolution resolution) override;
+    SDKError subscribe(uint32_t subscribeId, ZoomSDKRawDataType type) override;
+    SDKError unSubscribe() override;
+    ZoomSDKRawDataType getRawDataType() override { return m_type; }
+    uint32_t getSubscribeId() override { return m_subscribeId; }
+
+    MeetingService* service() const { return m_service; }
+    IZoomSDKRendererDelegate* delegate() const { return m_delegate; }
+
+private:
+    friend class MeetingService;
+
+    // Guarded by the service's sink mutex; the media thread reads them per frame
+    MeetingService* m_service;
+    IZoomSDKRendererDelegate* m_delegate;
+    ZoomSDKResolution m_resolution = ZoomSDKResolution_720P;
+    ZoomSDKRawDataType m_type = RAW_DATA_TYPE_SHARE;
+    uint32_t m_subscribeId = 0;
+    bool m_subscribed = false;
+};
+
+/**
+ * Simulated meeting behind IMeetingService
+ *
+ * Control callbacks run on the creating thread's main loop after the
+ * configured latencies. While in the meeting a media thread produces PCM for
+ * every participant and, once someone shares, I420 frames; both reach the
+ * subscribed delegates only while raw recording is on, as with the SDK.
+ */
+class MeetingService : public IMeetingService {
+public:
+    MeetingService();
+    ~MeetingService() override;
+
+    SDKError SetEvent(IMeetingServiceEvent* pEvent) override;
+    SDKError Join(JoinParam& joinParam) override;
+    SDKError Start(StartParam& startParam) override;
+    SDKError Leave(LeaveMeetingCmd leaveCmd) override;
+    MeetingStatus GetMeetingStatus() override { return m_status.load(); }
+    IMeetingAudioController* GetMeetingAudioController() override { return &m_audio; }
+    IMeetingVideoController* GetMeetingVideoController() override { return &m_video; }
+    IMeetingParticipantsController* GetMeetingParticipantsController() override { return &m_participants; }
+    IMeetingRecordingController* GetMeetingRecordingController() override { return &m_recording; }
+    IMeetingReminderController* GetMeetingReminderController() override { return &m_reminder; }
+    IMeetingShareController* GetMeetingShareController() override { return &m_share; }
+
+    IZoomSDKAudioRawDataHelper* audioHelper() { return &m_audioHelper; }
+    GMainContext* context() const { return m_scheduler.context(); }
+
+    void addRenderer(Renderer* renderer);
+    void removeRenderer(Renderer* renderer);
+    std::mutex& sinkMutex() { return m_sinkMutex; }
+
+private:
+    class AudioController : public IMeetingAudioController {
+    public:
+        explicit AudioController(MeetingService& service) : m_service(service) {}
+        SDKError SetEvent(IMeetingAudioCtrlEvent* pEvent) override;
+        SDKError JoinVoip() override;
+        SDKError LeaveVoip() override;
+        SDKError MuteAudio(unsigned int userid, bool allowUnmuteBySelf) override;
+        SDKError UnMuteAudio(unsigned int userid) override;
+    private:
+        MeetingService& m_service;
+    };
+
+    class VideoController : public IMeetingVideoController {
+    public:
+        SDKError MuteVideo() override { return SDKERR_SUCCESS; }
+        SDKError UnmuteVideo() override { return SDKERR_SUCCESS; }
+    };
+
+    class ParticipantsController : public IMeetingParticipantsController {
+    public:
+        explicit ParticipantsController(MeetingService& service) : m_service(service) {}
+        IList<unsigned int>* GetParticipantsList() override;
+        IUserInfo* GetUserByUserID(unsigned int userid) override;
+        IUserInfo* GetMySelfUser() override;
+    private:
+        MeetingService& m_service;
+    };
+
+    class RecordingController : public IMeetingRecordingController {
+    public:
+        explicit RecordingController(MeetingService& service) : m_service(service) {}
+        SDKError SetEvent(IMeetingRecordingCtrlEvent* pEvent) override;
+        SDKError CanStartRawRecording() override;
+        SDKError StartRawRecording() override;
+        SDKError StopRawRecording() override;
+        SDKError RequestLocalRecordingPrivilege() override;
+    private:
+        MeetingService& m_service;
+    };
+
+    class ReminderController : public IMeetingReminderController {
+    public:
+        SDKError SetEvent(IMeetingReminderEvent* pEvent) override { return SDKERR_SUCCESS; }
+    };
+
+    class ShareController : public IMeetingShareController {
+    public:
+        explicit ShareController(MeetingService& service) : m_service(service) {}
+        SDKError SetEvent(IMeetingShareCtrlEvent* pEvent) override;
+        IList<unsigned int>* GetViewableSharingUserList() override;
+        IList<ZoomSDKSharingSourceInfo>* GetSharingSourceInfoList(unsigned int userid) override;
+    private:
+        MeetingService& m_service;
+    };
+
+    class AudioHelper : public IZoomSDKAudioRawDataHelper {
+    public:
+        explicit AudioHelper(MeetingService& service) : m_service(service) {}
+        SDKError subscribe(IZoomSDKAudioRawDataDelegate* pDelegate, bool bWithInterpreters) override;
+        SDKError unSubscribe() override;
+    private:
+        MeetingService& m_service;
+    };
+
+    SDKError begin(bool privileged);
+    void setStatus(MeetingStatus status);
+    // Run fn on the main loop unless the meeting was left or rejoined meanwhile
+    void post(unsigned delayMs, std::function<void()> fn);
+    void enterMeeting();
+    void endMeeting();
+    void joinAudio();
+    void startShare();
+    bool inMeeting() const { return m_status.load() == MEETING_STATUS_INMEETING; }
+
+    void startMedia();
+    void stopMedia();
+    void runMedia();
+    // false while there is nobody to deliver to: recording off, audio not joined or no sink
+    bool deliverAudio(std::chrono::steady_clock::time_point due);
+    void deliverShare(unsigned long long timestamp);
+    void writeDeliveryReport();
+
+    Config m_config;
+    Scheduler m_scheduler;
+    unsigned m_session = 0;
+
+    AudioController m_audio{*this};
+    VideoController m_video;
+    ParticipantsController m_participants{*this};
+    RecordingController m_recording{*this};
+    ReminderController m_reminder;
+    ShareController m_share{*this};
+    AudioHelper m_audioHelper{*this};
+
+    IMeetingServiceEvent* m_event = nullptr;
+    IMeetingAudioCtrlEvent* m_audioEvent = nullptr;
+    IMeetingRecordingCtrlEvent* m_recordingEvent = nullptr;
+    IMeetingShareCtrlEvent* m_shareEvent = nullptr;
+
+    std::atomic<MeetingStatus> m_status{MEETING_STATUS_IDLE};
+    bool m_privileged = false;
+    bool m_audioJoining = false;
+    std::atomic<bool> m_recordingOn{false};
+    std::atomic<bool> m_audioJoined{false};
+    std::atomic<bool> m_sharing{false};
+
+    User m_self{1, "Bot"};
+    std::vector<User> m_users;
+    List<unsigned int> m_userIds;
+    List<unsigned int> m_sharers;
+    List<ZoomSDKSharingSourceInfo> m_shareSources;
+
+    // Delegates, guarded by m_sinkMutex and called with it held
+    std::mutex m_sinkMutex;
+    IZoomSDKAudioRawDataDelegate* m_audioSink = nullptr;
+    std::vector<Renderer*> m_renderers;
+
+    std::mutex m_mediaMutex;
+    std::condition_variable m_mediaWake;
+    bool m_mediaStop = false;
+    std::thread m_mediaThread;
+    AudioSynth m_audioSynth;
+    ShareSynth m_shareSynth;
+
+    // Media thread only: audio frames delivered, and callback timings when a report is wanted
+    uint64_t m_audioDelivered = 0;
+    std::vector<uint32_t> m_callbackNs;
+    uint64_t m_lateFrames = 0;
+    std::chrono::steady_clock::time_point m_firstDelivery;
+    std::chrono::steady_clock::time_point m_lastDelivery;
+};
+
+} // namespace FakeSDK
+
+#endif // HEADLESS_ZOOM_BOT_FAKE_MEETING_SERVICE_H
@@ -0,0 +1,211 @@
+/*
+ * Exported entry points of the stand-in meetingsdk
+ *
+ * Services created here behave like a reachable Zoom backend: auth always
+ * succeeds for a non-empty JWT and meetings are joined after the configured
+ * latencies. See FakeConfig.h for the knobs.
+ */
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#include "zoom_sdk.h"
+#include "auth_service_interface.h"
+#include "network_connection_handler_interface.h"
+#include "setting_service_interface.h"
+#include "rawdata/zoom_rawdata_api.h"
+
+#include "FakeMeetingService.h"
+
+namespace FakeSDK {
+
+static std::atomic<bool> g_initialized{false};
+static std::atomic<bool> g_auto_join_audio{false};
+
+// Meeting services by creation order; raw data calls pick theirs by main context
+static std::mutex g_services_mutex;
+static std::vector<MeetingService*> g_services;
+
+bool autoJoinAudioEnabled() {
+    return g_auto_join_audio.load();
+}
+
+// The SDK's raw data entry points are global; resolve them to the meeting
+// whose main loop the caller runs on, or the newest one outside any.
+static MeetingService* current_service() {
+    GMainContext* context = g_main_context_ref_thread_default();
+    MeetingService* found = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(g_services_mutex);
+        for (auto* service : g_services) {
+            if (service->context() == context) found = service;
+        }
+        if (!found && !g_services.empty()) found = g_services.back();
+    }
+    g_main_context_unref(context);
+    return found;
+}
+
+class AuthService : public IAuthService {
+public:
+    SDKError SetEvent(IAuthServiceEvent* pEvent) override {
+        m_event = pEvent;
+        return SDKERR_SUCCESS;
+    }
+
+    SDKError SDKAuth(AuthContext& authContext) override {
+        if (!authContext.jwt_token || !*authContext.jwt_token) return SDKERR_INVALID_PARAMETER;
+
+        m_result = AUTHRET_NONE;
+        m_scheduler.post(Config::fromEnv().authMs, [this] {
+            m_result = AUTHRET_SUCCESS;
+            if (m_event) m_event->onAuthenticationReturn(AUTHRET_SUCCESS);
+        });
+        return SDKERR_SUCCESS;
+    }
+
+    AuthResult GetAuthResult() override { return m_result; }
+
+private:
+    Scheduler m_scheduler;
+    IAuthServiceEvent* m_event = nullptr;
+    AuthResult m_result = AUTHRET_NONE;
+};
+
+class AudioSettings : public IAudioSettingContext {
+public:
+    SDKError EnableAutoJoinAudio(bool bEnable) override {
+        g_auto_join_audio = bEnable;
+        return SDKERR_SUCCESS;
+    }
+
+    bool IsAutoJoinAudioEnabled() override { return g_auto_join_audio.load(); }
+};
+
+class SettingService : public ISettingService {
+public:
+    IAudioSettingContext* GetAudioSettings() override { return &m_audio; }
+
+private:
+    AudioSettings m_audio;
+};
+
+class NetworkConnectionHelper : public INetworkConnectionHelper {
+public:
+    SDKError ConfigureProxy(ProxySettings& proxySetting) override { return SDKERR_SUCCESS; }
+};
+
+} // namespace FakeSDK
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+using namespace FakeSDK;
+
+SDKError InitSDK(InitParam& initParam) {
+    if (!g_initialized.exchange(true)) {
+        std::cerr << "[FakeSDK] Using the stand-in meetingsdk; no Zoom connection is made" << std::endl;
+    }
+    return SDKERR_SUCCESS;
+}
+
+SDKError CleanUPSDK() {
+    g_initialized = false;
+    return SDKERR_SUCCESS;
+}
+
+SDKError CreateMeetingService(IMeetingService** ppMeetingService) {
+    if (!ppMeetingService) return SDKERR_INVALID_PARAMETER;
+    if (!g_initialized) return SDKERR_UNINITIALIZE;
+
+    auto* service = new MeetingService();
+    {
+        std::lock_guard<std::mutex> lock(g_services_mutex);
+        g_services.push_back(service);
+    }
+    *ppMeetingService = service;
+    return SDKERR_SUCCESS;
+}
+
+SDKError DestroyMeetingService(IMeetingService* pMeetingService) {
+    auto* service = static_cast<MeetingService*>(pMeetingService);
+    if (!service) return SDKERR_INVALID_PARAMETER;
+    {
+        std::lock_guard<std::mutex> lock(g_services_mutex);
+        g_services.erase(std::remove(g_services.begin(), g_services.end(), service), g_services.end());
+    }
+    delete service;
+    return SDKERR_SUCCESS;
+}
+
+SDKError CreateAuthService(IAuthService** ppAuthService) {
+    if (!ppAuthService) return SDKERR_INVALID_PARAMETER;
+    if (!g_initialized) return SDKERR_UNINITIALIZE;
+    *ppAuthService = new AuthService();
+    return SDKERR_SUCCESS;
+}
+
+SDKError DestroyAuthService(IAuthService* pAuthService) {
+    delete pAuthService;
+    return SDKERR_SUCCESS;
+}
+
+SDKError CreateSettingService(ISettingService** ppSettingService) {
+    if (!ppSettingService) return SDKERR_INVALID_PARAMETER;
+    if (!g_initialized) return SDKERR_UNINITIALIZE;
+    *ppSettingService = new SettingService();
+    return SDKERR_SUCCESS;
+}
+
+SDKError DestroySettingService(ISettingService* pSettingService) {
+    delete pSettingService;
+    return SDKERR_SUCCESS;
+}
+
+SDKError CreateNetworkConnectionHelper(INetworkConnectionHelper** ppNetworkHelper) {
+    if (!ppNetworkHelper) return SDKERR_INVALID_PARAMETER;
+    *ppNetworkHelper = new NetworkConnectionHelper();
+    return SDKERR_SUCCESS;
+}
+
+SDKError DestroyNetworkConnectionHelper(INetworkConnectionHelper* pNetworkHelper) {
+    delete pNetworkHelper;
+    return SDKERR_SUCCESS;
+}
+
+bool HasRawdataLicense() {
+    return true;
+}
+
+SDKError createRenderer(IZoomSDKRenderer** ppRenderer, IZoomSDKRendererDelegate* pDelegate) {
+    if (!ppRenderer || !pDelegate) return SDKERR_INVALID_PARAMETER;
+
+    MeetingService* service = current_service();
+    if (!service) return SDKERR_UNINITIALIZE;
+
+    auto* renderer = new Renderer(service, pDelegate);
+    service->addRenderer(renderer);
+    *ppRenderer = renderer;
+    return SDKERR_SUCCESS;
+}
+
+SDKError destroyRenderer(IZoomSDKRenderer* pRenderer) {
+    auto* renderer = static_cast<Renderer*>(pRenderer);
+    if (!renderer) return SDKERR_INVALID_PARAMETER;
+
+    renderer->unSubscribe();
+    if (auto* service = renderer->service()) {
+        service->removeRenderer(renderer);
+    }
+    renderer->delegate()->onRendererBeDestroyed();
+    delete renderer;
+    return SDKERR_SUCCESS;
+}
+
+IZoomSDKAudioRawDataHelper* GetAudioRawdataHelper() {
+    MeetingService* service = current_service();
+    return service ? service->audioHelper() : nullptr;
+}
+
+END_ZOOM_SDK_NAMESPACE
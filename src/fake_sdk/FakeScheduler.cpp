@@ -0,0 +1,34 @@
+#include "FakeScheduler.h"
+
+namespace FakeSDK {
+
+Scheduler::Scheduler()
+    : m_context(g_main_context_ref_thread_default())
+    , m_alive(std::make_shared<std::atomic<bool>>(true)) {}
+
+Scheduler::~Scheduler() {
+    m_alive->store(false);
+    g_main_context_unref(m_context);
+}
+
+void Scheduler::post(unsigned delayMs, std::function<void()> fn) {
+    auto* pending = new Pending{std::move(fn), m_alive};
+    GSource* source = delayMs ? g_timeout_source_new(delayMs) : g_idle_source_new();
+    g_source_set_callback(source, fire, pending, release);
+    g_source_attach(source, m_context);
+    g_source_unref(source);
+}
+
+gboolean Scheduler::fire(gpointer data) {
+    auto* pending = static_cast<Pending*>(data);
+    if (pending->alive->load()) {
+        pending->fn();
+    }
+    return G_SOURCE_REMOVE;
+}
+
+void Scheduler::release(gpointer data) {
+    delete static_cast<Pending*>(data);
+}
+
+} // namespace FakeSDK
@@ -0,0 +1,48 @@
+#ifndef HEADLESS_ZOOM_BOT_FAKE_SCHEDULER_H
+#define HEADLESS_ZOOM_BOT_FAKE_SCHEDULER_H
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include <glib.h>
+
+namespace FakeSDK {
+
+/**
+ * Runs SDK callbacks on the GMainContext a service was created on
+ *
+ * The real SDK delivers control callbacks from the glib main loop of the
+ * thread that created the service. Callbacks still pending when the
+ * scheduler is destroyed are skipped.
+ */
+class Scheduler {
+public:
+    // Uses the calling thread's default context
+    Scheduler();
+    ~Scheduler();
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    // Run fn after delayMs, 0 for the next loop iteration
+    void post(unsigned delayMs, std::function<void()> fn);
+
+    GMainContext* context() const { return m_context; }
+
+private:
+    struct Pending {
+        std::function<void()> fn;
+        std::shared_ptr<std::atomic<bool>> alive;
+    };
+
+    static gboolean fire(gpointer data);
+    static void release(gpointer data);
+
+    GMainContext* m_context;
+    std::shared_ptr<std::atomic<bool>> m_alive;
+};
+
+} // namespace FakeSDK
+
+#endif // HEADLESS_ZOOM_BOT_FAKE_SCHEDULER_H
@@ -0,0 +1,64 @@
+#ifndef _AUTH_SERVICE_INTERFACE_H_
+#define _AUTH_SERVICE_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+enum AuthResult {
+    AUTHRET_SUCCESS,
+    AUTHRET_KEYORSECRETEMPTY,
+    AUTHRET_KEYORSECRETWRONG,
+    AUTHRET_ACCOUNTNOTSUPPORT,
+    AUTHRET_ACCOUNTNOTENABLESDK,
+    AUTHRET_UNKNOWN,
+    AUTHRET_SERVICE_BUSY,
+    AUTHRET_NONE,
+    AUTHRET_OVERTIME,
+    AUTHRET_NETWORKISSUE,
+    AUTHRET_CLIENT_INCOMPATIBLE,
+    AUTHRET_JWTTOKENWRONG,
+};
+
+enum LOGINSTATUS {
+    LOGIN_IDLE,
+    LOGIN_PROCESSING,
+    LOGIN_SUCCESS,
+    LOGIN_FAILED,
+};
+
+enum LoginFailReason {
+    LoginFail_None = 0,
+};
+
+struct AuthContext {
+    const zchar_t* jwt_token = nullptr;
+};
+
+class IAccountInfo {
+public:
+    virtual ~IAccountInfo() {}
+    virtual const zchar_t* GetDisplayName() = 0;
+};
+
+class IAuthServiceEvent {
+public:
+    virtual ~IAuthServiceEvent() {}
+    virtual void onAuthenticationReturn(AuthResult ret) = 0;
+    virtual void onLoginReturnWithReason(LOGINSTATUS ret, IAccountInfo* pAccountInfo, LoginFailReason reason) = 0;
+    virtual void onLogout() = 0;
+    virtual void onZoomIdentityExpired() = 0;
+    virtual void onZoomAuthIdentityExpired() = 0;
+};
+
+class IAuthService {
+public:
+    virtual ~IAuthService() {}
+    virtual SDKError SetEvent(IAuthServiceEvent* pEvent) = 0;
+    virtual SDKError SDKAuth(AuthContext& authContext) = 0;
+    virtual AuthResult GetAuthResult() = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
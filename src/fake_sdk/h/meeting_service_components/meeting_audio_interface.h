@@ -0,0 +1,50 @@
+#ifndef _MEETING_AUDIO_INTERFACE_H_
+#define _MEETING_AUDIO_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+enum AudioStatus { Audio_None, Audio_Muted, Audio_UnMuted, Audio_Muted_ByHost, Audio_UnMuted_ByHost, Audio_MutedAll_ByHost, Audio_UnMutedAll_ByHost };
+enum AudioType { AUDIOTYPE_NONE, AUDIOTYPE_VOIP, AUDIOTYPE_PHONE, AUDIOTYPE_UNKNOWN };
+
+class IUserAudioStatus {
+public:
+    virtual unsigned int GetUserId() = 0;
+    virtual AudioStatus GetStatus() = 0;
+    virtual AudioType GetAudioType() = 0;
+    virtual ~IUserAudioStatus() {}
+};
+
+class IRequestStartAudioHandler {
+public:
+    virtual ~IRequestStartAudioHandler() {}
+    virtual unsigned int GetReqFromUserId() = 0;
+    virtual SDKError Ignore() = 0;
+    virtual SDKError Accept() = 0;
+    virtual SDKError Cancel() = 0;
+};
+
+class IMeetingAudioCtrlEvent {
+public:
+    virtual ~IMeetingAudioCtrlEvent() {}
+    virtual void onUserAudioStatusChange(IList<IUserAudioStatus*>* lstAudioStatusChange, const zchar_t* strAudioStatusList = nullptr) = 0;
+    virtual void onUserActiveAudioChange(IList<unsigned int>* plstActiveAudio) = 0;
+    virtual void onHostRequestStartAudio(IRequestStartAudioHandler* handler_) = 0;
+    virtual void onJoin3rdPartyTelephonyAudio(const zchar_t* audioInfo) = 0;
+    virtual void onMuteOnEntryStatusChange(bool bEnabled) = 0;
+};
+
+class IMeetingAudioController {
+public:
+    virtual ~IMeetingAudioController() {}
+    virtual SDKError SetEvent(IMeetingAudioCtrlEvent* pEvent) = 0;
+    virtual SDKError JoinVoip() = 0;
+    virtual SDKError LeaveVoip() = 0;
+    virtual SDKError MuteAudio(unsigned int userid, bool allowUnmuteBySelf = true) = 0;
+    virtual SDKError UnMuteAudio(unsigned int userid) = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
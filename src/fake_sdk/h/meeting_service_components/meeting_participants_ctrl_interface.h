@@ -0,0 +1,27 @@
+#ifndef _MEETING_PARTICIPANTS_CTRL_INTERFACE_H_
+#define _MEETING_PARTICIPANTS_CTRL_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+#include "meeting_audio_interface.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+class IUserInfo {
+public:
+    virtual ~IUserInfo() {}
+    virtual const zchar_t* GetUserName() = 0;
+    virtual unsigned int GetUserID() = 0;
+    virtual AudioType GetAudioJoinType() = 0;
+};
+
+class IMeetingParticipantsController {
+public:
+    virtual ~IMeetingParticipantsController() {}
+    virtual IList<unsigned int>* GetParticipantsList() = 0;
+    virtual IUserInfo* GetUserByUserID(unsigned int userid) = 0;
+    virtual IUserInfo* GetMySelfUser() = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef _MEETING_RECORDING_INTERFACE_H_
+#define _MEETING_RECORDING_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+enum RecordingStatus {
+    Recording_Start,
+    Recording_Stop,
+    Recording_DiskFull,
+    Recording_Pause,
+    Recording_Connecting,
+    Recording_Fail,
+};
+
+enum RequestLocalRecordingStatus {
+    RequestLocalRecording_Granted,
+    RequestLocalRecording_Denied,
+    RequestLocalRecording_Timeout,
+};
+
+enum RequestStartCloudRecordingStatus {
+    RequestStartCloudRecording_Granted,
+    RequestStartCloudRecording_Denied,
+    RequestStartCloudRecording_Timeout,
+};
+
+enum TranscodingStatus {
+    TranscodingStatus_Start,
+    TranscodingStatus_Success,
+    TranscodingStatus_Failed,
+};
+
+class IRequestLocalRecordingPrivilegeHandler {
+public:
+    virtual ~IRequestLocalRecordingPrivilegeHandler() {}
+    virtual SDKError GrantLocalRecordingPrivilege() = 0;
+    virtual SDKError DenyLocalRecordingPrivilege() = 0;
+};
+
+class IRequestStartCloudRecordingHandler {
+public:
+    virtual ~IRequestStartCloudRecordingHandler() {}
+    virtual SDKError Start() = 0;
+    virtual SDKError Deny() = 0;
+};
+
+class IRequestEnableAndStartSmartRecordingHandler {
+public:
+    virtual ~IRequestEnableAndStartSmartRecordingHandler() {}
+    virtual SDKError Start() = 0;
+    virtual SDKError Decline() = 0;
+};
+
+class ISmartRecordingEnableActionHandler {
+public:
+    virtual ~ISmartRecordingEnableActionHandler() {}
+    virtual SDKError Confirm() = 0;
+    virtual SDKError Cancel() = 0;
+};
+
+class IMeetingRecordingCtrlEvent {
+public:
+    virtual ~IMeetingRecordingCtrlEvent() {}
+    virtual void onRecordingStatus(RecordingStatus status) = 0;
+    virtual void onCloudRecordingStatus(RecordingStatus status) = 0;
+    virtual void onRecordPrivilegeChanged(bool bCanRec) = 0;
+    virtual void onLocalRecordingPrivilegeRequestStatus(RequestLocalRecordingStatus status) = 0;
+    virtual void onRequestCloudRecordingResponse(RequestStartCloudRecordingStatus status) = 0;
+    virtual void onLocalRecordingPrivilegeRequested(IRequestLocalRecordingPrivilegeHandler* handler) = 0;
+    virtual void onStartCloudRecordingRequested(IRequestStartCloudRecordingHandler* handler) = 0;
+    virtual void onCloudRecordingStorageFull(time_t gracePeriodDate) = 0;
+    virtual void onEnableAndStartSmartRecordingRequested(IRequestEnableAndStartSmartRecordingHandler* handler) = 0;
+    virtual void onSmartRecordingEnableActionCallback(ISmartRecordingEnableActionHandler* handler) = 0;
+    virtual void onTranscodingStatusChanged(TranscodingStatus status, const zchar_t* path) = 0;
+};
+
+class IMeetingRecordingController {
+public:
+    virtual ~IMeetingRecordingController() {}
+    virtual SDKError SetEvent(IMeetingRecordingCtrlEvent* pEvent) = 0;
+    virtual SDKError CanStartRawRecording() = 0;
+    virtual SDKError StartRawRecording() = 0;
+    virtual SDKError StopRawRecording() = 0;
+    virtual SDKError RequestLocalRecordingPrivilege() = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
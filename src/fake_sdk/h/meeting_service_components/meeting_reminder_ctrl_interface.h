@@ -0,0 +1,54 @@
+#ifndef _MEETING_REMINDER_CTRL_INTERFACE_H_
+#define _MEETING_REMINDER_CTRL_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+enum MeetingReminderType {
+    TYPE_LOGIN_REQUIRED,
+    TYPE_START_OR_JOIN_MEETING,
+    TYPE_RECORD_REMINDER,
+};
+
+class IMeetingReminderContent {
+public:
+    virtual ~IMeetingReminderContent() {}
+    virtual MeetingReminderType GetType() = 0;
+    virtual const zchar_t* GetTitle() = 0;
+    virtual const zchar_t* GetContent() = 0;
+    virtual bool IsBlocking() = 0;
+};
+
+class IMeetingReminderHandler {
+public:
+    virtual ~IMeetingReminderHandler() {}
+    virtual SDKError Ignore() = 0;
+    virtual SDKError Accept() = 0;
+    virtual SDKError Decline() = 0;
+};
+
+class IMeetingEnableReminderHandler {
+public:
+    virtual ~IMeetingEnableReminderHandler() {}
+    virtual SDKError Ignore() = 0;
+    virtual SDKError Start() = 0;
+    virtual SDKError Decline() = 0;
+};
+
+class IMeetingReminderEvent {
+public:
+    virtual ~IMeetingReminderEvent() {}
+    virtual void onReminderNotify(IMeetingReminderContent* content, IMeetingReminderHandler* handle) = 0;
+    virtual void onEnableReminderNotify(IMeetingReminderContent* content, IMeetingEnableReminderHandler* handle) = 0;
+};
+
+class IMeetingReminderController {
+public:
+    virtual ~IMeetingReminderController() {}
+    virtual SDKError SetEvent(IMeetingReminderEvent* pEvent) = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef _MEETING_SHARING_INTERFACE_H_
+#define _MEETING_SHARING_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+enum SharingStatus {
+    Sharing_Self_Send_Begin,
+    Sharing_Self_Send_End,
+    Sharing_Self_Send_Pure_Audio_Begin,
+    Sharing_Self_Send_Pure_Audio_End,
+    Sharing_Other_Share_Begin,
+    Sharing_Other_Share_End,
+    Sharing_Other_Share_Pure_Audio_Begin,
+    Sharing_Other_Share_Pure_Audio_End,
+    Sharing_View_Other_Sharing,
+    Sharing_Pause,
+    Sharing_Resume,
+};
+
+enum ShareSettingType {
+    ShareSettingType_LOCK_SHARE,
+    ShareSettingType_HOST_GRAB,
+    ShareSettingType_ANYONE_GRAB,
+    ShareSettingType_MULTI_SHARE,
+};
+
+enum ZoomSDKVideoFileSharePlayError {
+    ZoomSDKVideoFileSharePlayError_None,
+    ZoomSDKVideoFileSharePlayError_Not_Supported,
+};
+
+struct ZoomSDKSharingSourceInfo {
+    unsigned int userid = 0;
+    unsigned int shareSourceID = 0;
+    SharingStatus status = Sharing_Other_Share_End;
+    bool isShowingInFirstView = false;
+    bool isShowingInSecondView = false;
+    bool isCanBeRemoteControl = false;
+    bool bEnableOptimizingVideoSharing = false;
+};
+
+class IShareSwitchMultiToSingleConfirmHandler {
+public:
+    virtual ~IShareSwitchMultiToSingleConfirmHandler() {}
+    virtual SDKError Cancel() = 0;
+    virtual SDKError Confirm() = 0;
+};
+
+class IMeetingShareCtrlEvent {
+public:
+    virtual ~IMeetingShareCtrlEvent() {}
+    virtual void onSharingStatus(ZoomSDKSharingSourceInfo shareInfo) = 0;
+    virtual void onFailedToStartShare() = 0;
+    virtual void onLockShareStatus(bool bLocked) = 0;
+    virtual void onShareContentNotification(ZoomSDKSharingSourceInfo shareInfo) = 0;
+    virtual void onMultiShareSwitchToSingleShareNeedConfirm(IShareSwitchMultiToSingleConfirmHandler* handler_) = 0;
+    virtual void onShareSettingTypeChangedNotification(ShareSettingType type) = 0;
+    virtual void onSharedVideoEnded() = 0;
+    virtual void onVideoFileSharePlayError(ZoomSDKVideoFileSharePlayError error) = 0;
+    virtual void onOptimizingShareForVideoClipStatusChanged(ZoomSDKSharingSourceInfo shareInfo) = 0;
+};
+
+class IMeetingShareController {
+public:
+    virtual ~IMeetingShareController() {}
+    virtual SDKError SetEvent(IMeetingShareCtrlEvent* pEvent) = 0;
+    virtual IList<unsigned int>* GetViewableSharingUserList() = 0;
+    virtual IList<ZoomSDKSharingSourceInfo>* GetSharingSourceInfoList(unsigned int userid) = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef _MEETING_VIDEO_INTERFACE_H_
+#define _MEETING_VIDEO_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+class IMeetingVideoController {
+public:
+    virtual ~IMeetingVideoController() {}
+    virtual SDKError MuteVideo() = 0;
+    virtual SDKError UnmuteVideo() = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
@@ -0,0 +1,120 @@
+#ifndef _MEETING_SERVICE_INTERFACE_H_
+#define _MEETING_SERVICE_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+enum MeetingStatus {
+    MEETING_STATUS_IDLE,
+    MEETING_STATUS_CONNECTING,
+    MEETING_STATUS_WAITINGFORHOST,
+    MEETING_STATUS_INMEETING,
+    MEETING_STATUS_DISCONNECTING,
+    MEETING_STATUS_RECONNECTING,
+    MEETING_STATUS_FAILED,
+    MEETING_STATUS_ENDED,
+    MEETING_STATUS_UNKNOWN,
+    MEETING_STATUS_LOCKED,
+    MEETING_STATUS_UNLOCKED,
+    MEETING_STATUS_IN_WAITING_ROOM,
+    MEETING_STATUS_WEBINAR_PROMOTE,
+    MEETING_STATUS_WEBINAR_DEPROMOTE,
+    MEETING_STATUS_JOIN_BREAKOUT_ROOM,
+    MEETING_STATUS_LEAVE_BREAKOUT_ROOM,
+};
+
+enum StatisticsWarningType {
+    Statistics_Warning_None,
+    Statistics_Warning_Network_Quality_Bad,
+};
+
+enum SDKUserType {
+    SDK_UT_NORMALUSER = 100,
+    SDK_UT_WITHOUT_LOGIN,
+};
+
+enum LeaveMeetingCmd {
+    LEAVE_MEETING,
+    END_MEETING,
+};
+
+struct MeetingParameter {
+    UINT64 meeting_number = 0;
+    const zchar_t* meeting_topic = nullptr;
+};
+
+struct JoinParam4WithoutLogin {
+    UINT64 meetingNumber;
+    const zchar_t* vanityID;
+    const zchar_t* userName;
+    const zchar_t* psw;
+    const zchar_t* app_privilege_token;
+    const zchar_t* customer_key;
+    const zchar_t* webinarToken;
+    bool isVideoOff;
+    bool isAudioOff;
+};
+
+struct StartParam4NormalUser {
+    UINT64 meetingNumber;
+    const zchar_t* vanityID;
+    const zchar_t* customer_key;
+    bool isVideoOff;
+    bool isAudioOff;
+};
+
+struct JoinParam {
+    SDKUserType userType;
+    union {
+        JoinParam4WithoutLogin withoutloginuserJoin;
+    } param;
+    JoinParam() : userType(SDK_UT_WITHOUT_LOGIN) { param.withoutloginuserJoin = {}; }
+};
+
+struct StartParam {
+    SDKUserType userType;
+    union {
+        StartParam4NormalUser normaluserStart;
+    } param;
+    StartParam() : userType(SDK_UT_NORMALUSER) { param.normaluserStart = {}; }
+};
+
+class IMeetingServiceEvent {
+public:
+    virtual ~IMeetingServiceEvent() {}
+    virtual void onMeetingStatusChanged(MeetingStatus status, int iResult = 0) = 0;
+    virtual void onMeetingStatisticsWarningNotification(StatisticsWarningType type) = 0;
+    virtual void onMeetingParameterNotification(const MeetingParameter* meeting_param) = 0;
+    virtual void onSuspendParticipantsActivities() = 0;
+    virtual void onAICompanionActiveChangeNotice(bool bActive) = 0;
+    virtual void onMeetingTopicChanged(const zchar_t* sTopic) = 0;
+    virtual void onMeetingFullToWatchLiveStream(const zchar_t* sLiveStreamUrl) = 0;
+};
+
+class IMeetingAudioController;
+class IMeetingVideoController;
+class IMeetingParticipantsController;
+class IMeetingRecordingController;
+class IMeetingReminderController;
+class IMeetingShareController;
+
+class IMeetingService {
+public:
+    virtual ~IMeetingService() {}
+    virtual SDKError SetEvent(IMeetingServiceEvent* pEvent) = 0;
+    virtual SDKError Join(JoinParam& joinParam) = 0;
+    virtual SDKError Start(StartParam& startParam) = 0;
+    virtual SDKError Leave(LeaveMeetingCmd leaveCmd) = 0;
+    virtual MeetingStatus GetMeetingStatus() = 0;
+    virtual IMeetingAudioController* GetMeetingAudioController() = 0;
+    virtual IMeetingVideoController* GetMeetingVideoController() = 0;
+    virtual IMeetingParticipantsController* GetMeetingParticipantsController() = 0;
+    virtual IMeetingRecordingController* GetMeetingRecordingController() = 0;
+    virtual IMeetingReminderController* GetMeetingReminderController() = 0;
+    virtual IMeetingShareController* GetMeetingShareController() = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
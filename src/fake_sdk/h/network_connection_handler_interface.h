@@ -0,0 +1,21 @@
+#ifndef _NETWORK_CONNECTION_HANDLER_INTERFACE_H_
+#define _NETWORK_CONNECTION_HANDLER_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+struct ProxySettings {
+    const zchar_t* proxy = nullptr;
+    bool auto_detect = false;
+};
+
+class INetworkConnectionHelper {
+public:
+    virtual ~INetworkConnectionHelper() {}
+    virtual SDKError ConfigureProxy(ProxySettings& proxySetting) = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef _RAWDATA_AUDIO_HELPER_INTERFACE_H_
+#define _RAWDATA_AUDIO_HELPER_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+#include "zoom_sdk_raw_data_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+class IZoomSDKAudioRawDataDelegate {
+public:
+    virtual ~IZoomSDKAudioRawDataDelegate() {}
+    virtual void onMixedAudioRawDataReceived(AudioRawData* data_) = 0;
+    virtual void onOneWayAudioRawDataReceived(AudioRawData* data_, uint32_t node_id) = 0;
+    virtual void onShareAudioRawDataReceived(AudioRawData* data_, uint32_t node_id) = 0;
+    virtual void onOneWayInterpreterAudioRawDataReceived(AudioRawData* data_, const zchar_t* pLanguageName) = 0;
+};
+
+class IZoomSDKAudioRawDataHelper {
+public:
+    virtual ~IZoomSDKAudioRawDataHelper() {}
+    virtual SDKError subscribe(IZoomSDKAudioRawDataDelegate* pDelegate, bool bWithInterpreters = false) = 0;
+    virtual SDKError unSubscribe() = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef _RAWDATA_RENDERER_INTERFACE_H_
+#define _RAWDATA_RENDERER_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+#include "zoom_sdk_raw_data_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+enum ZoomSDKRawDataType {
+    RAW_DATA_TYPE_VIDEO = 0,
+    RAW_DATA_TYPE_SHARE,
+};
+
+enum ZoomSDKResolution {
+    ZoomSDKResolution_90P = 0,
+    ZoomSDKResolution_180P,
+    ZoomSDKResolution_360P,
+    ZoomSDKResolution_720P,
+    ZoomSDKResolution_1080P,
+    ZoomSDKResolution_NoUse = 100,
+};
+
+class IZoomSDKRendererDelegate {
+public:
+    virtual ~IZoomSDKRendererDelegate() {}
+    virtual void onRawDataFrameReceived(YUVRawDataI420* data_) = 0;
+    virtual void onRawDataStatusChanged(RawDataStatus status) = 0;
+    virtual void onRendererBeDestroyed() = 0;
+};
+
+class IZoomSDKRenderer {
+public:
+    virtual ~IZoomSDKRenderer() {}
+    virtual SDKError setRawDataResolution(ZoomSDKResolution resolution) = 0;
+    virtual SDKError subscribe(uint32_t subscribeId, ZoomSDKRawDataType type) = 0;
+    virtual SDKError unSubscribe() = 0;
+    virtual ZoomSDKRawDataType getRawDataType() = 0;
+    virtual uint32_t getSubscribeId() = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
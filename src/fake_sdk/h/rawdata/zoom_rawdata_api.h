@@ -0,0 +1,19 @@
+#ifndef _ZOOM_RAWDATA_API_H_
+#define _ZOOM_RAWDATA_API_H_
+
+#include "zoom_sdk_def.h"
+#include "rawdata_audio_helper_interface.h"
+#include "rawdata_renderer_interface.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+extern "C" {
+SDK_API bool HasRawdataLicense();
+SDK_API SDKError createRenderer(IZoomSDKRenderer** ppRenderer, IZoomSDKRendererDelegate* pDelegate);
+SDK_API SDKError destroyRenderer(IZoomSDKRenderer* pRenderer);
+SDK_API IZoomSDKAudioRawDataHelper* GetAudioRawdataHelper();
+}
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef _SETTING_SERVICE_INTERFACE_H_
+#define _SETTING_SERVICE_INTERFACE_H_
+
+#include "zoom_sdk_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+class IAudioSettingContext {
+public:
+    virtual ~IAudioSettingContext() {}
+    virtual SDKError EnableAutoJoinAudio(bool bEnable) = 0;
+    virtual bool IsAutoJoinAudioEnabled() = 0;
+};
+
+class ISettingService {
+public:
+    virtual ~ISettingService() {}
+    virtual IAudioSettingContext* GetAudioSettings() = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef _ZOOM_SDK_H_
+#define _ZOOM_SDK_H_
+
+#include "zoom_sdk_def.h"
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+class IMeetingService;
+class IAuthService;
+class ISettingService;
+class INetworkConnectionHelper;
+
+struct InitParam {
+    const zchar_t* strWebDomain = nullptr;
+    const zchar_t* strSupportUrl = nullptr;
+    SDK_LANGUAGE_ID emLanguageID = LANGUAGE_Unknown;
+    bool enableLogByDefault = false;
+    bool enableGenerateDump = false;
+};
+
+extern "C" {
+SDK_API SDKError InitSDK(InitParam& initParam);
+SDK_API SDKError CleanUPSDK();
+SDK_API SDKError CreateMeetingService(IMeetingService** ppMeetingService);
+SDK_API SDKError DestroyMeetingService(IMeetingService* pMeetingService);
+SDK_API SDKError CreateAuthService(IAuthService** ppAuthService);
+SDK_API SDKError DestroyAuthService(IAuthService* pAuthService);
+SDK_API SDKError CreateSettingService(ISettingService** ppSettingService);
+SDK_API SDKError DestroySettingService(ISettingService* pSettingService);
+SDK_API SDKError CreateNetworkConnectionHelper(INetworkConnectionHelper** ppNetworkHelper);
+SDK_API SDKError DestroyNetworkConnectionHelper(INetworkConnectionHelper* pNetworkHelper);
+}
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
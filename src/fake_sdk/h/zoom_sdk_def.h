@@ -0,0 +1,77 @@
+/*
+ * Stand-in for the Meeting SDK headers, used with -DFAKE_MEETINGSDK=ON
+ *
+ * Only the declarations the bot and the C API use, with the SDK's names and
+ * signatures, so the same sources build against either. Not ABI compatible
+ * with Zoom's libmeetingsdk.so: a build against these headers must run with
+ * the stand-in library from fake_sdk/.
+ */
+#ifndef _ZOOM_SDK_DEF_H_
+#define _ZOOM_SDK_DEF_H_
+
+#include <cstdint>
+#include <ctime>
+
+#define ZOOM_SDK_NAMESPACE ZOOMSDK
+#define BEGIN_ZOOM_SDK_NAMESPACE namespace ZOOM_SDK_NAMESPACE {
+#define END_ZOOM_SDK_NAMESPACE }
+#define USING_ZOOM_SDK_NAMESPACE using namespace ZOOM_SDK_NAMESPACE;
+#define SDK_API __attribute__((visibility("default")))
+
+typedef char zchar_t;
+typedef unsigned long long UINT64;
+
+BEGIN_ZOOM_SDK_NAMESPACE
+
+enum SDKError {
+    SDKERR_SUCCESS = 0,
+    SDKERR_NO_IMPL,
+    SDKERR_WRONG_USAGE,
+    SDKERR_INVALID_PARAMETER,
+    SDKERR_MODULE_LOAD_FAILED,
+    SDKERR_MEMORY_FAILED,
+    SDKERR_SERVICE_FAILED,
+    SDKERR_UNINITIALIZE,
+    SDKERR_UNAUTHENTICATION,
+    SDKERR_NORECORDINGINPROCESS,
+    SDKERR_TRANSCODER_NOFOUND,
+    SDKERR_VIDEO_NOTREADY,
+    SDKERR_NO_PERMISSION,
+    SDKERR_UNKNOWN,
+    SDKERR_OTHER_SDK_INSTANCE_RUNNING,
+    SDKERR_INTERNAL_ERROR,
+    SDKERR_NO_AUDIODEVICE_ISFOUND,
+    SDKERR_NO_VIDEODEVICE_ISFOUND,
+    SDKERR_TOO_FREQUENT_CALL,
+    SDKERR_FAIL_ASSIGN_USER_PRIVILEGE,
+    SDKERR_MEETING_DONT_SUPPORT_FEATURE,
+    SDKERR_MEETING_NOT_SHARE_SENDER,
+    SDKERR_MEETING_YOU_HAVE_NO_SHARE,
+    SDKERR_MEETING_VIEWTYPE_PARAMETER_IS_WRONG,
+    SDKERR_MEETING_ANNOTATION_IS_OFF,
+    SDKERR_SETTING_OS_DONT_SUPPORT,
+    SDKERR_EMAIL_LOGIN_IS_DISABLED,
+    SDKERR_HARDWARE_NOT_MEET_FOR_VB,
+    SDKERR_NEED_USER_CONFIRM_RECORD_DISCLAIMER,
+    SDKERR_NO_SHARE_DATA,
+    SDKERR_SHARE_CANNOT_SUBSCRIBE_MYSELF,
+    SDKERR_NOT_IN_MEETING,
+    SDKERR_NOT_JOIN_AUDIO,
+};
+
+enum SDK_LANGUAGE_ID {
+    LANGUAGE_Unknown = 0,
+    LANGUAGE_English,
+};
+
+template<class T>
+class IList {
+public:
+    virtual ~IList() {}
+    virtual int GetCount() = 0;
+    virtual T GetItem(int index) = 0;
+};
+
+END_ZOOM_SDK_NAMESPACE
+
+#endif
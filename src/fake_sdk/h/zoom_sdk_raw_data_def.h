@@ -0,0 +1,42 @@
+#ifndef _ZOOM_SDK_RAW_DATA_DEF_H_
+#define _ZOOM_SDK_RAW_DATA_DEF_H_
+
+#include "zoom_sdk_def.h"
+
+enum RawDataStatus {
+    RawData_On,
+    RawData_Off,
+};
+
+class AudioRawData {
+public:
+    virtual ~AudioRawData() {}
+    virtual bool CanAddRef() = 0;
+    virtual bool AddRef() = 0;
+    virtual int Release() = 0;
+    virtual char* GetBuffer() = 0;
+    virtual unsigned int GetBufferLen() = 0;
+    virtual unsigned int GetSampleRate() = 0;
+    virtual unsigned int GetChannelNum() = 0;
+};
+
+class YUVRawDataI420 {
+public:
+    virtual ~YUVRawDataI420() {}
+    virtual bool CanAddRef() = 0;
+    virtual bool AddRef() = 0;
+    virtual int Release() = 0;
+    virtual char* GetYBuffer() = 0;
+    virtual char* GetUBuffer() = 0;
+    virtual char* GetVBuffer() = 0;
+    virtual char* GetBuffer() = 0;
+    virtual unsigned int GetBufferLen() = 0;
+    virtual bool IsLimitedI420() = 0;
+    virtual unsigned int GetStreamWidth() = 0;
+    virtual unsigned int GetStreamHeight() = 0;
+    virtual unsigned int GetRotation() = 0;
+    virtual unsigned int GetSourceID() = 0;
+    virtual unsigned long long GetTimeStamp() = 0;
+};
+
+#endif
@@ -0,0 +1,157 @@
+/*
+ * Example media plugin: speech start/stop triggers
+ *
+ * Watches the one-way audio of every participant and logs when each one starts
+ * and stops speaking, and on flush how long each spoke. Frames are passed on
+ * unchanged.
+ *
+ * Config: "threshold=<rms>,hangover=<frames>", both optional
+ * (defaults 500 and 30, i.e. about -36 dBFS and 300 ms of 10 ms frames).
+ *
+ *   ZOOM_SDK_PLUGINS="/path/to/libspeech_trigger.so=threshold=800" ./headless_zoom_bot_c ...
+ */
+
+#include "zoom_sdk_plugin.h"
+#include "zoom_sdk_c.h"
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_STREAMS 256
+
+typedef struct {
+    void* meeting;                  // NULL if the slot is free
+    unsigned int node_id;
+    int speaking;
+    unsigned int quiet_frames;
+    unsigned long long started_ns;
+    unsigned long long spoken_ns;
+} Stream;
+
+typedef struct {
+    const ZoomPluginHost* host;
+    unsigned long long threshold;
+    unsigned int hangover;
+    pthread_mutex_t mutex;          // Guards slot allocation; a slot's fields belong to its stream's thread
+    Stream streams[MAX_STREAMS];
+} State;
+
+static void plugin_log(State* state, int level, const char* fmt, ...) __attribute__((format(printf, 3, 4)));
+
+static void plugin_log(State* state, int level, const char* fmt, ...) {
+    char line[256];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(line, sizeof(line), fmt, args);
+    va_end(args);
+    state->host->log(state->host->plugin, level, line);
+}
+
+// Slot of a stream, claimed on its first frame; NULL if all slots are taken
+static Stream* find_stream(State* state, void* meeting, unsigned int node_id) {
+    pthread_mutex_lock(&state->mutex);
+    Stream* found = NULL;
+    Stream* free_slot = NULL;
+    for (size_t i = 0; i < MAX_STREAMS && !found; i++) {
+        Stream* s = &state->streams[i];
+        if (s->meeting == meeting && s->node_id == node_id) {
+            found = s;
+        } else if (!s->meeting && !free_slot) {
+            free_slot = s;
+        }
+    }
+    if (!found && free_slot) {
+        memset(free_slot, 0, sizeof(*free_slot));
+        free_slot->meeting = meeting;
+        free_slot->node_id = node_id;
+        found = free_slot;
+    }
+    pthread_mutex_unlock(&state->mutex);
+    return found;
+}
+
+static int init(const ZoomPluginHost* host, const char* config, void** out) {
+    State* state = calloc(1, sizeof(State));
+    if (!state) return -1;
+    state->host = host;
+    state->threshold = 500;
+    state->hangover = 30;
+    pthread_mutex_init(&state->mutex, NULL);
+
+    const char* threshold = strstr(config, "threshold=");
+    const char* hangover = strstr(config, "hangover=");
+    if (threshold) state->threshold = strtoull(threshold + strlen("threshold="), NULL, 10);
+    if (hangover) state->hangover = (unsigned int)strtoul(hangover + strlen("hangover="), NULL, 10);
+
+    plugin_log(state, ZOOM_PLUGIN_LOG_INFO, "threshold %llu rms, hangover %u frames", state->threshold, state->hangover);
+    *out = state;
+    return 0;
+}
+
+static int process_frame(void* opaque, const ZoomPluginFrame* frame) {
+    State* state = opaque;
+    if (frame->audio_type != ZOOM_AUDIO_TYPE_ONE_WAY || frame->length < 2) return ZOOM_PLUGIN_CONTINUE;
+
+    const int16_t* samples = frame->data;
+    int count = frame->length / 2;
+    unsigned long long energy = 0;
+    for (int i = 0; i < count; i++) {
+        energy += (unsigned long long)((int32_t)samples[i] * samples[i]);
+    }
+    int voiced = energy > state->threshold * state->threshold * (unsigned long long)count;
+
+    Stream* s = find_stream(state, frame->meeting, frame->node_id);
+    if (!s) return ZOOM_PLUGIN_CONTINUE;
+
+    if (voiced) {
+        s->quiet_frames = 0;
+        if (!s->speaking) {
+            s->speaking = 1;
+            s->started_ns = frame->ingress_ns;
+            plugin_log(state, ZOOM_PLUGIN_LOG_INFO, "meeting %p node %u started speaking", frame->meeting, frame->node_id);
+        }
+    } else if (s->speaking && ++s->quiet_frames > state->hangover) {
+        s->speaking = 0;
+        s->spoken_ns += frame->ingress_ns - s->started_ns;
+        plugin_log(state, ZOOM_PLUGIN_LOG_INFO, "meeting %p node %u stopped speaking", frame->meeting, frame->node_id);
+    }
+    return ZOOM_PLUGIN_CONTINUE;
+}
+
+static void flush(void* opaque, void* meeting) {
+    State* state = opaque;
+    unsigned long long now = state->host->monotonic_ns();
+    pthread_mutex_lock(&state->mutex);
+    for (size_t i = 0; i < MAX_STREAMS; i++) {
+        Stream* s = &state->streams[i];
+        if (!s->meeting || (meeting && s->meeting != meeting)) continue;
+        unsigned long long spoken = s->spoken_ns + (s->speaking ? now - s->started_ns : 0);
+        plugin_log(state, ZOOM_PLUGIN_LOG_INFO, "meeting %p node %u spoke %.1f s", s->meeting, s->node_id, spoken / 1e9);
+        s->meeting = NULL;
+    }
+    pthread_mutex_unlock(&state->mutex);
+}
+
+static void shutdown_plugin(void* opaque) {
+    State* state = opaque;
+    pthread_mutex_destroy(&state->mutex);
+    free(state);
+}
+
+static const ZoomPlugin kPlugin = {
+    .abi_version = ZOOM_PLUGIN_ABI_VERSION,
+    .name = "speech_trigger",
+    .frame_kinds = ZOOM_PLUGIN_AUDIO,
+    .init = init,
+    .process_frame = process_frame,
+    .flush = flush,
+    .shutdown = shutdown_plugin,
+};
+
+__attribute__((visibility("default"))) const ZoomPlugin* zoom_plugin_entry(unsigned int host_abi_version) {
+    (void)host_abi_version;
+    return &kPlugin;
+}
@@ -0,0 +1,169 @@
+// Record media captures from the stand-in SDK and replay captures through the C API
+//
+// usage: media_replay record <capture> [seconds=10]
+//        media_replay play <capture> [speed=0] [meetings=1]
+//
+// Builds with -DFAKE_MEETINGSDK=ON. "record" joins one synthetic meeting with
+// audio and share video (participants and rates from the ZOOM_FAKE_SDK_*
+// variables) and captures its raw callbacks. Captures taken from real meetings
+// with ZOOM_SDK_CAPTURE or zoom_meeting_start_capture() replay the same way.
+//
+// "play" joins one stand-in meeting per replay thread, with the fake SDK's own
+// media turned off, and feeds the capture through zoom_meeting_replay_capture()
+// on each: speed 1 keeps the captured pacing, 0 replays as fast as possible.
+// It reports frames/s and the dispatch latency seen by the callbacks, which is
+// the workload to profile or train PGO on.
+
+#include "zoom_sdk_c.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using Clock = std::chrono::steady_clock;
+
+// Dispatch latency samples of the callback thread, ingress to callback
+static thread_local std::vector<uint32_t>* t_latencies = nullptr;
+static std::atomic<unsigned long long> g_bytes{0};
+
+static void record_latency() {
+    if (t_latencies) {
+        t_latencies->push_back(
+            static_cast<uint32_t>(std::min<unsigned long long>(zoom_sdk_monotonic_ns() - zoom_frame_ingress_ns(),
+                                                               UINT32_MAX)));
+    }
+}
+
+static void on_audio(MeetingHandle, const void*, int length, int, unsigned int) {
+    g_bytes.fetch_add(static_cast<unsigned>(length), std::memory_order_relaxed);
+    record_latency();
+}
+
+static void on_video(MeetingHandle, const char*, const char*, const char*, unsigned int, unsigned int,
+                     unsigned int length, unsigned int, unsigned long long) {
+    g_bytes.fetch_add(length, std::memory_order_relaxed);
+    record_latency();
+}
+
+static int usage(const char* argv0) {
+    std::fprintf(stderr,
+                 "usage: %s record <capture> [seconds=10]\n"
+                 "       %s play <capture> [speed=0] [meetings=1]\n",
+                 argv0, argv0);
+    return 2;
+}
+
+static int record(const char* path, int seconds) {
+    ZoomSDKHandle sdk = zoom_sdk_create("replay", "replay");
+    MeetingHandle meeting = sdk ? zoom_meeting_create_and_join(sdk, "1000", "replay", "replay", nullptr, 1, 1) : nullptr;
+    if (!meeting) {
+        std::fprintf(stderr, "failed to join; build with -DFAKE_MEETINGSDK=ON\n");
+        return 1;
+    }
+    zoom_meeting_set_audio_callback(meeting, on_audio);
+    zoom_meeting_set_video_callback(meeting, on_video);
+    if (zoom_meeting_start_capture(meeting, path) != ZOOM_SDK_SUCCESS) {
+        return 1;
+    }
+
+    std::thread timer([sdk, seconds]() {
+        std::this_thread::sleep_for(std::chrono::seconds(seconds));
+        zoom_sdk_stop_loop(sdk);
+    });
+    zoom_sdk_run_loop(sdk);
+    timer.join();
+
+    zoom_meeting_stop_capture(meeting);
+    zoom_meeting_destroy(meeting);
+    zoom_sdk_destroy(sdk);
+    std::fprintf(stderr, "captured %d s to %s\n", seconds, path);
+    return 0;
+}
+
+static int play(const char* path, double speed, int count) {
+    // The capture is the only media source
+    setenv("ZOOM_FAKE_SDK_AUTH_MS", "0", 0);
+    setenv("ZOOM_FAKE_SDK_JOIN_MS", "0", 0);
+
+    struct Replay {
+        ZoomSDKHandle sdk;
+        MeetingHandle meeting;
+        std::vector<uint32_t> latencies;
+        unsigned long long frames = 0;
+        bool ok = false;
+    };
+    std::vector<Replay> replays(count);
+    for (auto& replay : replays) {
+        replay.sdk = zoom_sdk_create("replay", "replay");
+        replay.meeting = replay.sdk ? zoom_meeting_create_and_join(replay.sdk, "1000", "replay", "replay", nullptr, 0, 0)
+                                    : nullptr;
+        if (!replay.meeting) {
+            std::fprintf(stderr, "failed to join; build with -DFAKE_MEETINGSDK=ON\n");
+            return 1;
+        }
+        zoom_meeting_set_audio_callback(replay.meeting, on_audio);
+        zoom_meeting_set_video_callback(replay.meeting, on_video);
+    }
+
+    auto start = Clock::now();
+    std::vector<std::thread> threads;
+    for (auto& replay : replays) {
+        threads.emplace_back([&replay, path, speed]() {
+            t_latencies = &replay.latencies;
+            replay.ok = zoom_meeting_replay_capture(replay.meeting, path, speed, &replay.frames) == ZOOM_SDK_SUCCESS;
+            t_latencies = nullptr;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<uint32_t> all;
+    unsigned long long frames = 0;
+    for (auto& replay : replays) {
+        if (!replay.ok) return 1;
+        frames += replay.frames;
+        all.insert(all.end(), replay.latencies.begin(), replay.latencies.end());
+        zoom_meeting_destroy(replay.meeting);
+        zoom_sdk_destroy(replay.sdk);
+    }
+    std::sort(all.begin(), all.end());
+
+    std::fprintf(stderr, "%-8s %6s %10s %8s %12s %10s %8s %8s %9s %9s\n", "meetings", "speed", "frames", "secs",
+                 "frames/s", "MB/s", "p50(ns)", "p99(ns)", "p99.9(ns)", "max(ns)");
+    std::fprintf(stderr, "%-8d %6.1f %10llu %8.2f %12.0f %10.1f %8u %8u %9u %9u\n", count, speed, frames, elapsed,
+                 frames / elapsed, g_bytes.load() / elapsed / 1e6, all.empty() ? 0 : all[all.size() / 2],
+                 all.empty() ? 0 : all[all.size() * 99 / 100], all.empty() ? 0 : all[all.size() * 999 / 1000],
+                 all.empty() ? 0 : all.back());
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) return usage(argv[0]);
+
+    // The C API reports every state change on stdout; the results go to stderr
+    if (!freopen("/dev/null", "w", stdout)) {
+        std::perror("stdout");
+        return 1;
+    }
+
+    if (std::strcmp(argv[1], "record") == 0) {
+        return record(argv[2], argc > 3 ? std::atoi(argv[3]) : 10);
+    }
+    if (std::strcmp(argv[1], "play") == 0) {
+        double speed = argc > 3 ? std::atof(argv[3]) : 0;
+        int meetings = argc > 4 ? std::atoi(argv[4]) : 1;
+        if (!std::isfinite(speed) || speed < 0 || meetings < 1) return usage(argv[0]);
+        return play(argv[2], speed, meetings);
+    }
+    return usage(argv[0]);
+}
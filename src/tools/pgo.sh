@@ -0,0 +1,64 @@
+#!/bin/bash
+# Train a PGO profile for libzoomsdk_c on synthetic media and compare builds
+#
+# usage: tools/pgo.sh [--compare]
+#
+# Builds the pgo-generate preset (instrumented libzoomsdk_c against the
+# stand-in SDK), records a synthetic meeting with media_replay and runs the
+# training workload: the capture replayed unpaced on 1 and 4 meetings, which
+# covers the delegates, the delivery modes and the metrics, plus dispatch_bench
+# and ffi_bench for the contended and foreign-thread dispatch paths. The
+# profile lands in build/pgo-profile, where the pgo-use preset picks it up:
+#
+#   cmake --preset pgo-use && cmake --build build/pgo-use -j$(nproc)
+#
+# With --compare it then builds Debug, Release and Release+PGO against the
+# stand-in SDK and runs dispatch_bench and media_replay on each. Set
+# TRAIN_SECONDS to change the length of the recorded meeting (default 10).
+
+set -euo pipefail
+
+cd "$(dirname "$0")/.."
+SRC=$(pwd)
+PROFILE="$SRC/build/pgo-profile"
+JOBS=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1)
+TRAIN_SECONDS=${TRAIN_SECONDS:-10}
+TARGETS=(--target zoomsdk_c media_replay dispatch_bench ffi_bench)
+
+echo "--- Building instrumented libzoomsdk_c ---"
+rm -rf "$PROFILE"
+cmake --preset pgo-generate >/dev/null
+cmake --build build/pgo-generate -j"$JOBS" "${TARGETS[@]}"
+
+echo "--- Training ---"
+cd build/pgo-generate
+./media_replay record train.zmcap "$TRAIN_SECONDS"
+./media_replay play train.zmcap 0 1
+./media_replay play train.zmcap 0 4
+./dispatch_bench 100000 10000 >/dev/null 2>&1
+./ffi_bench 200000 >/dev/null 2>&1
+cd "$SRC"
+echo "Profile written to $PROFILE"
+
+if [[ "${1:-}" != "--compare" ]]; then
+    exit 0
+fi
+
+# Same capture for every variant
+CAPTURE="$SRC/build/pgo-generate/train.zmcap"
+for variant in debug release pgo-use; do
+    dir="build/compare-$variant"
+    cmake --preset "$variant" -B "$dir" -DFAKE_MEETINGSDK=ON -DBUILD_BENCHMARKS=ON >/dev/null
+    cmake --build "$dir" -j"$JOBS" "${TARGETS[@]}" >/dev/null
+done
+
+for variant in debug release pgo-use; do
+    dir="build/compare-$variant"
+    echo
+    echo "=== $variant: dispatch_bench ==="
+    "$dir/dispatch_bench" 200000 20000 2>/dev/null
+    echo "=== $variant: media_replay play, 4 meetings unpaced ==="
+    "$dir/media_replay" play "$CAPTURE" 0 4 2>&1 | tail -2
+    echo "=== $variant: ffi_bench ==="
+    "$dir/ffi_bench" 200000 2>/dev/null
+done
@@ -0,0 +1,200 @@
+#ifndef HEADLESS_ZOOM_BOT_ASYNC_EVENT_H
+#define HEADLESS_ZOOM_BOT_ASYNC_EVENT_H
+
+#include <algorithm>
+#include <chrono>
+#include <coroutine>
+#include <optional>
+#include <vector>
+
+#include <glib.h>
+
+namespace Util {
+
+/**
+ * Latched event that coroutines can co_await on a GLib main context
+ *
+ * set() stores a value and wakes every waiter; later waits complete at once
+ * until reset(). Waiters resume from an idle source on their context rather
+ * than inside set(), so an SDK callback that signals the event returns before
+ * the awaiting coroutine continues. With a timeout, a wait yields
+ * std::nullopt if the event is not set in time.
+ *
+ * Not thread-safe: set, reset and wait must all happen on the thread running
+ * the context, which is where SDK callbacks are delivered.
+ */
+template<typename T = bool>
+class AsyncEvent {
+public:
+    static constexpr std::chrono::milliseconds kNoTimeout{-1};
+
+    class Awaiter {
+    public:
+        Awaiter(AsyncEvent& event, GMainContext* context, std::chrono::milliseconds timeout)
+            : m_event(event), m_context(context), m_timeout(timeout) {}
+        ~Awaiter() { detach(); }
+
+        Awaiter(const Awaiter&) = delete;
+        Awaiter& operator=(const Awaiter&) = delete;
+
+        bool await_ready() {
+            m_result = m_event.m_value;
+            return m_result.has_value();
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            m_handle = handle;
+            m_event.m_waiters.push_back(this);
+            if (m_timeout.count() >= 0) {
+                m_timer = attach(g_timeout_source_new(static_cast<guint>(m_timeout.count())), onTimeout);
+            }
+        }
+
+        std::optional<T> await_resume() { return m_result; }
+
+    private:
+        friend class AsyncEvent;
+
+        GSource* attach(GSource* source, GSourceFunc callback) {
+            g_source_set_priority(source, G_PRIORITY_DEFAULT);
+            g_source_set_callback(source, callback, this, nullptr);
+            g_source_attach(source, m_context);
+            return source;
+        }
+
+        static void release(GSource*& source) {
+            if (source) {
+                g_source_destroy(source);
+                g_source_unref(source);
+                source = nullptr;
+            }
+        }
+
+        void complete(const T& value) {
+            m_result = value;
+            release(m_timer);
+            m_wake = attach(g_idle_source_new(), onWake);
+        }
+
+        // Both callbacks resume last: the awaiter is gone once the coroutine moves on
+        static gboolean onTimeout(gpointer data) {
+            auto* self = static_cast<Awaiter*>(data);
+            self->m_event.removeWaiter(self);
+            release(self->m_timer);
+            self->m_handle.resume();
+            return G_SOURCE_REMOVE;
+        }
+
+        static gboolean onWake(gpointer data) {
+            auto* self = static_cast<Awaiter*>(data);
+            release(self->m_wake);
+            self->m_handle.resume();
+            return G_SOURCE_REMOVE;
+        }
+
+        // Runs when the awaiting coroutine is destroyed while suspended
+        void detach() {
+            m_event.removeWaiter(this);
+            release(m_timer);
+            release(m_wake);
+        }
+
+        AsyncEvent& m_event;
+        GMainContext* m_context;
+        std::chrono::milliseconds m_timeout;
+        std::coroutine_handle<> m_handle;
+        std::optional<T> m_result;
+        GSource* m_timer = nullptr;
+        GSource* m_wake = nullptr;
+    };
+
+    AsyncEvent() = default;
+    AsyncEvent(const AsyncEvent&) = delete;
+    AsyncEvent& operator=(const AsyncEvent&) = delete;
+
+    void set(const T& value = T{}) {
+        m_value = value;
+        auto waiters = std::move(m_waiters);
+        m_waiters.clear();
+        for (Awaiter* waiter : waiters) {
+            waiter->complete(value);
+        }
+    }
+
+    void reset() { m_value.reset(); }
+
+    bool isSet() const { return m_value.has_value(); }
+    bool hasWaiters() const { return !m_waiters.empty(); }
+
+    /**
+     * Wait for the event
+     * @param context main context the waiter resumes on
+     * @param timeout give up after this long, kNoTimeout to wait forever
+     * @return awaitable yielding the value, or std::nullopt on timeout
+     */
+    Awaiter wait(GMainContext* context, std::chrono::milliseconds timeout = kNoTimeout) {
+        return Awaiter(*this, context, timeout);
+    }
+
+private:
+    void removeWaiter(Awaiter* waiter) {
+        m_waiters.erase(std::remove(m_waiters.begin(), m_waiters.end(), waiter), m_waiters.end());
+    }
+
+    std::optional<T> m_value;
+    std::vector<Awaiter*> m_waiters;
+};
+
+/**
+ * Awaitable pause of a coroutine on a GLib main context
+ *
+ *   co_await Util::Delay(context, std::chrono::milliseconds(500));
+ *
+ * Like AsyncEvent, destroying the suspended coroutine cancels the timer.
+ */
+class Delay {
+public:
+    Delay(GMainContext* context, std::chrono::milliseconds duration) : m_context(context), m_duration(duration) {}
+    ~Delay() { release(); }
+
+    Delay(const Delay&) = delete;
+    Delay& operator=(const Delay&) = delete;
+
+    bool await_ready() const { return m_duration.count() <= 0; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        m_handle = handle;
+        m_timer = g_timeout_source_new(static_cast<guint>(m_duration.count()));
+        g_source_set_priority(m_timer, G_PRIORITY_DEFAULT);
+        g_source_set_callback(m_timer, onTimeout, this, nullptr);
+        g_source_attach(m_timer, m_context);
+    }
+
+    void await_resume() const {}
+
+private:
+    void release() {
+        if (m_timer) {
+            g_source_destroy(m_timer);
+            g_source_unref(m_timer);
+            m_timer = nullptr;
+        }
+    }
+
+    // Resumes last: the awaiter is gone once the coroutine moves on
+    static gboolean onTimeout(gpointer data) {
+        auto* self = static_cast<Delay*>(data);
+        self->release();
+        self->m_handle.resume();
+        return G_SOURCE_REMOVE;
+    }
+
+    GMainContext* m_context;
+    std::chrono::milliseconds m_duration;
+    std::coroutine_handle<> m_handle;
+    GSource* m_timer = nullptr;
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_ASYNC_EVENT_H
@@ -0,0 +1,128 @@
+#include "AudioKernels.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define ZOOM_SDK_X86_KERNELS 1
+#endif
+
+namespace Util {
+
+static PcmLevel pcmLevelScalar(const int16_t* samples, size_t count) {
+    PcmLevel level;
+    for (size_t i = 0; i < count; i++) {
+        int32_t s = samples[i];
+        uint32_t magnitude = static_cast<uint32_t>(s < 0 ? -s : s);
+        if (magnitude > level.peak) level.peak = magnitude;
+        level.sumSquares += static_cast<uint64_t>(s * s);
+    }
+    return level;
+}
+
+#ifdef ZOOM_SDK_X86_KERNELS
+
+// Adds the tail that does not fill a vector
+static PcmLevel finishScalar(PcmLevel level, const int16_t* samples, size_t count) {
+    PcmLevel tail = pcmLevelScalar(samples, count);
+    if (tail.peak > level.peak) level.peak = tail.peak;
+    level.sumSquares += tail.sumSquares;
+    return level;
+}
+
+// |s| is taken as unsigned 16-bit, so |-32768| = 32768 fits. A madd of two
+// squares reaches 2^31, which only fits unsigned, so pairs widen to u64 as u32.
+__attribute__((target("sse4.2,ssse3"))) static PcmLevel pcmLevelSse4(const int16_t* samples, size_t count) {
+    __m128i peak = _mm_setzero_si128();
+    __m128i sum = _mm_setzero_si128();
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(samples + i));
+        peak = _mm_max_epu16(peak, _mm_abs_epi16(s));
+        __m128i squares = _mm_madd_epi16(s, s);
+        sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(squares, zero));
+        sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(squares, zero));
+    }
+
+    // Horizontal max via minpos of the complement
+    __m128i inverted = _mm_xor_si128(peak, _mm_set1_epi16(-1));
+    PcmLevel level;
+    level.peak = 0xffff - static_cast<uint32_t>(_mm_extract_epi16(_mm_minpos_epu16(inverted), 0));
+    level.sumSquares =
+        static_cast<uint64_t>(_mm_extract_epi64(sum, 0)) + static_cast<uint64_t>(_mm_extract_epi64(sum, 1));
+    return finishScalar(level, samples + i, count - i);
+}
+
+__attribute__((target("avx2,fma,bmi,bmi2"))) static PcmLevel pcmLevelAvx2(const int16_t* samples, size_t count) {
+    __m256i peak = _mm256_setzero_si256();
+    __m256i sum = _mm256_setzero_si256();
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(samples + i));
+        peak = _mm256_max_epu16(peak, _mm256_abs_epi16(s));
+        __m256i squares = _mm256_madd_epi16(s, s);
+        sum = _mm256_add_epi64(sum, _mm256_unpacklo_epi32(squares, zero));
+        sum = _mm256_add_epi64(sum, _mm256_unpackhi_epi32(squares, zero));
+    }
+
+    __m128i peak128 = _mm_max_epu16(_mm256_castsi256_si128(peak), _mm256_extracti128_si256(peak, 1));
+    __m128i inverted = _mm_xor_si128(peak128, _mm_set1_epi16(-1));
+    __m128i sum128 = _mm_add_epi64(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    PcmLevel level;
+    level.peak = 0xffff - static_cast<uint32_t>(_mm_extract_epi16(_mm_minpos_epu16(inverted), 0));
+    level.sumSquares =
+        static_cast<uint64_t>(_mm_extract_epi64(sum128, 0)) + static_cast<uint64_t>(_mm_extract_epi64(sum128, 1));
+    return finishScalar(level, samples + i, count - i);
+}
+
+// GCC 12's unmasked AVX-512 intrinsics (cvtepu32, extract, cast, reduce, even
+// shifts and shuffles) pass a deliberately uninitialized vector to their
+// builtins, which -Wuninitialized and -Wmaybe-uninitialized report wherever they
+// are inlined. Nothing in this kernel reads an uninitialized value.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+__attribute__((target("avx512f,avx512bw,avx512dq,avx512cd,avx512vl,avx2,bmi,bmi2"))) static PcmLevel pcmLevelAvx512(
+    const int16_t* samples, size_t count) {
+    __m512i peak = _mm512_setzero_si512();
+    __m512i sum = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m512i s = _mm512_loadu_si512(samples + i);
+        peak = _mm512_max_epu16(peak, _mm512_abs_epi16(s));
+        __m512i squares = _mm512_madd_epi16(s, s);
+        sum = _mm512_add_epi64(sum, _mm512_cvtepu32_epi64(_mm512_castsi512_si256(squares)));
+        sum = _mm512_add_epi64(sum, _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(squares, 1)));
+    }
+
+    // The last partial vector goes through a masked load instead of the scalar loop
+    if (i < count) {
+        __mmask32 mask = _bzhi_u32(0xffffffffu, static_cast<unsigned>(count - i));
+        __m512i s = _mm512_maskz_loadu_epi16(mask, samples + i);
+        peak = _mm512_max_epu16(peak, _mm512_abs_epi16(s));
+        __m512i squares = _mm512_madd_epi16(s, s);
+        sum = _mm512_add_epi64(sum, _mm512_cvtepu32_epi64(_mm512_castsi512_si256(squares)));
+        sum = _mm512_add_epi64(sum, _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(squares, 1)));
+    }
+
+    __m256i peak256 = _mm256_max_epu16(_mm512_castsi512_si256(peak), _mm512_extracti64x4_epi64(peak, 1));
+    __m128i peak128 = _mm_max_epu16(_mm256_castsi256_si128(peak256), _mm256_extracti128_si256(peak256, 1));
+    __m128i inverted = _mm_xor_si128(peak128, _mm_set1_epi16(-1));
+    PcmLevel level;
+    level.peak = 0xffff - static_cast<uint32_t>(_mm_extract_epi16(_mm_minpos_epu16(inverted), 0));
+    level.sumSquares = static_cast<uint64_t>(_mm512_reduce_add_epi64(sum));
+    return level;
+}
+
+#pragma GCC diagnostic pop
+
+CpuKernel<PcmLevel (*)(const int16_t*, size_t)> pcmLevel("pcm_level", pcmLevelScalar, pcmLevelSse4, pcmLevelAvx2,
+                                                         pcmLevelAvx512);
+
+#else
+
+CpuKernel<PcmLevel (*)(const int16_t*, size_t)> pcmLevel("pcm_level", pcmLevelScalar, nullptr, nullptr, nullptr);
+
+#endif
+
+} // namespace Util
@@ -0,0 +1,25 @@
+#ifndef HEADLESS_ZOOM_BOT_AUDIO_KERNELS_H
+#define HEADLESS_ZOOM_BOT_AUDIO_KERNELS_H
+
+#include "CpuDispatch.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Util {
+
+// Level of a block of 16-bit PCM
+struct PcmLevel {
+    uint32_t peak = 0;        // Largest absolute sample, 0..32768
+    uint64_t sumSquares = 0;  // Sum of squared samples; RMS is sqrt(sumSquares / count)
+};
+
+/**
+ * Peak and energy of 16-bit PCM samples, for level metering and silence detection
+ * Implemented for every tier; any count and alignment
+ */
+extern CpuKernel<PcmLevel (*)(const int16_t* samples, size_t count)> pcmLevel;
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_AUDIO_KERNELS_H
@@ -0,0 +1,196 @@
+#ifndef HEADLESS_ZOOM_BOT_AUDIO_PIPELINE_H
+#define HEADLESS_ZOOM_BOT_AUDIO_PIPELINE_H
+
+#include "AudioKernels.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Util {
+
+// Mono 16-bit PCM moving through an AudioPipeline
+struct AudioBlock {
+    int16_t* samples;
+    size_t count;
+};
+
+/**
+ * Stage interface
+ *
+ * A stage is a type with
+ *   static constexpr bool enabled;  // false compiles the stage away
+ *   static constexpr bool writes;   // true if it changes samples in place
+ *   bool process(AudioBlock& block); // false drops the frame
+ * State kept between frames (filter memory, VAD hangover) lives in the stage,
+ * so one pipeline instance serves one stream.
+ */
+
+// A stage a configuration leaves out
+struct NoStage {
+    static constexpr bool enabled = false;
+    static constexpr bool writes = false;
+    bool process(AudioBlock&) { return true; }
+};
+
+// One-pole DC blocking high-pass, y[n] = x[n] - x[n-1] + 0.995 y[n-1], about 25 Hz at 32 kHz
+class DcBlocker {
+public:
+    static constexpr bool enabled = true;
+    static constexpr bool writes = true;
+
+    bool process(AudioBlock& block) {
+        for (size_t i = 0; i < block.count; i++) {
+            float x = block.samples[i];
+            float y = x - m_prevIn + 0.995f * m_prevOut;
+            m_prevIn = x;
+            m_prevOut = y;
+            block.samples[i] = static_cast<int16_t>(y > 32767.f ? 32767.f : (y < -32768.f ? -32768.f : y));
+        }
+        return true;
+    }
+
+private:
+    float m_prevIn = 0;
+    float m_prevOut = 0;
+};
+
+/**
+ * Halves the sample rate (32 kHz SDK audio becomes 16 kHz)
+ * Each output sample is a [1 2 1]/4 low-pass over three input samples; an odd
+ * sample left at the end of a frame is carried into the next one.
+ */
+class Downsample2 {
+public:
+    static constexpr bool enabled = true;
+    static constexpr bool writes = true;
+
+    bool process(AudioBlock& block) {
+        size_t out = 0;
+        for (size_t i = 0; i < block.count; i++) {
+            int32_t x = block.samples[i];
+            if (!m_haveCenter) {
+                m_center = x;
+                m_haveCenter = true;
+                continue;
+            }
+            // out < i, so writing in place never overwrites unread input
+            block.samples[out++] = static_cast<int16_t>((m_prev + 2 * m_center + x + 2) >> 2);
+            m_prev = x;
+            m_haveCenter = false;
+        }
+        block.count = out;
+        return out > 0;
+    }
+
+private:
+    int32_t m_prev = 0;
+    int32_t m_center = 0;
+    bool m_haveCenter = false;
+};
+
+/**
+ * Energy voice activity gate
+ * Drops frames whose RMS stays below ThresholdRms (100 is about -50 dBFS),
+ * except for the HangoverFrames after the last voiced one so word endings
+ * are kept. Uses the dispatched pcmLevel kernel, and keeps the level of the
+ * last frame for metering.
+ */
+template<uint32_t ThresholdRms = 100, unsigned HangoverFrames = 20>
+class EnergyVad {
+public:
+    static constexpr bool enabled = true;
+    static constexpr bool writes = false;
+
+    bool process(AudioBlock& block) {
+        m_level = pcmLevel(block.samples, block.count);
+        // Compared squared to avoid a sqrt per frame
+        bool voiced = m_level.sumSquares > uint64_t{ThresholdRms} * ThresholdRms * block.count;
+        if (voiced) {
+            m_hangover = HangoverFrames;
+            return true;
+        }
+        if (m_hangover > 0) {
+            m_hangover--;
+            return true;
+        }
+        return false;
+    }
+
+    const PcmLevel& lastLevel() const { return m_level; }
+
+private:
+    PcmLevel m_level;
+    unsigned m_hangover = 0;
+};
+
+// Sink that hands the block to a callable supplied with each frame
+struct ForwardSink {
+    template<class Deliver>
+    void operator()(const AudioBlock& block, Deliver&& deliver) {
+        std::forward<Deliver>(deliver)(block);
+    }
+};
+
+/**
+ * Per-stream audio processing composed at compile time
+ *
+ * Stages run in the order Filter, Resample, Vad, then Sink. Disabled stages
+ * (NoStage) are removed by if constexpr, so a configuration costs only what
+ * it enables, with no runtime flags or virtual calls per frame. Input is
+ * only copied into the pipeline's scratch buffer when some stage writes;
+ * otherwise stages and the sink see the caller's buffer.
+ *
+ *   using Speech = AudioPipeline<DcBlocker, Downsample2, EnergyVad<>, ForwardSink>;
+ *   Speech pipeline;
+ *   pipeline.process(pcm, count, [&](const AudioBlock& out) { consume(out.samples, out.count); });
+ */
+template<class Filter, class Resample, class Vad, class Sink>
+class AudioPipeline {
+public:
+    static constexpr bool kWrites = Filter::writes || Resample::writes || Vad::writes;
+
+    /**
+     * Run one frame through the stages and hand the result to the sink
+     * @param sinkArgs Passed to the sink after the block
+     * @return false if a stage dropped the frame, in which case the sink is not called
+     */
+    template<class... SinkArgs>
+    bool process(const int16_t* samples, size_t count, SinkArgs&&... sinkArgs) {
+        AudioBlock block{const_cast<int16_t*>(samples), count};
+        if constexpr (kWrites) {
+            // Capacity is kept, so only the first frames of a stream allocate
+            m_scratch.assign(samples, samples + count);
+            block.samples = m_scratch.data();
+        }
+        if constexpr (Filter::enabled) {
+            if (!m_filter.process(block)) return false;
+        }
+        if constexpr (Resample::enabled) {
+            if (!m_resample.process(block)) return false;
+        }
+        if constexpr (Vad::enabled) {
+            if (!m_vad.process(block)) return false;
+        }
+        m_sink(static_cast<const AudioBlock&>(block), std::forward<SinkArgs>(sinkArgs)...);
+        return true;
+    }
+
+    Filter& filter() { return m_filter; }
+    Resample& resample() { return m_resample; }
+    Vad& vad() { return m_vad; }
+    Sink& sink() { return m_sink; }
+
+private:
+    [[no_unique_address]] Filter m_filter;
+    [[no_unique_address]] Resample m_resample;
+    [[no_unique_address]] Vad m_vad;
+    [[no_unique_address]] Sink m_sink;
+    [[no_unique_address]] std::conditional_t<kWrites, std::vector<int16_t>, NoStage> m_scratch;
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_AUDIO_PIPELINE_H
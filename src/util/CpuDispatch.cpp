@@ -0,0 +1,124 @@
+#include "CpuDispatch.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace Util {
+
+static const char* const kTierNames[kCpuTierCount] = {"scalar", "sse4", "avx2", "avx512"};
+
+const char* cpuTierName(CpuTier tier) {
+    int index = static_cast<int>(tier);
+    return index < kCpuTierCount ? kTierNames[index] : "unknown";
+}
+
+bool parseCpuTier(const char* name, CpuTier& tier) {
+    for (int i = 0; name && i < kCpuTierCount; i++) {
+        if (std::strcmp(name, kTierNames[i]) == 0) {
+            tier = static_cast<CpuTier>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+static uint64_t readXcr0() {
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+}
+
+static CpuTier probeCpuTier() {
+    unsigned eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return CpuTier::SCALAR;
+    const bool ssse3 = ecx & bit_SSSE3;
+    const bool sse42 = (ecx & bit_SSE4_1) && (ecx & bit_SSE4_2);
+    const bool fma = ecx & bit_FMA;
+    const bool osxsave = ecx & bit_OSXSAVE;
+    const bool avx = ecx & bit_AVX;
+    if (!ssse3 || !sse42) return CpuTier::SCALAR;
+
+    unsigned ebx7 = 0;
+    if (__get_cpuid_count(7, 0, &eax, &ebx7, &ecx, &edx) == 0) return CpuTier::SSE4;
+
+    // The OS must save the YMM (and for AVX-512 the opmask and ZMM) state on context switches
+    const uint64_t xcr0 = osxsave ? readXcr0() : 0;
+    const bool ymm = (xcr0 & 0x6) == 0x6;
+    const bool zmm = (xcr0 & 0xe6) == 0xe6;
+
+    const bool avx2 = avx && fma && ymm && (ebx7 & bit_AVX2) && (ebx7 & bit_BMI) && (ebx7 & bit_BMI2);
+    if (!avx2) return CpuTier::SSE4;
+
+    const unsigned avx512 = bit_AVX512F | bit_AVX512DQ | bit_AVX512CD | bit_AVX512BW | bit_AVX512VL;
+    if (zmm && (ebx7 & avx512) == avx512) return CpuTier::AVX512;
+    return CpuTier::AVX2;
+}
+#else
+static CpuTier probeCpuTier() {
+    return CpuTier::SCALAR;
+}
+#endif
+
+CpuTier detectedCpuTier() {
+    static const CpuTier tier = probeCpuTier();
+    return tier;
+}
+
+// Registry of all kernels, so forceCpuTier() can rebind them
+struct KernelRegistry {
+    std::mutex mutex;
+    std::vector<CpuKernelBase*> kernels;
+    CpuTier active;
+
+    KernelRegistry() : active(detectedCpuTier()) {
+        CpuTier cap;
+        if (parseCpuTier(std::getenv("ZOOM_SDK_CPU_TIER"), cap)) {
+            active = std::min(active, cap);
+        }
+    }
+};
+
+// Function-local so kernels in other translation units can register during static initialization
+static KernelRegistry& registry() {
+    static KernelRegistry instance;
+    return instance;
+}
+
+CpuTier activeCpuTier() {
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    return r.active;
+}
+
+CpuTier forceCpuTier(CpuTier tier) {
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.active = std::min(tier, detectedCpuTier());
+    for (auto* kernel : r.kernels) {
+        kernel->bind(r.active);
+    }
+    return r.active;
+}
+
+void CpuKernelBase::registerKernel() {
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.kernels.push_back(this);
+    bind(r.active);
+}
+
+CpuKernelBase::~CpuKernelBase() {
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.kernels.erase(std::remove(r.kernels.begin(), r.kernels.end(), this), r.kernels.end());
+}
+
+} // namespace Util
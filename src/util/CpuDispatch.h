@@ -0,0 +1,118 @@
+#ifndef HEADLESS_ZOOM_BOT_CPU_DISPATCH_H
+#define HEADLESS_ZOOM_BOT_CPU_DISPATCH_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace Util {
+
+/**
+ * Instruction set tiers SIMD kernels are written for, in increasing order
+ * SSE4 is SSE4.2 with SSSE3, AVX2 adds FMA and BMI1/2 (x86-64-v3), AVX512 is
+ * F, BW, CD, DQ and VL (x86-64-v4). AVX tiers also need the OS to save the
+ * wider registers, which detection checks through XCR0.
+ */
+enum class CpuTier : uint8_t {
+    SCALAR = 0,
+    SSE4 = 1,
+    AVX2 = 2,
+    AVX512 = 3,
+};
+
+constexpr int kCpuTierCount = 4;
+
+const char* cpuTierName(CpuTier tier);
+
+// Parse "scalar", "sse4", "avx2" or "avx512"; false if the name is unknown
+bool parseCpuTier(const char* name, CpuTier& tier);
+
+// Best tier this CPU and OS support; cpuid is probed once
+CpuTier detectedCpuTier();
+
+/**
+ * Tier the kernels are bound to: the detected one, capped by ZOOM_SDK_CPU_TIER
+ * at startup or by forceCpuTier()
+ */
+CpuTier activeCpuTier();
+
+/**
+ * Rebind every kernel to its best implementation at or below a tier
+ * Used to run all code paths on one machine. Tiers above detectedCpuTier()
+ * are capped, since their instructions would fault. Calls already in flight
+ * finish on the previous implementation.
+ * @return the tier actually applied
+ */
+CpuTier forceCpuTier(CpuTier tier);
+
+// Registry entry of a CpuKernel
+class CpuKernelBase {
+public:
+    const char* name() const { return m_name; }
+
+    // Tier of the implementation currently bound
+    CpuTier boundTier() const { return static_cast<CpuTier>(m_bound.load(std::memory_order_relaxed)); }
+
+    // Bind the best implementation at or below cap, and never above detectedCpuTier()
+    virtual void bind(CpuTier cap) = 0;
+
+protected:
+    explicit CpuKernelBase(const char* name) : m_name(name) {}
+    virtual ~CpuKernelBase();
+
+    // Add to the registry and bind to activeCpuTier()
+    void registerKernel();
+
+    std::atomic<uint8_t> m_bound{0};
+
+private:
+    const char* m_name;
+};
+
+/**
+ * A function with one implementation per tier, dispatched through a pointer
+ *
+ * Declare it at namespace scope next to its implementations; the pointer is
+ * bound during static initialization, so a call is one relaxed load and an
+ * indirect call. Tiers without an implementation pass nullptr and fall back
+ * to the next lower one; the scalar version is required. Implementations
+ * for higher tiers are compiled with __attribute__((target(...))) in the same
+ * file, so no per-file compiler flags are needed.
+ *
+ *   static int sumScalar(const int16_t* p, size_t n);
+ *   __attribute__((target("avx2"))) static int sumAvx2(const int16_t* p, size_t n);
+ *   CpuKernel<int (*)(const int16_t*, size_t)> sum("sum", sumScalar, nullptr, sumAvx2, nullptr);
+ *   int total = sum(samples, count);
+ */
+template<class Fn>
+class CpuKernel : public CpuKernelBase {
+public:
+    CpuKernel(const char* name, Fn scalar, Fn sse4, Fn avx2, Fn avx512)
+        : CpuKernelBase(name), m_impls{scalar, sse4, avx2, avx512}, m_fn(scalar) {
+        registerKernel();
+    }
+
+    template<class... Args>
+    auto operator()(Args&&... args) const {
+        return m_fn.load(std::memory_order_relaxed)(std::forward<Args>(args)...);
+    }
+
+    // Implementation for exactly this tier, nullptr if there is none
+    Fn implementation(CpuTier tier) const { return m_impls[static_cast<int>(tier)]; }
+
+    void bind(CpuTier cap) override {
+        int tier = static_cast<int>(std::min(cap, detectedCpuTier()));
+        while (tier > 0 && !m_impls[tier]) tier--;
+        m_fn.store(m_impls[tier], std::memory_order_relaxed);
+        m_bound.store(static_cast<uint8_t>(tier), std::memory_order_relaxed);
+    }
+
+private:
+    Fn m_impls[kCpuTierCount];
+    std::atomic<Fn> m_fn;
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_CPU_DISPATCH_H
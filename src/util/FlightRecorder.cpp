@@ -0,0 +1,249 @@
+#include "FlightRecorder.h"
+#include "MemoryAccounting.h"
+#include "Metrics.h"
+#include "PathTemplate.h"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace Util {
+
+static constexpr int kDumpSignals[] = {SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT, SIGUSR1};
+
+// Handlers that were installed before ours, chained to after the dump
+static struct sigaction g_previous[NSIG];
+
+static int current_tid() {
+    thread_local int tid = static_cast<int>(syscall(SYS_gettid));
+    return tid;
+}
+
+// Line formatting for the signal handler: no allocation, no stdio
+class LineWriter {
+public:
+    explicit LineWriter(int fd) : m_fd(fd) {}
+    ~LineWriter() { flush(); }
+
+    LineWriter& text(const char* s) {
+        while (*s) put(*s++);
+        return *this;
+    }
+
+    LineWriter& number(uint64_t value) {
+        char digits[20];
+        int n = 0;
+        do {
+            digits[n++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value);
+        while (n) put(digits[--n]);
+        return *this;
+    }
+
+    LineWriter& signedNumber(int64_t value) {
+        if (value < 0) {
+            put('-');
+            return number(0 - static_cast<uint64_t>(value));
+        }
+        return number(static_cast<uint64_t>(value));
+    }
+
+    LineWriter& hex(uint64_t value) {
+        text("0x");
+        char digits[16];
+        int n = 0;
+        do {
+            digits[n++] = "0123456789abcdef"[value & 0xf];
+            value >>= 4;
+        } while (value);
+        while (n) put(digits[--n]);
+        return *this;
+    }
+
+    void flush() {
+        size_t done = 0;
+        while (done < m_used) {
+            ssize_t n = ::write(m_fd, m_buffer + done, m_used - done);
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) break;
+            done += static_cast<size_t>(n);
+        }
+        m_used = 0;
+    }
+
+private:
+    void put(char c) {
+        if (m_used == sizeof(m_buffer)) flush();
+        m_buffer[m_used++] = c;
+    }
+
+    int m_fd;
+    size_t m_used = 0;
+    char m_buffer[1024];
+};
+
+static uint64_t clock_ns(clockid_t clock) {
+    timespec ts;
+    clock_gettime(clock, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+FlightRecorder::FlightRecorder() {
+    // The ring is static storage, reported once so the accounting covers all library buffers
+    MemoryAccounting::getInstance().subsystem("flight_recorder")->allocate(sizeof(m_slots));
+}
+
+void FlightRecorder::record(const char* event, const void* meeting, int64_t a, int64_t b) {
+    uint64_t index = m_next.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = m_slots[index % kCapacity];
+
+    // Seqlock style: a reader skips a slot whose sequence changed while it was read
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.timeNs.store(monotonicNs(), std::memory_order_relaxed);
+    slot.event.store(event, std::memory_order_relaxed);
+    slot.meeting.store(meeting, std::memory_order_relaxed);
+    slot.a.store(a, std::memory_order_relaxed);
+    slot.b.store(b, std::memory_order_relaxed);
+    slot.tid.store(current_tid(), std::memory_order_relaxed);
+    slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+void FlightRecorder::dumpTo(int fd, int signal) const {
+    LineWriter out(fd);
+    uint64_t next = m_next.load(std::memory_order_acquire);
+    uint64_t first = next > kCapacity ? next - kCapacity : 0;
+
+    out.text("# zoomsdk flight recorder pid=").number(static_cast<uint64_t>(getpid()));
+    out.text(" signal=").number(static_cast<uint64_t>(signal));
+    out.text(" events=").number(next - first).text(" total=").number(next);
+    out.text(" now_mono_ns=").number(clock_ns(CLOCK_MONOTONIC));
+    out.text(" now_unix_ns=").number(clock_ns(CLOCK_REALTIME)).text("\n");
+    out.text("# mono_ns tid event meeting a b\n");
+
+    for (uint64_t index = first; index < next; index++) {
+        const Slot& slot = m_slots[index % kCapacity];
+        if (slot.sequence.load(std::memory_order_acquire) != index + 1) continue;
+
+        uint64_t timeNs = slot.timeNs.load(std::memory_order_relaxed);
+        const char* event = slot.event.load(std::memory_order_relaxed);
+        const void* meeting = slot.meeting.load(std::memory_order_relaxed);
+        int64_t a = slot.a.load(std::memory_order_relaxed);
+        int64_t b = slot.b.load(std::memory_order_relaxed);
+        int tid = slot.tid.load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != index + 1) continue;  // overwritten meanwhile
+
+        out.number(timeNs).text(" ").number(static_cast<uint64_t>(tid)).text(" ");
+        out.text(event ? event : "?").text(" ").hex(reinterpret_cast<uintptr_t>(meeting));
+        out.text(" ").signedNumber(a).text(" ").signedNumber(b).text("\n");
+    }
+}
+
+bool FlightRecorder::dump(const char* path, int signal) const {
+    int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    dumpTo(fd, signal);
+    ::close(fd);
+    return true;
+}
+
+void FlightRecorder::dumpChained(int signal) {
+    size_t length = std::strlen(m_path);
+    for (unsigned n = m_chainedDumps.fetch_add(1); n < kMaxChainedDumps; n = m_chainedDumps.fetch_add(1)) {
+        char path[sizeof(m_path) + 16];
+        std::memcpy(path, m_path, length);
+        char digits[12];
+        size_t count = 0;
+        for (unsigned value = n; count == 0 || value; value /= 10) {
+            digits[count++] = static_cast<char>('0' + value % 10);
+        }
+        size_t end = length;
+        path[end++] = '.';
+        while (count) path[end++] = digits[--count];
+        path[end] = '\0';
+
+        // O_EXCL: never overwrite an earlier dump, of this process or a previous one
+        int fd = ::open(path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+        if (fd >= 0) {
+            dumpTo(fd, signal);
+            ::close(fd);
+            return;
+        }
+        if (errno != EEXIST) return;
+    }
+}
+
+void FlightRecorder::onSignal(int signal, siginfo_t* info, void* context) {
+    int savedErrno = errno;
+    FlightRecorder& recorder = getInstance();
+    const struct sigaction& previous = g_previous[signal];
+    bool chained = (previous.sa_flags & SA_SIGINFO)
+                       ? previous.sa_sigaction != nullptr
+                       : previous.sa_handler != SIG_DFL && previous.sa_handler != SIG_IGN;
+
+    // A crash while dumping goes straight to the previous handler
+    if (!recorder.m_dumping.exchange(true)) {
+        if (chained && signal != SIGUSR1) {
+            recorder.dumpChained(signal);
+        } else {
+            recorder.dump(recorder.m_path, signal);
+        }
+        recorder.m_dumping.store(false);
+    }
+    errno = savedErrno;
+
+    if (previous.sa_flags & SA_SIGINFO) {
+        if (previous.sa_sigaction) previous.sa_sigaction(signal, info, context);
+        return;
+    }
+    if (previous.sa_handler != SIG_DFL && previous.sa_handler != SIG_IGN) {
+        previous.sa_handler(signal);
+        return;
+    }
+    if (signal == SIGUSR1) {
+        // Dumping on demand must not terminate the process (SIGUSR1's default action)
+        return;
+    }
+
+    // Fatal signal with the default action: restore it, the signal is raised
+    // again when the handler returns (or the faulting instruction reruns)
+    sigaction(signal, &previous, nullptr);
+    raise(signal);
+}
+
+bool FlightRecorder::install(const std::string& path) {
+    std::string resolved = expandPathTemplate(path);
+    if (resolved.empty() || resolved.size() >= sizeof(m_path) || m_installed.exchange(true)) {
+        return false;
+    }
+    std::memcpy(m_path, resolved.c_str(), resolved.size() + 1);
+
+    struct sigaction action = {};
+    action.sa_sigaction = onSignal;
+    sigemptyset(&action.sa_mask);
+    // SA_ONSTACK: a Go runtime in the process requires it for foreign handlers
+    action.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_RESTART;
+    for (int signal : kDumpSignals) {
+        sigaction(signal, &action, &g_previous[signal]);
+    }
+
+    record("flight_recorder_installed", nullptr, getpid());
+    return true;
+}
+
+void FlightRecorder::installFromEnv() {
+    if (const char* path = std::getenv("ZOOM_SDK_FLIGHT_RECORDER")) {
+        if (*path && !m_installed.load()) install(path);
+    }
+}
+
+} // namespace Util
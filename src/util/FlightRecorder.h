@@ -0,0 +1,116 @@
+#ifndef HEADLESS_ZOOM_BOT_FLIGHT_RECORDER_H
+#define HEADLESS_ZOOM_BOT_FLIGHT_RECORDER_H
+
+#include <atomic>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Util {
+
+/**
+ * Always-on ring of the most recent native events, for post-mortem debugging
+ *
+ * record() is lock-free and allocation-free, so it can be left in the SDK
+ * callbacks permanently; the last kCapacity events are kept. Once install() ran,
+ * SIGSEGV, SIGBUS, SIGILL, SIGFPE and SIGABRT dump the ring to a file before the
+ * previously installed handler (the SDK's dump generator, the Go runtime, or the
+ * default action) takes over, and SIGUSR1 dumps it without stopping the process.
+ * A previous handler may survive the signal (the Go runtime turns a fault in Go
+ * code into a recoverable panic), so those dumps go to "<path>.<n>" files of
+ * their own, at most kMaxChainedDumps, and never truncate the dump of a crash.
+ *
+ * The dump only uses async-signal-safe calls. Event names must be string literals
+ * or strings that live until exit, since only the pointer is stored.
+ */
+class FlightRecorder {
+public:
+    static constexpr size_t kCapacity = 4096;
+    static constexpr unsigned kMaxChainedDumps = 16;
+
+    static FlightRecorder& getInstance() {
+        static FlightRecorder instance;
+        return instance;
+    }
+
+    FlightRecorder(const FlightRecorder&) = delete;
+    FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+    /**
+     * Append an event
+     * @param event static name, e.g. "meeting_status"
+     * @param meeting MeetingHandle the event belongs to, or nullptr
+     * @param a, b event specific values
+     */
+    void record(const char* event, const void* meeting = nullptr, int64_t a = 0, int64_t b = 0);
+
+    /**
+     * Install the dump signal handlers
+     * @param path dump file, "%p" is replaced by the process id
+     * @return false if the path is too long or the handlers are already installed
+     */
+    bool install(const std::string& path);
+
+    // Install with the path from ZOOM_SDK_FLIGHT_RECORDER, if set
+    void installFromEnv();
+
+    /**
+     * Write the ring to a file, oldest event first; async-signal-safe
+     * @param signal signal that triggered the dump, 0 for none
+     */
+    bool dump(const char* path, int signal = 0) const;
+
+    // Write the ring to an open descriptor; async-signal-safe
+    void dumpTo(int fd, int signal) const;
+
+    uint64_t recorded() const { return m_next.load(std::memory_order_relaxed); }
+
+private:
+    FlightRecorder();
+
+    struct Slot {
+        std::atomic<uint64_t> sequence{0};  // index + 1 once written, 0 while being written
+        std::atomic<uint64_t> timeNs{0};
+        std::atomic<const char*> event{nullptr};
+        std::atomic<const void*> meeting{nullptr};
+        std::atomic<int64_t> a{0};
+        std::atomic<int64_t> b{0};
+        std::atomic<int> tid{0};
+    };
+
+    static void onSignal(int signal, siginfo_t* info, void* context);
+
+    // Dump to the first free "<path>.<n>"; async-signal-safe
+    void dumpChained(int signal);
+
+    Slot m_slots[kCapacity];
+    std::atomic<uint64_t> m_next{0};
+
+    // Set before the handlers are installed, read from them
+    char m_path[512] = {};
+    std::atomic<bool> m_installed{false};
+    std::atomic<bool> m_dumping{false};
+    std::atomic<unsigned> m_chainedDumps{0};
+};
+
+// Lets a frequent event (drops, overruns) into the recorder at most once per interval,
+// so a flood cannot evict the history that led up to it
+class RecordThrottle {
+public:
+    explicit RecordThrottle(uint64_t intervalNs = 100'000'000) : m_intervalNs(intervalNs) {}
+
+    bool allow(uint64_t nowNs) {
+        uint64_t last = m_last.load(std::memory_order_relaxed);
+        return (last == 0 || nowNs - last >= m_intervalNs) &&
+               m_last.compare_exchange_strong(last, nowNs, std::memory_order_relaxed);
+    }
+
+private:
+    uint64_t m_intervalNs;
+    std::atomic<uint64_t> m_last{0};
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_FLIGHT_RECORDER_H
@@ -0,0 +1,99 @@
+#ifndef HEADLESS_ZOOM_BOT_LOG_FORMAT_H
+#define HEADLESS_ZOOM_BOT_LOG_FORMAT_H
+
+#include <charconv>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace Util {
+
+namespace detail {
+
+template<typename T>
+void appendArg(std::string& out, const T& value) {
+    using D = std::decay_t<T>;
+
+    if constexpr (std::is_same_v<D, bool>) {
+        out += value ? "true" : "false";
+    } else if constexpr (std::is_same_v<D, char>) {
+        out += value;
+    } else if constexpr (std::is_same_v<D, const char*> || std::is_same_v<D, char*>) {
+        out += value ? value : "(null)";
+    } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+        out += std::string_view(value);
+    } else if constexpr (std::is_enum_v<D>) {
+        appendArg(out, static_cast<std::underlying_type_t<D>>(value));
+    } else if constexpr (std::is_integral_v<D>) {
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, result.ptr);
+    } else if constexpr (std::is_floating_point_v<D>) {
+        char buffer[32];
+        int n = std::snprintf(buffer, sizeof(buffer), "%g", static_cast<double>(value));
+        out.append(buffer, n > 0 ? static_cast<size_t>(n) : 0);
+    } else {
+        std::ostringstream ss;
+        ss << value;
+        out += ss.str();
+    }
+}
+
+// Copies literal text up to the next "{}", unescaping "{{" and "}}";
+// returns the position after the placeholder, or npos if there is none
+inline size_t appendLiteral(std::string& out, std::string_view fmt, size_t pos) {
+    while (pos < fmt.size()) {
+        char c = fmt[pos];
+        if (c == '{' && pos + 1 < fmt.size()) {
+            if (fmt[pos + 1] == '}') return pos + 2;
+            if (fmt[pos + 1] == '{') pos++;
+        } else if (c == '}' && pos + 1 < fmt.size() && fmt[pos + 1] == '}') {
+            pos++;
+        }
+        out += fmt[pos++];
+    }
+    return std::string_view::npos;
+}
+
+inline void formatInto(std::string& out, std::string_view fmt, size_t pos) {
+    while (pos != std::string_view::npos && pos < fmt.size()) {
+        // Placeholders without a matching argument are kept as written
+        size_t next = appendLiteral(out, fmt, pos);
+        if (next != std::string_view::npos) out += "{}";
+        pos = next;
+    }
+}
+
+template<typename First, typename... Rest>
+void formatInto(std::string& out, std::string_view fmt, size_t pos, const First& first, const Rest&... rest) {
+    size_t next = pos < fmt.size() ? appendLiteral(out, fmt, pos) : std::string_view::npos;
+    if (next == std::string_view::npos) {
+        return;  // More arguments than placeholders: extras are ignored
+    }
+    appendArg(out, first);
+    formatInto(out, fmt, next, rest...);
+}
+
+} // namespace detail
+
+/**
+ * Minimal fmt-style formatting: each "{}" is replaced by the next argument
+ * Strings, characters, bools, integers, floats and enums are supported
+ * directly, anything else through operator<<. "{{" and "}}" produce braces.
+ * @param fmt format string
+ * @param args values for the placeholders
+ * @return formatted string
+ */
+template<typename... Args>
+std::string format(std::string_view fmt, const Args&... args) {
+    std::string out;
+    out.reserve(fmt.size() + 16 * sizeof...(Args));
+    detail::formatInto(out, fmt, 0, args...);
+    return out;
+}
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_LOG_FORMAT_H
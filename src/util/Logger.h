@@ -9,6 +9,14 @@
 #include <memory>
 #include <chrono>
 #include <iomanip>
+#include <atomic>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+#include "LogFormat.h"
+#include "MpscRing.h"
+#include "ThreadOptions.h"
 
 namespace Util {
 
@@ -34,8 +42,7 @@ public:
 
     // Configuration methods
     void setLogLevel(LogLevel level) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_currentLevel = level;
+        m_currentLevel.store(level, std::memory_order_relaxed);
     }
 
     void setLogFile(const std::string& filename) {
@@ -62,26 +69,81 @@ public:
         m_fileOutput = enable;
     }
 
+    /**
+     * Switch to asynchronous output
+     * Callers format their record and push it into a lock-free ring; a
+     * background thread writes records in batches and flushes once per batch.
+     * When the ring is full the record is dropped and counted instead of
+     * blocking the caller. The ring is allocated on first use and kept, so
+     * later calls reuse its capacity.
+     * @param capacity ring size in records, rounded up to a power of two
+     * @param writerThread name and scheduling of the writer thread
+     */
+    void enableAsync(size_t capacity = 8192, const ThreadOptions& writerThread = ThreadOptions()) {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+        if (m_writer.joinable()) {
+            return;
+        }
+        if (!m_ring) {
+            m_ring = std::make_unique<MpscRing<Record>>(capacity, m_ringMemory);
+        }
+
+        ThreadOptions options = writerThread;
+        if (options.name.empty()) {
+            options.name = "zoom-log";
+        }
+        m_writerRunning.store(true);
+        m_writer = std::thread([this, options]() {
+            applyThreadOptions(options);
+            runWriter();
+        });
+        m_async.store(true, std::memory_order_release);
+    }
+
+    // Back to synchronous output; records already queued are written first
+    void disableAsync() {
+        std::lock_guard<std::mutex> lock(m_asyncMutex);
+        if (!m_writer.joinable()) {
+            return;
+        }
+        m_async.store(false, std::memory_order_release);
+        m_writerRunning.store(false);
+        wakeWriter();
+        m_writer.join();
+
+        // Producers that saw async mode just before the switch may still be
+        // pushing; once they are out, the last drain catches their records
+        for (uint32_t n = m_producers.load(); n != 0; n = m_producers.load()) {
+            m_producers.wait(n);
+        }
+        while (drainRing() > 0) {}
+    }
+
+    bool isAsync() const { return m_async.load(std::memory_order_acquire); }
+
+    // Records dropped because the async ring was full
+    uint64_t droppedMessages() const { return m_dropped.load(std::memory_order_relaxed); }
+
+    bool isEnabled(LogLevel level) const {
+        return level >= m_currentLevel.load(std::memory_order_relaxed);
+    }
+
     // Logging methods
     void log(LogLevel level, const std::string& message) {
-        if (level < m_currentLevel) {
+        if (!isEnabled(level)) {
             return;
         }
 
-        std::lock_guard<std::mutex> lock(m_mutex);
-        std::string formattedMessage = formatMessage(level, message);
+        auto now = std::chrono::system_clock::now();
 
-        if (m_consoleOutput) {
-            if (level == LogLevel::ERROR) {
-                std::cerr << formattedMessage << std::endl;
-            } else {
-                std::cout << formattedMessage << std::endl;
-            }
+        if (m_async.load(std::memory_order_acquire) && pushAsync(level, now, message)) {
+            return;
         }
 
-        if (m_fileOutput && m_fileStream && m_fileStream->is_open()) {
-            *m_fileStream << formattedMessage << std::endl;
-        }
+        std::string formattedMessage = formatMessage(level, message, now);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        write(level, formattedMessage);
+        flush();
     }
 
     void debug(const std::string& message) {
@@ -120,20 +182,140 @@ public:
     }
 
 private:
-    Logger() : m_currentLevel(LogLevel::INFO), m_consoleOutput(true), m_fileOutput(false), m_logFile("") {}
+    struct Record {
+        LogLevel level;
+        std::chrono::system_clock::time_point time;
+        std::string message;
+    };
 
-    std::string getTimestamp() {
-        auto now = std::chrono::system_clock::now();
+    static constexpr size_t kWriteBatch = 256;
+
+    // The ring's account is taken here so the accounting outlives the logger at exit
+    Logger()
+        : m_currentLevel(LogLevel::INFO), m_consoleOutput(true), m_fileOutput(false), m_logFile("")
+        , m_ringMemory(MemoryAccounting::getInstance().subsystem("log_ring")) {}
+
+    ~Logger() {
+        disableAsync();
+    }
+
+    // Caller holds m_mutex
+    void write(LogLevel level, const std::string& formattedMessage) {
+        if (m_consoleOutput) {
+            if (level == LogLevel::ERROR) {
+                std::cerr << formattedMessage << '\n';
+            } else {
+                std::cout << formattedMessage << '\n';
+            }
+        }
+
+        if (m_fileOutput && m_fileStream && m_fileStream->is_open()) {
+            *m_fileStream << formattedMessage << '\n';
+        }
+    }
+
+    // Caller holds m_mutex
+    void flush() {
+        if (m_consoleOutput) {
+            std::cout.flush();
+            std::cerr.flush();
+        }
+        if (m_fileOutput && m_fileStream && m_fileStream->is_open()) {
+            m_fileStream->flush();
+        }
+    }
+
+    /**
+     * Queue a record for the writer thread, which does the formatting
+     * @return false if async mode was switched off meanwhile, so the caller writes synchronously
+     */
+    bool pushAsync(LogLevel level, std::chrono::system_clock::time_point time, const std::string& message) {
+        // Announced before async mode is checked again, so disableAsync() either
+        // waits for this push or this call sees async mode off
+        m_producers.fetch_add(1);
+        bool async = m_async.load();
+        if (async) {
+            if (m_ring->tryPush(Record{level, time, message})) {
+                wakeWriter();
+            } else {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        if (m_producers.fetch_sub(1) == 1 && !m_async.load()) {
+            m_producers.notify_all();
+        }
+        return async;
+    }
+
+    void wakeWriter() {
+        // Pairs with the fence in runWriter: either the writer sees the new
+        // record on its re-check, or we see it asleep and wake it
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (m_writerSleeping.load(std::memory_order_relaxed) && m_writerSleeping.exchange(0)) {
+            m_writerSleeping.notify_one();
+        }
+    }
+
+    // Writes up to one batch; returns the number of records written
+    size_t drainRing() {
+        std::vector<Record> batch;
+        Record record;
+        while (batch.size() < kWriteBatch && m_ring->tryPop(record)) {
+            batch.push_back(std::move(record));
+        }
+
+        uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+        if (batch.empty() && dropped == m_reportedDropped) {
+            return 0;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (const auto& r : batch) {
+            write(r.level, formatMessage(r.level, r.message, r.time));
+        }
+        if (dropped != m_reportedDropped) {
+            write(LogLevel::WARN, formatMessage(LogLevel::WARN, "Log queue full, dropped " +
+                                                std::to_string(dropped - m_reportedDropped) + " messages",
+                                                std::chrono::system_clock::now()));
+            m_reportedDropped = dropped;
+        }
+        flush();
+        return batch.size();
+    }
+
+    void runWriter() {
+        for (;;) {
+            if (drainRing() > 0) {
+                continue;
+            }
+            if (!m_writerRunning.load()) {
+                return;
+            }
+
+            m_writerSleeping.store(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!m_ring->empty() || !m_writerRunning.load()) {
+                m_writerSleeping.store(0);
+                continue;
+            }
+            m_writerSleeping.wait(1);
+        }
+    }
+
+    std::string getTimestamp(std::chrono::system_clock::time_point now) {
         auto time = std::chrono::system_clock::to_time_t(now);
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
 
+        std::tm local{};
+        localtime_r(&time, &local);
+
         std::stringstream ss;
-        ss << std::put_time(std::localtime(&time), "%Y-%m-%d %H:%M:%S")
+        ss << std::put_time(&local, "%Y-%m-%d %H:%M:%S")
            << "." << std::setfill('0') << std::setw(3) << ms.count();
         return ss.str();
     }
 
-    std::string formatMessage(LogLevel level, const std::string& message) {
+    std::string formatMessage(LogLevel level, const std::string& message, std::chrono::system_clock::time_point now) {
         std::string icon;
         switch (level) {
             case LogLevel::DEBUG:
@@ -157,18 +339,59 @@ private:
         }
 
         std::stringstream ss;
-        ss << "[" << getTimestamp() << "] " << icon << " " << message;
+        ss << "[" << getTimestamp(now) << "] " << icon << " " << message;
         return ss.str();
     }
 
-    LogLevel m_currentLevel;
+    std::atomic<LogLevel> m_currentLevel;
     bool m_consoleOutput;
     bool m_fileOutput;
     std::string m_logFile;
     std::unique_ptr<std::ofstream> m_fileStream;
     std::mutex m_mutex;
+
+    // Async mode
+    std::mutex m_asyncMutex;
+    std::shared_ptr<MemoryAccount> m_ringMemory;
+    std::unique_ptr<MpscRing<Record>> m_ring;
+    std::thread m_writer;
+    std::atomic<bool> m_async{false};
+    std::atomic<bool> m_writerRunning{false};
+    std::atomic<uint32_t> m_writerSleeping{0};
+    std::atomic<uint32_t> m_producers{0};  // Calls inside pushAsync()
+    std::atomic<uint64_t> m_dropped{0};
+    uint64_t m_reportedDropped = 0;  // writer only
 };
 
-} // namespace Logger
+} // namespace Util
+
+/*
+ * Lazy logging macros
+ *
+ *   ZLOG_INFO("Subscribed to share source {}", sourceId);
+ *
+ * Arguments are neither evaluated nor formatted unless the level is enabled
+ * at runtime. Levels below ZLOG_MIN_LEVEL (a Util::LogLevel value, set by the
+ * build) are compiled out entirely.
+ */
+#ifndef ZLOG_MIN_LEVEL
+#define ZLOG_MIN_LEVEL 0
+#endif
+
+#define ZLOG_AT(level, ...)                                                          \
+    do {                                                                             \
+        if constexpr (static_cast<int>(level) >= ZLOG_MIN_LEVEL) {                   \
+            auto& zlogLogger_ = Util::Logger::getInstance();                         \
+            if (zlogLogger_.isEnabled(level)) {                                      \
+                zlogLogger_.log(level, Util::format(__VA_ARGS__));                   \
+            }                                                                        \
+        }                                                                            \
+    } while (0)
+
+#define ZLOG_DEBUG(...) ZLOG_AT(Util::LogLevel::DEBUG, __VA_ARGS__)
+#define ZLOG_INFO(...) ZLOG_AT(Util::LogLevel::INFO, __VA_ARGS__)
+#define ZLOG_WARN(...) ZLOG_AT(Util::LogLevel::WARN, __VA_ARGS__)
+#define ZLOG_ERROR(...) ZLOG_AT(Util::LogLevel::ERROR, __VA_ARGS__)
+#define ZLOG_SUCCESS(...) ZLOG_AT(Util::LogLevel::SUCCESS, __VA_ARGS__)
 
 #endif // HEADLESS_ZOOM_BOT_LOGGER_H
@@ -0,0 +1,241 @@
+#include "MediaCapture.h"
+#include "Logger.h"
+#include "PathTemplate.h"
+#include "ThreadOptions.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace Util {
+
+static constexpr char kMagic[8] = {'Z', 'M', 'C', 'A', 'P', '\0', '\0', '\1'};
+static constexpr size_t kHeaderBytes = 20;
+static constexpr size_t kVideoHeaderBytes = 16;
+
+template<class T>
+static char* put(char* out, T value) {
+    // Little-endian hosts only, like the SDK
+    std::memcpy(out, &value, sizeof(value));
+    return out + sizeof(value);
+}
+
+template<class T>
+static const char* get(const char* in, T& value) {
+    std::memcpy(&value, in, sizeof(value));
+    return in + sizeof(value);
+}
+
+MediaCaptureWriter::MediaCaptureWriter(const void* meeting)
+    : m_memory(meeting ? MemoryAccounting::getInstance().meeting("capture", meeting)
+                       : MemoryAccounting::getInstance().subsystem("capture")) {}
+
+MediaCaptureWriter::~MediaCaptureWriter() {
+    stop();
+}
+
+bool MediaCaptureWriter::start(const std::string& path) {
+    stop();
+
+    std::string resolved = expandPathTemplate(path);
+
+    FILE* file = std::fopen(resolved.c_str(), "wb");
+    if (!file) {
+        ZLOG_ERROR("Cannot create media capture {}", resolved);
+        return false;
+    }
+    std::fwrite(kMagic, 1, sizeof(kMagic), file);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_file = file;
+        m_firstNs = 0;
+        m_stop = false;
+        m_current.reserve(kBufferBytes);
+        m_memory->allocate(m_current.capacity());
+    }
+    m_writer = std::thread(&MediaCaptureWriter::writerLoop, this, file);
+    m_active.store(true, std::memory_order_relaxed);
+    ZLOG_INFO("Capturing media callbacks to {}", resolved);
+    return true;
+}
+
+void MediaCaptureWriter::stop() {
+    m_active.store(false, std::memory_order_relaxed);
+    FILE* file;
+    std::thread writer;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_file) return;
+        if (!m_current.empty()) {
+            m_pendingBytes += m_current.size();
+            m_pending.push_back(std::move(m_current));
+        } else {
+            m_memory->release(m_current.capacity());
+        }
+        m_current = Buffer();
+        m_stop = true;
+        // Whoever clears the file owns the writer; a concurrent stop() returns above
+        file = m_file;
+        m_file = nullptr;
+        writer = std::move(m_writer);
+    }
+    m_wake.notify_one();
+    writer.join();
+
+    std::fclose(file);
+    ZLOG_INFO("Media capture stopped: {} records, {} dropped", m_recorded.load(), m_dropped.load());
+}
+
+char* MediaCaptureWriter::reserve(size_t bytes) {
+    if (!m_file || m_stop) return nullptr;
+
+    if (!m_current.empty() && m_current.size() + bytes > m_current.capacity()) {
+        if (m_pendingBytes + m_current.size() > kMaxPendingBytes) {
+            return nullptr;
+        }
+        m_pendingBytes += m_current.size();
+        m_pending.push_back(std::move(m_current));
+        m_current = Buffer();
+        m_wake.notify_one();
+    }
+    if (m_current.capacity() < m_current.size() + bytes) {
+        size_t before = m_current.capacity();
+        m_current.reserve(std::max(kBufferBytes, m_current.size() + bytes));
+        m_memory->resize(before, m_current.capacity());
+    }
+
+    size_t offset = m_current.size();
+    m_current.resize(offset + bytes);
+    return m_current.data() + offset;
+}
+
+void MediaCaptureWriter::writeHeader(char* out, MediaRecord::Type type, uint32_t nodeId, uint64_t ingressNs,
+                                     uint32_t length) {
+    if (m_firstNs == 0) m_firstNs = ingressNs;
+    out = put<uint8_t>(out, type);
+    out = put<uint8_t>(out, 0);
+    out = put<uint16_t>(out, 0);
+    out = put<uint32_t>(out, nodeId);
+    out = put<uint64_t>(out, ingressNs > m_firstNs ? ingressNs - m_firstNs : 0);
+    put<uint32_t>(out, length);
+}
+
+void MediaCaptureWriter::record(MediaRecord::Type type, uint32_t nodeId, uint64_t ingressNs, const char* data,
+                                uint32_t length) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    char* out = length <= MediaRecord::kMaxLength ? reserve(kHeaderBytes + length) : nullptr;
+    if (!out) {
+        if (m_file) m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    writeHeader(out, type, nodeId, ingressNs, length);
+    std::memcpy(out + kHeaderBytes, data, length);
+    m_recorded.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MediaCaptureWriter::recordVideo(uint32_t sourceId, uint64_t ingressNs, uint32_t width, uint32_t height,
+                                     uint64_t sdkTimestamp, const char* y, const char* u, const char* v) {
+    size_t ySize = static_cast<size_t>(width) * height;
+    size_t cSize = static_cast<size_t>((width + 1) / 2) * ((height + 1) / 2);
+    size_t length = ySize + 2 * cSize;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    char* out = length <= MediaRecord::kMaxLength ? reserve(kHeaderBytes + kVideoHeaderBytes + length) : nullptr;
+    if (!out) {
+        if (m_file) m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    writeHeader(out, MediaRecord::VIDEO_I420, sourceId, ingressNs, static_cast<uint32_t>(length));
+    out = put<uint32_t>(out + kHeaderBytes, width);
+    out = put<uint32_t>(out, height);
+    out = put<uint64_t>(out, sdkTimestamp);
+    std::memcpy(out, y, ySize);
+    std::memcpy(out + ySize, u, cSize);
+    std::memcpy(out + ySize + cSize, v, cSize);
+    m_recorded.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MediaCaptureWriter::writerLoop(FILE* file) {
+    setCurrentThreadName("media-capture");
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_wake.wait(lock, [this] { return !m_pending.empty() || m_stop; });
+        if (m_pending.empty()) break;
+
+        Buffer buffer = std::move(m_pending.front());
+        m_pending.pop_front();
+        lock.unlock();
+        if (std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size()) {
+            ZLOG_ERROR("Failed to write media capture: {}", std::strerror(errno));
+        }
+        lock.lock();
+        m_pendingBytes -= buffer.size();
+        m_memory->release(buffer.capacity());
+    }
+}
+
+MediaCaptureReader::~MediaCaptureReader() {
+    if (m_file) std::fclose(m_file);
+}
+
+bool MediaCaptureReader::open(const std::string& path) {
+    if (m_file) std::fclose(m_file);
+    m_corrupt = false;
+    m_file = std::fopen(path.c_str(), "rb");
+    if (!m_file) return false;
+
+    char magic[sizeof(kMagic)];
+    if (std::fread(magic, 1, sizeof(magic), m_file) != sizeof(magic) || std::memcmp(magic, kMagic, sizeof(kMagic))) {
+        std::fclose(m_file);
+        m_file = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool MediaCaptureReader::next(MediaRecord& record) {
+    if (!m_file) return false;
+
+    char header[kHeaderBytes + kVideoHeaderBytes];
+    size_t read = std::fread(header, 1, kHeaderBytes, m_file);
+    if (read != kHeaderBytes) return read == 0 ? false : reject("truncated header");
+
+    uint8_t type;
+    const char* in = get(header, type) + 3;  // reserved
+    in = get(in, record.nodeId);
+    in = get(in, record.offsetNs);
+    get(in, record.length);
+    record.type = static_cast<MediaRecord::Type>(type);
+    record.width = record.height = 0;
+    record.sdkTimestamp = 0;
+
+    if (type > MediaRecord::VIDEO_I420) return reject("unknown record type");
+    if (record.length > MediaRecord::kMaxLength) return reject("oversized record");
+
+    if (record.type == MediaRecord::VIDEO_I420) {
+        if (std::fread(header + kHeaderBytes, 1, kVideoHeaderBytes, m_file) != kVideoHeaderBytes) {
+            return reject("truncated header");
+        }
+        in = get(header + kHeaderBytes, record.width);
+        in = get(in, record.height);
+        get(in, record.sdkTimestamp);
+
+        size_t ySize = static_cast<size_t>(record.width) * record.height;
+        size_t cSize = static_cast<size_t>((record.width + 1) / 2) * ((record.height + 1) / 2);
+        if (record.length != ySize + 2 * cSize) return reject("video planes do not match the record length");
+    }
+
+    if (m_payload.size() < record.length) m_payload.resize(record.length);
+    if (std::fread(m_payload.data(), 1, record.length, m_file) != record.length) return reject("truncated payload");
+    record.data = m_payload.data();
+    return true;
+}
+
+bool MediaCaptureReader::reject(const char* why) {
+    ZLOG_ERROR("Corrupt media capture: {}", why);
+    m_corrupt = true;
+    return false;
+}
+
+} // namespace Util
@@ -0,0 +1,161 @@
+#ifndef HEADLESS_ZOOM_BOT_MEDIA_CAPTURE_H
+#define HEADLESS_ZOOM_BOT_MEDIA_CAPTURE_H
+
+#include "MemoryAccounting.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Util {
+
+/**
+ * Binary trace of raw media callbacks, for replaying real meeting traffic offline
+ *
+ * A file starts with the 8-byte magic "ZMCAP\0\0\1" followed by records, all
+ * integers little-endian:
+ *
+ *   u8  type       MediaRecord::Type
+ *   u8  reserved   0
+ *   u16 reserved   0
+ *   u32 node_id    user id for audio, share source id for video
+ *   u64 offset_ns  time since the first record
+ *   u32 length     payload bytes
+ *   video only: u32 width, u32 height, u64 sdk_timestamp
+ *   payload        PCM, or the Y, U and V planes back to back
+ *
+ * A record is 20 bytes plus the payload (36 for video), so 10 ms of 32 kHz
+ * mono PCM costs 660 bytes per speaker.
+ */
+struct MediaRecord {
+    enum Type : uint8_t {
+        AUDIO_MIXED = 0,    // ZOOM_AUDIO_TYPE_MIXED
+        AUDIO_ONE_WAY = 1,  // ZOOM_AUDIO_TYPE_ONE_WAY
+        VIDEO_I420 = 2,
+    };
+
+    // Largest payload written or read, room for an 8K I420 frame
+    static constexpr uint32_t kMaxLength = 64 << 20;
+
+    Type type = AUDIO_MIXED;
+    uint32_t nodeId = 0;
+    uint64_t offsetNs = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint64_t sdkTimestamp = 0;
+    const char* data = nullptr;
+    uint32_t length = 0;
+};
+
+/**
+ * Writes media records of one meeting to a capture file
+ *
+ * Records are copied into a memory buffer under a short lock on the SDK
+ * delivery thread; a background thread writes full buffers, so disk latency
+ * never reaches the callbacks. When the writer falls more than
+ * kMaxPendingBytes behind, records are dropped and counted instead.
+ * isActive() is one relaxed load, so the delegates can check it per frame.
+ */
+class MediaCaptureWriter {
+public:
+    static constexpr size_t kBufferBytes = 4 << 20;
+    static constexpr size_t kMaxPendingBytes = 64 << 20;
+
+    // meeting identifies the owner in the memory accounts
+    explicit MediaCaptureWriter(const void* meeting = nullptr);
+    ~MediaCaptureWriter();
+
+    MediaCaptureWriter(const MediaCaptureWriter&) = delete;
+    MediaCaptureWriter& operator=(const MediaCaptureWriter&) = delete;
+
+    /**
+     * Start capturing into a new file, ending a running capture first
+     * @param path capture file, "%p" is replaced by the process id
+     * @return false if the file cannot be created
+     */
+    bool start(const std::string& path);
+
+    // Write out everything buffered and close the file
+    void stop();
+
+    bool isActive() const { return m_active.load(std::memory_order_relaxed); }
+
+    // Append a record; ingressNs is the CLOCK_MONOTONIC arrival time
+    void record(MediaRecord::Type type, uint32_t nodeId, uint64_t ingressNs, const char* data, uint32_t length);
+
+    // Append a video record from separate planes
+    void recordVideo(uint32_t sourceId, uint64_t ingressNs, uint32_t width, uint32_t height, uint64_t sdkTimestamp,
+                     const char* y, const char* u, const char* v);
+
+    uint64_t recorded() const { return m_recorded.load(std::memory_order_relaxed); }
+    uint64_t dropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    using Buffer = std::vector<char>;
+
+    // Reserve bytes in the current buffer, or nullptr if the record must be dropped
+    char* reserve(size_t bytes);
+    void writeHeader(char* out, MediaRecord::Type type, uint32_t nodeId, uint64_t ingressNs, uint32_t length);
+    // Writes pending buffers to file, which stop() closes once this returns
+    void writerLoop(FILE* file);
+
+    std::shared_ptr<MemoryAccount> m_memory;
+    std::atomic<bool> m_active{false};
+    std::atomic<uint64_t> m_recorded{0};
+    std::atomic<uint64_t> m_dropped{0};
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    FILE* m_file = nullptr;
+    uint64_t m_firstNs = 0;
+    Buffer m_current;
+    std::deque<Buffer> m_pending;
+    size_t m_pendingBytes = 0;
+    bool m_stop = false;
+    std::thread m_writer;
+};
+
+/**
+ * Reads a capture file record by record
+ */
+class MediaCaptureReader {
+public:
+    MediaCaptureReader() = default;
+    ~MediaCaptureReader();
+
+    MediaCaptureReader(const MediaCaptureReader&) = delete;
+    MediaCaptureReader& operator=(const MediaCaptureReader&) = delete;
+
+    // @return false if the file is missing or not a capture
+    bool open(const std::string& path);
+
+    /**
+     * Read the next record; its data points into the reader and stays valid until the next call
+     * A record of unknown type, over MediaRecord::kMaxLength, or whose video planes do not
+     * add up to its length is rejected: for video, the U and V planes start at the offsets
+     * given by width and height, so they are guaranteed to lie within data
+     * @return false at the end of the file or on a truncated or rejected record
+     */
+    bool next(MediaRecord& record);
+
+    // Whether next() stopped on a truncated or rejected record rather than at the end of the file
+    bool corrupt() const { return m_corrupt; }
+
+private:
+    bool reject(const char* why);
+
+    FILE* m_file = nullptr;
+    bool m_corrupt = false;
+    std::vector<char> m_payload;
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_MEDIA_CAPTURE_H
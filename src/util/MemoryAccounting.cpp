@@ -0,0 +1,104 @@
+#include "MemoryAccounting.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace Util {
+
+MemoryAccount::MemoryAccount(const char* subsystem, const void* meeting, MemoryAccount* parent)
+    : m_subsystem(subsystem), m_meeting(meeting), m_parent(parent) {}
+
+void MemoryAccount::allocate(size_t bytes) {
+    auto delta = static_cast<int64_t>(bytes);
+    int64_t current = m_current.fetch_add(delta, std::memory_order_relaxed) + delta;
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+
+    int64_t peak = m_peak.load(std::memory_order_relaxed);
+    bool newPeak = false;
+    while (current > peak) {
+        if (m_peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+            newPeak = true;
+            break;
+        }
+    }
+
+    if (m_currentGauge) {
+        m_currentGauge->add(delta);
+        m_allocationCounter->add();
+        if (newPeak) m_peakGauge->set(m_peak.load(std::memory_order_relaxed));
+    }
+    if (m_parent) m_parent->allocate(bytes);
+}
+
+void MemoryAccount::release(size_t bytes) {
+    auto delta = static_cast<int64_t>(bytes);
+    m_current.fetch_sub(delta, std::memory_order_relaxed);
+    m_frees.fetch_add(1, std::memory_order_relaxed);
+    if (m_currentGauge) m_currentGauge->add(-delta);
+    if (m_parent) m_parent->release(bytes);
+}
+
+MemoryAccount::Stats MemoryAccount::stats() const {
+    Stats s;
+    s.currentBytes = m_current.load(std::memory_order_relaxed);
+    s.peakBytes = m_peak.load(std::memory_order_relaxed);
+    s.allocations = m_allocations.load(std::memory_order_relaxed);
+    s.frees = m_frees.load(std::memory_order_relaxed);
+    return s;
+}
+
+// Caller holds m_mutex
+std::shared_ptr<MemoryAccount> MemoryAccounting::findSubsystem(const char* name) {
+    for (const auto& account : m_subsystems) {
+        if (std::strcmp(account->m_subsystem, name) == 0) return account;
+    }
+
+    auto account = std::make_shared<MemoryAccount>(name, nullptr, nullptr);
+    auto& registry = MetricsRegistry::getInstance();
+    std::string labels = std::string("subsystem=\"") + name + "\"";
+    account->m_currentGauge = &registry.gauge(
+        "zoom_native_memory_bytes", "Bytes held by library buffers, pools and queues", labels);
+    account->m_peakGauge = &registry.gauge(
+        "zoom_native_memory_peak_bytes", "Highest zoom_native_memory_bytes seen", labels);
+    account->m_allocationCounter = &registry.counter(
+        "zoom_native_allocations_total", "Allocations made for library buffers, pools and queues", labels);
+    m_subsystems.push_back(account);
+    return account;
+}
+
+std::shared_ptr<MemoryAccount> MemoryAccounting::subsystem(const char* name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return findSubsystem(name);
+}
+
+std::shared_ptr<MemoryAccount> MemoryAccounting::meeting(const char* subsystem, const void* meeting) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto parent = findSubsystem(subsystem);
+    // The parent is never removed, so the raw pointer stays valid
+    auto account = std::make_shared<MemoryAccount>(parent->m_subsystem, meeting, parent.get());
+    m_meetings.push_back(account);
+    return account;
+}
+
+void MemoryAccounting::removeMeeting(const void* meeting) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_meetings.erase(std::remove_if(m_meetings.begin(), m_meetings.end(),
+                                    [meeting](const auto& account) { return account->m_meeting == meeting; }),
+                     m_meetings.end());
+}
+
+std::vector<MemoryAccounting::Entry> MemoryAccounting::snapshot() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<Entry> entries;
+    entries.reserve(m_subsystems.size() + m_meetings.size());
+    for (const auto& account : m_subsystems) {
+        entries.push_back({account->m_subsystem, nullptr, account->stats()});
+    }
+    for (const auto& account : m_meetings) {
+        entries.push_back({account->m_subsystem, account->m_meeting, account->stats()});
+    }
+    return entries;
+}
+
+} // namespace Util
@@ -0,0 +1,158 @@
+#ifndef HEADLESS_ZOOM_BOT_MEMORY_ACCOUNTING_H
+#define HEADLESS_ZOOM_BOT_MEMORY_ACCOUNTING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Metrics.h"
+
+namespace Util {
+
+/**
+ * Bytes the library holds for one subsystem, optionally for one meeting
+ *
+ * Updated lock-free at each allocation and free. A meeting account also
+ * updates the process-wide account of its subsystem. Subsystem accounts are
+ * exported as zoom_native_memory_bytes, zoom_native_memory_peak_bytes and
+ * zoom_native_allocations_total. Meeting accounts are only listed by
+ * MemoryAccounting::snapshot(), so short-lived meetings add no metric series.
+ */
+class MemoryAccount {
+public:
+    struct Stats {
+        int64_t currentBytes = 0;
+        int64_t peakBytes = 0;
+        uint64_t allocations = 0;
+        uint64_t frees = 0;
+    };
+
+    MemoryAccount(const char* subsystem, const void* meeting, MemoryAccount* parent);
+
+    MemoryAccount(const MemoryAccount&) = delete;
+    MemoryAccount& operator=(const MemoryAccount&) = delete;
+
+    void allocate(size_t bytes);
+    void release(size_t bytes);
+
+    // Account an in-place size change, e.g. a vector growing its capacity
+    void resize(size_t oldBytes, size_t newBytes) {
+        if (newBytes > oldBytes) {
+            allocate(newBytes - oldBytes);
+        } else if (oldBytes > newBytes) {
+            release(oldBytes - newBytes);
+        }
+    }
+
+    Stats stats() const;
+    const char* subsystem() const { return m_subsystem; }
+    const void* meeting() const { return m_meeting; }
+
+private:
+    friend class MemoryAccounting;
+
+    const char* m_subsystem;
+    const void* m_meeting;
+    MemoryAccount* m_parent;
+
+    std::atomic<int64_t> m_current{0};
+    std::atomic<int64_t> m_peak{0};
+    std::atomic<uint64_t> m_allocations{0};
+    std::atomic<uint64_t> m_frees{0};
+
+    // Subsystem accounts only
+    Gauge* m_currentGauge = nullptr;
+    Gauge* m_peakGauge = nullptr;
+    Counter* m_allocationCounter = nullptr;
+};
+
+/**
+ * Process-wide list of memory accounts
+ *
+ * Every pool, ring and queue the library allocates reports to an account, so
+ * native memory growth can be told apart from the Zoom SDK's own. Subsystem
+ * names must be string literals.
+ */
+class MemoryAccounting {
+public:
+    struct Entry {
+        const char* subsystem;
+        const void* meeting;  // nullptr for a subsystem total
+        MemoryAccount::Stats stats;
+    };
+
+    static MemoryAccounting& getInstance() {
+        static MemoryAccounting instance;
+        return instance;
+    }
+
+    MemoryAccounting(const MemoryAccounting&) = delete;
+    MemoryAccounting& operator=(const MemoryAccounting&) = delete;
+
+    // Process-wide account of a subsystem; the same name always returns the same account
+    std::shared_ptr<MemoryAccount> subsystem(const char* name);
+
+    /**
+     * Create the account of one meeting within a subsystem
+     * It is listed until removeMeeting(); allocations still holding it may be
+     * released afterwards and keep the subsystem total right
+     */
+    std::shared_ptr<MemoryAccount> meeting(const char* subsystem, const void* meeting);
+
+    void removeMeeting(const void* meeting);
+
+    // Subsystem totals first, then meeting accounts
+    std::vector<Entry> snapshot() const;
+
+private:
+    MemoryAccounting() = default;
+
+    std::shared_ptr<MemoryAccount> findSubsystem(const char* name);
+
+    mutable std::mutex m_mutex;
+    std::vector<std::shared_ptr<MemoryAccount>> m_subsystems;
+    std::vector<std::shared_ptr<MemoryAccount>> m_meetings;
+};
+
+/**
+ * Standard allocator that reports to a memory account
+ * A default-constructed allocator reports nowhere, so containers using it
+ * behave like plain std containers until given an account.
+ */
+template<typename T>
+class AccountingAllocator {
+public:
+    using value_type = T;
+
+    AccountingAllocator() noexcept = default;
+    explicit AccountingAllocator(std::shared_ptr<MemoryAccount> account) noexcept : m_account(std::move(account)) {}
+
+    template<typename U>
+    AccountingAllocator(const AccountingAllocator<U>& other) noexcept : m_account(other.account()) {}
+
+    T* allocate(size_t n) {
+        T* p = std::allocator<T>().allocate(n);
+        if (m_account) m_account->allocate(n * sizeof(T));
+        return p;
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (m_account) m_account->release(n * sizeof(T));
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    const std::shared_ptr<MemoryAccount>& account() const noexcept { return m_account; }
+
+    template<typename U>
+    bool operator==(const AccountingAllocator<U>& other) const noexcept { return m_account == other.account(); }
+
+private:
+    std::shared_ptr<MemoryAccount> m_account;
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_MEMORY_ACCOUNTING_H
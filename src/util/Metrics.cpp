@@ -0,0 +1,195 @@
+#include "Metrics.h"
+
+#include <cmath>
+#include <cstdio>
+#include <unordered_set>
+
+namespace Util {
+
+size_t Histogram::bucketIndex(uint64_t value) {
+    if (value < kSubBuckets) {
+        return static_cast<size_t>(value);
+    }
+    int exponent = 63 - __builtin_clzll(value);
+    size_t sub = (value >> (exponent - kSubBits)) & (kSubBuckets - 1);
+    return kSubBuckets + static_cast<size_t>(exponent - kSubBits) * kSubBuckets + sub;
+}
+
+uint64_t Histogram::bucketUpperBound(size_t index) {
+    if (index < kSubBuckets) {
+        return index;
+    }
+    int shift = static_cast<int>((index - kSubBuckets) / kSubBuckets);
+    uint64_t sub = (index - kSubBuckets) % kSubBuckets;
+    uint64_t lower = (kSubBuckets + sub) << shift;
+    return lower + ((1ULL << shift) - 1);
+}
+
+Histogram::Snapshot Histogram::snapshot() const {
+    Snapshot s;
+    for (const auto& shard : m_shards) {
+        s.count += shard.count.load(std::memory_order_relaxed);
+        s.sum += shard.sum.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < kBucketCount; i++) {
+            s.buckets[i] += shard.buckets[i].load(std::memory_order_relaxed);
+        }
+    }
+    return s;
+}
+
+uint64_t Histogram::Snapshot::quantile(double q) const {
+    // Shards are read one by one, so buckets may hold a few more samples than count
+    uint64_t total = 0;
+    for (uint64_t b : buckets) total += b;
+    if (total == 0) return 0;
+
+    auto rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(total)));
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; i++) {
+        seen += buckets[i];
+        if (seen >= rank) return bucketUpperBound(i);
+    }
+    return bucketUpperBound(kBucketCount - 1);
+}
+
+uint64_t Histogram::Snapshot::max() const {
+    for (size_t i = kBucketCount; i > 0; i--) {
+        if (buckets[i - 1]) return bucketUpperBound(i - 1);
+    }
+    return 0;
+}
+
+MetricsRegistry::Entry& MetricsRegistry::findOrCreate(const std::string& name, const std::string& help,
+                                                       const std::string& labels, MetricType type, double scale) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& entry : m_entries) {
+        if (entry.name == name && entry.labels == labels && entry.type == type) {
+            return entry;
+        }
+    }
+
+    Entry& entry = m_entries.emplace_back();
+    entry.name = name;
+    entry.help = help;
+    entry.labels = labels;
+    entry.type = type;
+    entry.scale = scale;
+    switch (type) {
+        case MetricType::COUNTER: entry.counter = std::make_unique<Counter>(); break;
+        case MetricType::GAUGE: entry.gauge = std::make_unique<Gauge>(); break;
+        case MetricType::HISTOGRAM: entry.histogram = std::make_unique<Histogram>(); break;
+    }
+    return entry;
+}
+
+Counter& MetricsRegistry::counter(const std::string& name, const std::string& help, const std::string& labels) {
+    return *findOrCreate(name, help, labels, MetricType::COUNTER, 1.0).counter;
+}
+
+Gauge& MetricsRegistry::gauge(const std::string& name, const std::string& help, const std::string& labels) {
+    return *findOrCreate(name, help, labels, MetricType::GAUGE, 1.0).gauge;
+}
+
+Histogram& MetricsRegistry::histogram(const std::string& name, const std::string& help, const std::string& labels,
+                                      double scale) {
+    return *findOrCreate(name, help, labels, MetricType::HISTOGRAM, scale).histogram;
+}
+
+static std::string formatNumber(double value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+    return buffer;
+}
+
+static std::string labelSet(const std::string& labels, const std::string& extra = "") {
+    if (labels.empty() && extra.empty()) return "";
+    if (labels.empty()) return "{" + extra + "}";
+    if (extra.empty()) return "{" + labels + "}";
+    return "{" + labels + "," + extra + "}";
+}
+
+std::string MetricsRegistry::prometheusText() const {
+    static const char* kTypeNames[] = {"counter", "gauge", "histogram"};
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::string out;
+    std::unordered_set<std::string> written;
+
+    // All series of a name must follow a single HELP/TYPE header
+    for (const auto& first : m_entries) {
+        if (!written.insert(first.name).second) continue;
+
+        out += "# HELP " + first.name + " " + first.help + "\n";
+        out += "# TYPE " + first.name + " " + kTypeNames[static_cast<int>(first.type)] + "\n";
+
+        for (const auto& entry : m_entries) {
+            if (entry.name != first.name) continue;
+
+            switch (entry.type) {
+                case MetricType::COUNTER:
+                    out += entry.name + labelSet(entry.labels) + " " + std::to_string(entry.counter->value()) + "\n";
+                    break;
+                case MetricType::GAUGE:
+                    out += entry.name + labelSet(entry.labels) + " " + std::to_string(entry.gauge->value()) + "\n";
+                    break;
+                case MetricType::HISTOGRAM: {
+                    auto s = entry.histogram->snapshot();
+                    uint64_t cumulative = 0;
+                    for (size_t i = 0; i < Histogram::kBucketCount; i++) {
+                        if (!s.buckets[i]) continue;
+                        cumulative += s.buckets[i];
+                        double le = static_cast<double>(Histogram::bucketUpperBound(i)) * entry.scale;
+                        out += entry.name + "_bucket" + labelSet(entry.labels, "le=\"" + formatNumber(le) + "\"") +
+                               " " + std::to_string(cumulative) + "\n";
+                    }
+                    out += entry.name + "_bucket" + labelSet(entry.labels, "le=\"+Inf\"") + " " +
+                           std::to_string(cumulative) + "\n";
+                    out += entry.name + "_sum" + labelSet(entry.labels) + " " +
+                           formatNumber(static_cast<double>(s.sum) * entry.scale) + "\n";
+                    out += entry.name + "_count" + labelSet(entry.labels) + " " + std::to_string(cumulative) + "\n";
+                    break;
+                }
+            }
+        }
+    }
+    return out;
+}
+
+std::vector<MetricSample> MetricsRegistry::snapshot() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<MetricSample> samples;
+    samples.reserve(m_entries.size());
+
+    for (const auto& entry : m_entries) {
+        MetricSample sample{};
+        sample.name = &entry.name;
+        sample.labels = &entry.labels;
+        sample.type = entry.type;
+
+        switch (entry.type) {
+            case MetricType::COUNTER:
+                sample.value = static_cast<double>(entry.counter->value());
+                break;
+            case MetricType::GAUGE:
+                sample.value = static_cast<double>(entry.gauge->value());
+                break;
+            case MetricType::HISTOGRAM: {
+                auto s = entry.histogram->snapshot();
+                sample.count = s.count;
+                sample.sum = static_cast<double>(s.sum) * entry.scale;
+                sample.p50 = static_cast<double>(s.quantile(0.50)) * entry.scale;
+                sample.p90 = static_cast<double>(s.quantile(0.90)) * entry.scale;
+                sample.p99 = static_cast<double>(s.quantile(0.99)) * entry.scale;
+                sample.max = static_cast<double>(s.max()) * entry.scale;
+                sample.value = static_cast<double>(s.count);
+                break;
+            }
+        }
+        samples.push_back(sample);
+    }
+    return samples;
+}
+
+} // namespace Util
@@ -0,0 +1,209 @@
+#ifndef HEADLESS_ZOOM_BOT_METRICS_H
+#define HEADLESS_ZOOM_BOT_METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <time.h>
+#include <vector>
+
+namespace Util {
+
+namespace detail {
+
+// Writers touch only their own shard, so hot counters don't bounce a cache line between threads
+constexpr size_t kMetricShards = 16;
+
+inline size_t metricShard() {
+    static std::atomic<size_t> next{0};
+    thread_local size_t shard = next.fetch_add(1, std::memory_order_relaxed) % kMetricShards;
+    return shard;
+}
+
+struct alignas(64) PaddedCounter {
+    std::atomic<uint64_t> value{0};
+};
+
+} // namespace detail
+
+// CLOCK_MONOTONIC in nanoseconds: the clock frame timestamps use, shared by every thread and process on the host
+inline uint64_t monotonicNs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// Monotonic counter, sharded per thread
+class Counter {
+public:
+    void add(uint64_t n = 1) {
+        m_shards[detail::metricShard()].value.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const {
+        uint64_t total = 0;
+        for (const auto& shard : m_shards) {
+            total += shard.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    detail::PaddedCounter m_shards[detail::kMetricShards];
+};
+
+// Value that goes up and down, e.g. active meetings
+class Gauge {
+public:
+    void set(int64_t value) { m_value.store(value, std::memory_order_relaxed); }
+    void add(int64_t delta) { m_value.fetch_add(delta, std::memory_order_relaxed); }
+    int64_t value() const { return m_value.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> m_value{0};
+};
+
+/**
+ * Log-linear histogram of non-negative integer samples
+ *
+ * Each power of two is split into kSubBuckets linear buckets, so any recorded
+ * value is known to within 25% over the full 64-bit range with a fixed 252
+ * buckets. Buckets are sharded per thread like Counter; reads merge shards.
+ */
+class Histogram {
+public:
+    static constexpr int kSubBits = 2;
+    static constexpr size_t kSubBuckets = 1 << kSubBits;
+    static constexpr size_t kBucketCount = kSubBuckets + (64 - kSubBits) * kSubBuckets;
+
+    struct Snapshot {
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        uint64_t buckets[kBucketCount] = {};
+
+        // Upper bound of the bucket holding the q-th sample, 0 if empty
+        uint64_t quantile(double q) const;
+        uint64_t max() const;
+    };
+
+    void record(uint64_t value) {
+        Shard& shard = m_shards[detail::metricShard()];
+        shard.buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(value, std::memory_order_relaxed);
+        shard.count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void recordDuration(std::chrono::steady_clock::duration d) {
+        record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()));
+    }
+
+    Snapshot snapshot() const;
+
+    static size_t bucketIndex(uint64_t value);
+    static uint64_t bucketUpperBound(size_t index);
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> sum{0};
+        std::atomic<uint64_t> buckets[kBucketCount] = {};
+    };
+
+    Shard m_shards[detail::kMetricShards];
+};
+
+// Records the time from construction to destruction into a histogram
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Histogram& histogram)
+        : m_histogram(histogram), m_start(std::chrono::steady_clock::now()) {}
+    ~ScopedTimer() { m_histogram.recordDuration(std::chrono::steady_clock::now() - m_start); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Histogram& m_histogram;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+enum class MetricType {
+    COUNTER = 0,
+    GAUGE = 1,
+    HISTOGRAM = 2
+};
+
+// Point-in-time value of one metric, histograms summarized
+struct MetricSample {
+    const std::string* name;
+    const std::string* labels;   // Prometheus label body, e.g. type="audio_mixed"
+    MetricType type;
+    double value;                // counter/gauge value
+    uint64_t count;              // histogram sample count
+    double sum;                  // histogram sum, in exposition units
+    double p50, p90, p99, max;   // histogram quantiles, in exposition units
+};
+
+/**
+ * Process-wide metric registry
+ *
+ * Registration takes a lock and returns a reference that stays valid for the
+ * life of the process; call sites keep it (typically in a function-local
+ * static) and update it lock-free. Metrics are never removed.
+ */
+class MetricsRegistry {
+public:
+    static MetricsRegistry& getInstance() {
+        static MetricsRegistry instance;
+        return instance;
+    }
+
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    /**
+     * Get or create a metric; the same name and labels always return the same object
+     * @param name Prometheus metric name
+     * @param help one-line description
+     * @param labels label body without braces, e.g. type="video", or empty
+     * @param scale histograms only: factor from recorded units to exposition units
+     *              (1e-9 to record nanoseconds and expose seconds)
+     */
+    Counter& counter(const std::string& name, const std::string& help, const std::string& labels = "");
+    Gauge& gauge(const std::string& name, const std::string& help, const std::string& labels = "");
+    Histogram& histogram(const std::string& name, const std::string& help, const std::string& labels = "",
+                         double scale = 1.0);
+
+    // Prometheus text exposition format 0.0.4
+    std::string prometheusText() const;
+
+    std::vector<MetricSample> snapshot() const;
+
+private:
+    MetricsRegistry() = default;
+
+    struct Entry {
+        std::string name;
+        std::string help;
+        std::string labels;
+        MetricType type;
+        double scale = 1.0;
+        std::unique_ptr<Counter> counter;
+        std::unique_ptr<Gauge> gauge;
+        std::unique_ptr<Histogram> histogram;
+    };
+
+    Entry& findOrCreate(const std::string& name, const std::string& help, const std::string& labels,
+                        MetricType type, double scale);
+
+    mutable std::mutex m_mutex;
+    std::deque<Entry> m_entries;  // deque keeps entries in place as it grows
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_METRICS_H
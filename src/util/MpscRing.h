@@ -0,0 +1,100 @@
+#ifndef HEADLESS_ZOOM_BOT_MPSC_RING_H
+#define HEADLESS_ZOOM_BOT_MPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "MemoryAccounting.h"
+
+namespace Util {
+
+/**
+ * Bounded lock-free multi-producer single-consumer queue
+ *
+ * Every cell carries a sequence number telling producers and the consumer
+ * whose turn it is, so a push is one CAS on the head plus a release store,
+ * and a pop is two atomic operations on the cell. A full ring rejects the push
+ * instead of blocking; callers decide whether that is a drop.
+ */
+template<typename T>
+class MpscRing {
+public:
+    // Capacity is rounded up to a power of two; account, if given, is charged for the cells
+    explicit MpscRing(size_t capacity, std::shared_ptr<MemoryAccount> account = nullptr)
+        : m_account(std::move(account)) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        m_mask = size - 1;
+        m_cells = std::make_unique<Cell[]>(size);
+        for (size_t i = 0; i < size; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        if (m_account) m_account->allocate(size * sizeof(Cell));
+    }
+
+    ~MpscRing() {
+        if (m_account) m_account->release(capacity() * sizeof(Cell));
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    size_t capacity() const { return m_mask + 1; }
+
+    // Any thread; false if the ring is full
+    bool tryPush(T&& value) {
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells[pos & m_mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer thread only; false if nothing is ready
+    bool tryPop(T& out) {
+        Cell& cell = m_cells[m_tail & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != m_tail + 1) {
+            return false;
+        }
+        out = std::move(cell.value);
+        cell.sequence.store(m_tail + m_mask + 1, std::memory_order_release);
+        m_tail++;
+        return true;
+    }
+
+    // Consumer thread only
+    bool empty() const {
+        return m_cells[m_tail & m_mask].sequence.load(std::memory_order_acquire) != m_tail + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> m_cells;
+    size_t m_mask = 0;
+    std::shared_ptr<MemoryAccount> m_account;
+    alignas(64) std::atomic<size_t> m_head{0};
+    alignas(64) size_t m_tail = 0;
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_MPSC_RING_H
@@ -0,0 +1,36 @@
+#ifndef HEADLESS_ZOOM_BOT_PATH_TEMPLATE_H
+#define HEADLESS_ZOOM_BOT_PATH_TEMPLATE_H
+
+#include <string>
+
+#include <unistd.h>
+
+namespace Util {
+
+/**
+ * Expand the placeholders of a diagnostic file path
+ *
+ * Every "%p" becomes the process id, and every "%m" the meeting id when one
+ * is given; without one "%m" is kept as is.
+ */
+inline std::string expandPathTemplate(const std::string& path, const std::string& meetingId = std::string()) {
+    std::string expanded;
+    expanded.reserve(path.size());
+    for (size_t i = 0; i < path.size(); i++) {
+        char next = i + 1 < path.size() ? path[i + 1] : '\0';
+        if (path[i] == '%' && next == 'p') {
+            expanded += std::to_string(getpid());
+            i++;
+        } else if (path[i] == '%' && next == 'm' && !meetingId.empty()) {
+            expanded += meetingId;
+            i++;
+        } else {
+            expanded += path[i];
+        }
+    }
+    return expanded;
+}
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_PATH_TEMPLATE_H
@@ -0,0 +1,46 @@
+#ifndef HEADLESS_ZOOM_BOT_PROBES_H
+#define HEADLESS_ZOOM_BOT_PROBES_H
+
+/**
+ * USDT static probes, provider "zoomsdk"
+ *
+ * Each probe compiles to a single nop plus an ELF note, so an unattached probe
+ * costs nothing beyond keeping its arguments in registers. Attach with
+ * bpftrace or perf without rebuilding, e.g.
+ *
+ *   bpftrace -e 'usdt:./libzoomsdk_c.so:zoomsdk:audio_frame { @[arg0] = count(); }'
+ *
+ * List the probes with `bpftrace -l 'usdt:./libzoomsdk_c.so:*'`; examples are in
+ * tools/bpftrace. Meetings are identified by their MeetingHandle (the Meeting
+ * pointer). Probes compile out when sys/sdt.h (systemtap-sdt-dev) is missing
+ * or with -DZOOM_SDK_NO_USDT.
+ *
+ * Probes and arguments:
+ *   audio_frame(meeting, type, node_id, length, ingress_ns)   audio delegate entry
+ *   video_frame(meeting, source_id, width, height, ingress_ns) video delegate entry
+ *   dispatch_start(meeting, kind, ingress_ns)                 consumer callback entry
+ *   dispatch_end(meeting, kind, duration_ns)                  consumer callback return
+ *   frame_drop(meeting, kind, reason)                         reason is a C string
+ *   audio_subscribe(meeting, error) / audio_unsubscribe(meeting)
+ *   share_subscribe(meeting, source_id, error) / share_unsubscribe(meeting, source_id)
+ *   auth_start(sdk) / auth_result(result)
+ *   meeting_status(status, result)                            every SDK status change
+ *   join_start(meeting) / joined(meeting) / left(meeting)
+ *
+ * kind is 0 mixed audio, 1 one-way audio, 2 share audio, 3 video.
+ */
+
+#if !defined(ZOOM_SDK_NO_USDT) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define ZOOM_SDK_HAS_USDT 1
+#endif
+#endif
+
+#ifdef ZOOM_SDK_HAS_USDT
+#include <sys/sdt.h>
+#define ZPROBE(name, ...) STAP_PROBEV(zoomsdk, name, ##__VA_ARGS__)
+#else
+#define ZPROBE(name, ...) ((void)0)
+#endif
+
+#endif // HEADLESS_ZOOM_BOT_PROBES_H
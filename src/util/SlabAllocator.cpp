@@ -0,0 +1,266 @@
+#include "SlabAllocator.h"
+#include "Logger.h"
+
+#include <sys/mman.h>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace Util {
+
+namespace {
+
+constexpr size_t kHugePage = 2 << 20;
+
+struct ClassSpec {
+    size_t objectSize;
+    size_t slabBytes;   // Multiple of 2 MiB, chosen so little of it is left over
+    uint32_t cacheLimit;  // Objects a thread may keep; about half move at a time
+};
+
+// 360p, 720p and 1080p are the I420 sizes (w * h * 3 / 2) rounded up to 1 KiB
+constexpr ClassSpec kClasses[SlabAllocator::kClassCount] = {
+    {1 << 10, kHugePage, 64},
+    {2 << 10, kHugePage, 64},
+    {4 << 10, kHugePage, 64},
+    {8 << 10, kHugePage, 32},
+    {16 << 10, kHugePage, 32},
+    {64 << 10, kHugePage, 16},
+    {338 << 10, 3 * kHugePage, 4},   // 640x360: 345600 bytes, 18 per slab
+    {1350 << 10, 2 * kHugePage, 2},  // 1280x720: 1382400 bytes, 3 per slab
+    {3038 << 10, 3 * kHugePage, 2},  // 1920x1080: 3110400 bytes, 2 per slab
+};
+
+constexpr uint32_t kMaxCache = 64;
+
+// Free objects are linked through their first bytes
+struct FreeObject {
+    FreeObject* next;
+};
+
+} // namespace
+
+struct SlabAllocator::SizeClass {
+    size_t objectSize;
+    size_t slabBytes;
+    uint32_t cacheLimit;
+
+    std::mutex mutex;
+    FreeObject* freeList = nullptr;
+    uint64_t freeCount = 0;
+    uint64_t slabs = 0;
+    uint64_t hugeTlbSlabs = 0;
+
+    Counter* allocations = nullptr;
+    Counter* frees = nullptr;
+};
+
+struct SlabAllocator::ThreadCache {
+    void* objects[kClassCount][kMaxCache];
+    uint32_t count[kClassCount] = {};
+
+    ~ThreadCache() {
+        auto& allocator = SlabAllocator::getInstance();
+        for (size_t i = 0; i < kClassCount; i++) {
+            allocator.spill(allocator.m_classes[i], *this, i, 0);
+        }
+    }
+};
+
+SlabAllocator& SlabAllocator::getInstance() {
+    // Never destroyed, see ~SlabAllocator
+    static SlabAllocator* instance = new SlabAllocator();
+    return *instance;
+}
+
+SlabAllocator::SlabAllocator()
+    : m_classes(new SizeClass[kClassCount])
+    , m_mapped(MemoryAccounting::getInstance().subsystem("slab"))
+    , m_hugeTlbFallbacks(MetricsRegistry::getInstance().counter(
+          "zoom_slab_hugetlb_fallbacks_total", "Slabs mapped as transparent huge pages because no huge page was reserved")) {
+    auto& registry = MetricsRegistry::getInstance();
+    for (size_t i = 0; i < kClassCount; i++) {
+        auto& cls = m_classes[i];
+        cls.objectSize = kClasses[i].objectSize;
+        cls.slabBytes = kClasses[i].slabBytes;
+        cls.cacheLimit = kClasses[i].cacheLimit;
+        std::string labels = "size=\"" + std::to_string(cls.objectSize) + "\"";
+        cls.allocations = &registry.counter("zoom_slab_allocations_total", "Slab pool allocations by size class", labels);
+        cls.frees = &registry.counter("zoom_slab_frees_total", "Slab pool frees by size class", labels);
+    }
+
+    const char* pages = std::getenv("ZOOM_SDK_SLAB_PAGES");
+    if (pages && std::strcmp(pages, "thp") == 0) {
+        m_backing.store(Backing::TRANSPARENT_HUGE_PAGES);
+    } else if (pages && std::strcmp(pages, "hugetlb") == 0) {
+        m_backing.store(Backing::HUGETLB);
+    }
+}
+
+bool SlabAllocator::setBacking(Backing backing) {
+    if (backing > Backing::HUGETLB) return false;
+    m_backing.store(backing, std::memory_order_relaxed);
+    return true;
+}
+
+size_t SlabAllocator::sizeClass(size_t bytes) {
+    for (size_t i = 0; i < kClassCount; i++) {
+        if (bytes <= kClasses[i].objectSize) return i;
+    }
+    return kNoClass;
+}
+
+size_t SlabAllocator::classObjectSize(size_t cls) {
+    return cls < kClassCount ? kClasses[cls].objectSize : 0;
+}
+
+SlabAllocator::ThreadCache& SlabAllocator::threadCache() {
+    static thread_local ThreadCache cache;
+    return cache;
+}
+
+void* SlabAllocator::allocate(size_t bytes) {
+    size_t index = sizeClass(bytes);
+    if (index == kNoClass) {
+        return std::malloc(bytes);
+    }
+
+    auto& cls = m_classes[index];
+    auto& cache = threadCache();
+    if (cache.count[index] == 0 && !refill(cls, cache, index)) {
+        return nullptr;
+    }
+    cls.allocations->add();
+    return cache.objects[index][--cache.count[index]];
+}
+
+void SlabAllocator::deallocate(void* p, size_t bytes) noexcept {
+    if (!p) return;
+    size_t index = sizeClass(bytes);
+    if (index == kNoClass) {
+        std::free(p);
+        return;
+    }
+
+    auto& cls = m_classes[index];
+    auto& cache = threadCache();
+    if (cache.count[index] == cls.cacheLimit) {
+        spill(cls, cache, index, cls.cacheLimit / 2);
+    }
+    cache.objects[index][cache.count[index]++] = p;
+    cls.frees->add();
+}
+
+// Takes half a cache worth of objects from the shared list, mapping a slab if it is empty
+bool SlabAllocator::refill(SizeClass& cls, ThreadCache& cache, size_t index) {
+    std::lock_guard<std::mutex> lock(cls.mutex);
+    if (!cls.freeList && !mapSlab(cls)) {
+        return false;
+    }
+    uint32_t want = cls.cacheLimit > 1 ? cls.cacheLimit / 2 : 1;
+    while (cache.count[index] < want && cls.freeList) {
+        FreeObject* object = cls.freeList;
+        cls.freeList = object->next;
+        cls.freeCount--;
+        cache.objects[index][cache.count[index]++] = object;
+    }
+    return true;
+}
+
+// Returns cached objects beyond keep to the shared list
+void SlabAllocator::spill(SizeClass& cls, ThreadCache& cache, size_t index, size_t keep) {
+    if (cache.count[index] <= keep) return;
+    std::lock_guard<std::mutex> lock(cls.mutex);
+    while (cache.count[index] > keep) {
+        auto* object = static_cast<FreeObject*>(cache.objects[index][--cache.count[index]]);
+        object->next = cls.freeList;
+        cls.freeList = object;
+        cls.freeCount++;
+    }
+}
+
+// Caller holds cls.mutex
+bool SlabAllocator::mapSlab(SizeClass& cls) {
+    const int prot = PROT_READ | PROT_WRITE;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    Backing backing = m_backing.load(std::memory_order_relaxed);
+    char* slab = nullptr;
+
+    if (backing == Backing::HUGETLB) {
+        void* p = mmap(nullptr, cls.slabBytes, prot, flags | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+            slab = static_cast<char*>(p);
+            cls.hugeTlbSlabs++;
+        } else {
+            m_hugeTlbFallbacks.add();
+            if (!m_hugeTlbWarned.exchange(true)) {
+                ZLOG_WARN("No huge pages reserved for the slab pool (vm.nr_hugepages), using transparent huge pages");
+            }
+        }
+    }
+
+    if (!slab && backing != Backing::PAGES) {
+        // Over-map by one huge page and trim, so the slab starts on a 2 MiB boundary
+        void* p = mmap(nullptr, cls.slabBytes + kHugePage, prot, flags, -1, 0);
+        if (p == MAP_FAILED) return false;
+        auto base = reinterpret_cast<uintptr_t>(p);
+        uintptr_t aligned = (base + kHugePage - 1) & ~(kHugePage - 1);
+        if (aligned > base) munmap(p, aligned - base);
+        munmap(reinterpret_cast<void*>(aligned + cls.slabBytes), base + kHugePage - aligned);
+        slab = reinterpret_cast<char*>(aligned);
+        madvise(slab, cls.slabBytes, MADV_HUGEPAGE);
+    } else if (!slab) {
+        void* p = mmap(nullptr, cls.slabBytes, prot, flags, -1, 0);
+        if (p == MAP_FAILED) return false;
+        slab = static_cast<char*>(p);
+    }
+
+    size_t objects = cls.slabBytes / cls.objectSize;
+    for (size_t i = objects; i-- > 0;) {
+        auto* object = reinterpret_cast<FreeObject*>(slab + i * cls.objectSize);
+        object->next = cls.freeList;
+        cls.freeList = object;
+    }
+    cls.freeCount += objects;
+    cls.slabs++;
+    m_mapped->allocate(cls.slabBytes);
+    return true;
+}
+
+std::vector<SlabAllocator::ClassStats> SlabAllocator::stats() const {
+    std::vector<ClassStats> result(kClassCount);
+    for (size_t i = 0; i < kClassCount; i++) {
+        auto& cls = m_classes[i];
+        auto& s = result[i];
+        s.objectSize = cls.objectSize;
+        s.slabBytes = cls.slabBytes;
+        s.allocations = cls.allocations->value();
+        s.frees = cls.frees->value();
+        s.outstanding = s.allocations > s.frees ? s.allocations - s.frees : 0;
+        std::lock_guard<std::mutex> lock(cls.mutex);
+        s.slabs = cls.slabs;
+        s.hugeTlbSlabs = cls.hugeTlbSlabs;
+        s.sharedFree = cls.freeCount;
+    }
+    return result;
+}
+
+size_t SlabAllocator::reportLeaks() const {
+    size_t bytes = 0;
+    for (const auto& s : stats()) {
+        if (s.outstanding == 0) continue;
+        bytes += s.outstanding * s.objectSize;
+        ZLOG_WARN("Slab class {} bytes: {} objects outstanding ({} allocations, {} frees)", s.objectSize,
+                  s.outstanding, s.allocations, s.frees);
+    }
+    return bytes;
+}
+
+void SlabAllocator::flushThreadCache() {
+    auto& cache = threadCache();
+    for (size_t i = 0; i < kClassCount; i++) {
+        spill(m_classes[i], cache, i, 0);
+    }
+}
+
+} // namespace Util
@@ -0,0 +1,150 @@
+#ifndef HEADLESS_ZOOM_BOT_SLAB_ALLOCATOR_H
+#define HEADLESS_ZOOM_BOT_SLAB_ALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "MemoryAccounting.h"
+#include "Metrics.h"
+
+namespace Util {
+
+/**
+ * Fixed size-class pool for media frame buffers
+ *
+ * Requests are rounded up to one of a few classes sized for audio chunks
+ * (1 to 64 KiB) and I420 frames (360p, 720p and 1080p). Each class carves
+ * objects out of slabs of 2 MiB multiples mapped with mmap, optionally
+ * backed by transparent or hugetlbfs huge pages so a 720p frame spans one
+ * TLB entry instead of 338. Freed objects go to a per-thread cache first and
+ * move to the class's shared free list in batches, so steady-state
+ * allocation takes no lock and touches no shared cache line. Slabs are kept
+ * until exit; the pool's footprint is the peak of what was in use.
+ *
+ * Larger requests fall through to malloc. deallocate() must get the size
+ * given to allocate(), as with sized delete.
+ *
+ * Leak accounting: every class counts allocations and frees
+ * (zoom_slab_allocations_total / zoom_slab_frees_total), stats() shows the
+ * objects each class has outstanding and reportLeaks() logs them. Mapped
+ * slabs are charged to the "slab" memory account; owners charge what they
+ * hold to their own accounts, see SlabBufferAllocator.
+ */
+class SlabAllocator {
+public:
+    enum class Backing : uint8_t {
+        PAGES = 0,                   // Regular pages
+        TRANSPARENT_HUGE_PAGES = 1,  // 2 MiB-aligned slabs with MADV_HUGEPAGE
+        HUGETLB = 2,                 // MAP_HUGETLB from the reserved pool, as above if it is empty
+    };
+
+    struct ClassStats {
+        size_t objectSize = 0;
+        size_t slabBytes = 0;
+        uint64_t slabs = 0;
+        uint64_t hugeTlbSlabs = 0;   // Slabs actually mapped from hugetlbfs
+        uint64_t allocations = 0;
+        uint64_t frees = 0;
+        uint64_t outstanding = 0;    // Allocations not freed yet
+        uint64_t sharedFree = 0;     // Objects in the shared free list (thread caches not included)
+    };
+
+    static constexpr size_t kClassCount = 9;
+    static constexpr size_t kNoClass = kClassCount;
+
+    /**
+     * Process-wide pool, backed as ZOOM_SDK_SLAB_PAGES says ("thp" or
+     * "hugetlb", regular pages otherwise)
+     */
+    static SlabAllocator& getInstance();
+
+    /**
+     * Change the backing of slabs mapped from now on
+     * @return false if the backing is unknown
+     */
+    bool setBacking(Backing backing);
+    Backing backing() const { return m_backing.load(std::memory_order_relaxed); }
+
+    // nullptr if the mapping failed
+    void* allocate(size_t bytes);
+    void deallocate(void* p, size_t bytes) noexcept;
+
+    // Class serving a request, kNoClass if malloc does
+    static size_t sizeClass(size_t bytes);
+    static size_t classObjectSize(size_t cls);
+
+    std::vector<ClassStats> stats() const;
+
+    /**
+     * Log every class that has objects outstanding
+     * @return bytes outstanding, counted at class size
+     */
+    size_t reportLeaks() const;
+
+    // Hand this thread's cached objects back to the shared lists, e.g. before a thread parks for long
+    void flushThreadCache();
+
+private:
+    struct SizeClass;
+    struct ThreadCache;
+
+    SlabAllocator();
+    ~SlabAllocator() = delete;  // Lives until exit: threads may flush their caches during teardown
+
+    bool refill(SizeClass& cls, ThreadCache& cache, size_t index);
+    void spill(SizeClass& cls, ThreadCache& cache, size_t index, size_t keep);
+    bool mapSlab(SizeClass& cls);
+    static ThreadCache& threadCache();
+
+    SizeClass* m_classes;
+    std::atomic<Backing> m_backing{Backing::PAGES};
+    std::shared_ptr<MemoryAccount> m_mapped;
+    Counter& m_hugeTlbFallbacks;
+    std::atomic<bool> m_hugeTlbWarned{false};
+};
+
+/**
+ * Standard allocator on the slab pool that also reports to a memory account,
+ * like AccountingAllocator. Meant for frame-sized buffers, e.g.
+ * std::vector<char, SlabBufferAllocator<char>>
+ */
+template<typename T>
+class SlabBufferAllocator {
+public:
+    using value_type = T;
+
+    SlabBufferAllocator() noexcept = default;
+    explicit SlabBufferAllocator(std::shared_ptr<MemoryAccount> account) noexcept : m_account(std::move(account)) {}
+
+    template<typename U>
+    SlabBufferAllocator(const SlabBufferAllocator<U>& other) noexcept : m_account(other.account()) {}
+
+    T* allocate(size_t n) {
+        void* p = SlabAllocator::getInstance().allocate(n * sizeof(T));
+        if (!p) throw std::bad_alloc();
+        if (m_account) m_account->allocate(n * sizeof(T));
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, size_t n) noexcept {
+        if (m_account) m_account->release(n * sizeof(T));
+        SlabAllocator::getInstance().deallocate(p, n * sizeof(T));
+    }
+
+    const std::shared_ptr<MemoryAccount>& account() const noexcept { return m_account; }
+
+    template<typename U>
+    bool operator==(const SlabBufferAllocator<U>& other) const noexcept { return m_account == other.account(); }
+
+private:
+    std::shared_ptr<MemoryAccount> m_account;
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_SLAB_ALLOCATOR_H
@@ -0,0 +1,180 @@
+#ifndef HEADLESS_ZOOM_BOT_TASK_H
+#define HEADLESS_ZOOM_BOT_TASK_H
+
+#include "Logger.h"
+
+#include <coroutine>
+#include <exception>
+#include <list>
+#include <optional>
+#include <utility>
+
+namespace Util {
+
+namespace detail {
+
+struct TaskPromiseBase {
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+
+    // Tasks are lazy: nothing runs until the task is awaited or spawned
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    // Resume whoever awaited this task; detached tasks just stay suspended until reaped
+    struct FinalAwaiter {
+        bool await_ready() noexcept { return false; }
+
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+            auto next = handle.promise().continuation;
+            return next ? next : std::noop_coroutine();
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    void unhandled_exception() { exception = std::current_exception(); }
+};
+
+template<typename T>
+struct TaskPromise : TaskPromiseBase {
+    std::optional<T> value;
+
+    void return_value(T result) { value = std::move(result); }
+    T take() {
+        if (exception) std::rethrow_exception(exception);
+        return std::move(*value);
+    }
+};
+
+template<>
+struct TaskPromise<void> : TaskPromiseBase {
+    void return_void() {}
+    void take() {
+        if (exception) std::rethrow_exception(exception);
+    }
+};
+
+} // namespace detail
+
+/**
+ * Coroutine returning T
+ *
+ * A task owns its coroutine frame: destroying a suspended task destroys the
+ * frame, which in turn cancels whatever it was awaiting. Awaiting a task runs
+ * it to completion and yields its result. Tasks never switch threads on their
+ * own; they resume wherever the awaited event completes (see AsyncEvent).
+ */
+template<typename T = void>
+class Task {
+public:
+    struct promise_type : detail::TaskPromise<T> {
+        Task get_return_object() {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+    };
+
+    Task() = default;
+    Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            reset();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+    ~Task() { reset(); }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    bool done() const { return !m_handle || m_handle.done(); }
+
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() noexcept { return !handle || handle.done(); }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle.promise().continuation = awaiting;
+                return handle;
+            }
+            T await_resume() { return handle.promise().take(); }
+        };
+        return Awaiter{m_handle};
+    }
+
+private:
+    friend class TaskScope;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+    void start() {
+        if (m_handle && !m_handle.done()) m_handle.resume();
+    }
+
+    // Rethrows what a finished task threw
+    void rethrow() {
+        if (m_handle && m_handle.done()) m_handle.promise().take();
+    }
+
+    void reset() {
+        if (m_handle) {
+            m_handle.destroy();
+            m_handle = nullptr;
+        }
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * Owner of detached tasks
+ *
+ * spawn() starts a task and keeps its frame alive until it finishes; the
+ * scope's destructor (or clear()) destroys tasks still suspended, so an owner
+ * such as a Meeting can go away with work in flight. Nobody awaits a detached
+ * task, so an exception it ends with is logged when the task is reaped.
+ */
+class TaskScope {
+public:
+    TaskScope() = default;
+    ~TaskScope() { clear(); }
+
+    TaskScope(const TaskScope&) = delete;
+    TaskScope& operator=(const TaskScope&) = delete;
+
+    void spawn(Task<void> task) {
+        m_tasks.remove_if([](Task<void>& t) {
+            if (!t.done()) return false;
+            reap(t);
+            return true;
+        });
+        m_tasks.push_back(std::move(task));
+        m_tasks.back().start();
+    }
+
+    void clear() {
+        for (auto& task : m_tasks) reap(task);
+        m_tasks.clear();
+    }
+
+private:
+    // Logs what a finished task threw; a task still suspended has nothing to report
+    static void reap(Task<void>& task) {
+        try {
+            task.rethrow();
+        } catch (const std::exception& e) {
+            ZLOG_ERROR("Detached task failed: {}", e.what());
+        } catch (...) {
+            ZLOG_ERROR("Detached task failed with a non-standard exception");
+        }
+    }
+
+    std::list<Task<void>> m_tasks;
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_TASK_H
@@ -0,0 +1,90 @@
+#include "ThreadOptions.h"
+#include "Logger.h"
+
+#include <cerrno>
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace Util {
+
+// Unique across all bindings, so a binding reallocated at the same address never matches
+static std::atomic<uint64_t> g_nextGeneration{1};
+
+static void logFailure(const ThreadOptions& options, const std::string& what, int err) {
+    ZLOG_WARN("Thread '{}': failed to {}: {}", options.name, what, std::strerror(err));
+}
+
+void setCurrentThreadName(const std::string& name) {
+    if (name.empty()) return;
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+}
+
+bool applyThreadOptions(const ThreadOptions& options) {
+    bool ok = true;
+    setCurrentThreadName(options.name);
+
+    if (!options.cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : options.cpus) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &set);
+            }
+        }
+        int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        if (err != 0) {
+            logFailure(options, "set CPU affinity", err);
+            ok = false;
+        }
+    }
+
+    if (options.policy == SchedPolicy::DEFAULT) {
+        // Linux applies setpriority() on a thread id to that thread only
+        if (options.priority != 0 &&
+            setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), options.priority) != 0) {
+            logFailure(options, "set nice value " + std::to_string(options.priority), errno);
+            ok = false;
+        }
+    } else {
+        int policy = options.policy == SchedPolicy::FIFO ? SCHED_FIFO : SCHED_RR;
+        sched_param param{};
+        param.sched_priority = options.priority;
+        int err = pthread_setschedparam(pthread_self(), policy, &param);
+        if (err != 0) {
+            logFailure(options, "set real-time priority " + std::to_string(options.priority), err);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+void ThreadBinding::set(const ThreadOptions& options) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_options = options;
+    m_generation.store(g_nextGeneration.fetch_add(1), std::memory_order_release);
+}
+
+ThreadOptions ThreadBinding::get() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_options;
+}
+
+void ThreadBinding::bindCurrentThread() {
+    // Binding and generation this thread last applied
+    thread_local const ThreadBinding* appliedBinding = nullptr;
+    thread_local uint64_t appliedGeneration = 0;
+
+    uint64_t generation = m_generation.load(std::memory_order_acquire);
+    if (generation == 0 || (appliedBinding == this && generation == appliedGeneration)) {
+        return;
+    }
+    appliedBinding = this;
+    appliedGeneration = generation;
+    applyThreadOptions(get());
+}
+
+} // namespace Util
@@ -0,0 +1,76 @@
+#ifndef HEADLESS_ZOOM_BOT_THREAD_OPTIONS_H
+#define HEADLESS_ZOOM_BOT_THREAD_OPTIONS_H
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Util {
+
+enum class SchedPolicy {
+    DEFAULT = 0,    // SCHED_OTHER, priority is a nice value (0 = leave unchanged)
+    FIFO = 1,       // SCHED_FIFO, priority 1..99
+    ROUND_ROBIN = 2 // SCHED_RR, priority 1..99
+};
+
+// Placement and scheduling of one thread
+struct ThreadOptions {
+    std::string name;       // Shown by top -H / perf, truncated to 15 characters
+    std::vector<int> cpus;  // Allowed CPUs, empty = inherit
+    SchedPolicy policy = SchedPolicy::DEFAULT;
+    int priority = 0;
+
+    bool empty() const {
+        return name.empty() && cpus.empty() && policy == SchedPolicy::DEFAULT && priority == 0;
+    }
+};
+
+/**
+ * Name the calling thread
+ * @param name thread name, truncated to the 15 characters Linux allows
+ */
+void setCurrentThreadName(const std::string& name);
+
+/**
+ * Apply name, affinity and scheduling to the calling thread
+ * Each part is applied independently; failures (typically EPERM for real-time
+ * policies without CAP_SYS_NICE) are logged and the remaining parts still apply
+ * @param options options to apply, empty fields are left unchanged
+ * @return true if every requested part was applied
+ */
+bool applyThreadOptions(const ThreadOptions& options);
+
+/**
+ * Thread options for threads the library does not create itself, such as the
+ * SDK thread that delivers raw data. Options are applied lazily the first time
+ * a thread calls bindCurrentThread(), and again after they change.
+ *
+ * A thread remembers only the binding it applied last, so each thread should
+ * be bound by a single binding; threads the SDK shares between meetings get
+ * one process-wide binding.
+ */
+class ThreadBinding {
+public:
+    ThreadBinding() = default;
+    explicit ThreadBinding(const ThreadOptions& options) { set(options); }
+
+    ThreadBinding(const ThreadBinding&) = delete;
+    ThreadBinding& operator=(const ThreadBinding&) = delete;
+
+    void set(const ThreadOptions& options);
+    ThreadOptions get() const;
+
+    // Cheap when nothing changed: one atomic load and a thread-local compare
+    void bindCurrentThread();
+
+private:
+    mutable std::mutex m_mutex;
+    ThreadOptions m_options;
+    std::atomic<uint64_t> m_generation{0};  // 0 = nothing to apply
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_THREAD_OPTIONS_H
@@ -0,0 +1,193 @@
+#include "Trace.h"
+#include "Logger.h"
+#include "PathTemplate.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace Util {
+
+static void appendEscaped(std::string& out, const std::string& text) {
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out += ' ';
+        } else {
+            out += c;
+        }
+    }
+}
+
+// Chrome trace timestamps are microseconds
+static void appendMicros(std::string& out, uint64_t ns) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%llu.%03llu",
+                  static_cast<unsigned long long>(ns / 1000), static_cast<unsigned long long>(ns % 1000));
+    out += buffer;
+}
+
+// The account is taken first so the accounting outlives the tracer at exit
+Tracer::Tracer() : m_memory(MemoryAccounting::getInstance().subsystem("trace")) {
+    if (const char* path = std::getenv("ZOOM_SDK_TRACE")) {
+        if (*path) enable(path);
+    }
+}
+
+Tracer::~Tracer() {
+    if (isEnabled()) write();
+}
+
+void Tracer::enable(const std::string& path) {
+    std::string resolved = expandPathTemplate(path);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_path = resolved;
+    }
+    m_enabled.store(true, std::memory_order_relaxed);
+    ZLOG_INFO("Tracing enabled, writing to {}", resolved);
+}
+
+bool Tracer::disable() {
+    if (!m_enabled.exchange(false, std::memory_order_relaxed)) {
+        return false;
+    }
+    bool ok = write();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& buffer : m_buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        buffer->events.clear();
+        buffer->dropped = 0;
+    }
+    return ok;
+}
+
+std::string Tracer::path() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_path;
+}
+
+bool Tracer::write() {
+    std::string file = path();
+    if (file.empty()) {
+        return false;
+    }
+
+    std::ofstream out(file, std::ios::trunc);
+    out << json();
+    out.close();
+    return static_cast<bool>(out);
+}
+
+Tracer::ThreadBuffer& Tracer::threadBuffer() {
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (buffer) {
+        return *buffer;
+    }
+
+    auto owned = std::make_unique<ThreadBuffer>(AccountingAllocator<Event>(m_memory));
+    owned->tid = static_cast<int>(syscall(SYS_gettid));
+    char name[16] = {};
+    if (pthread_getname_np(pthread_self(), name, sizeof(name)) == 0) {
+        owned->threadName = name;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    buffer = owned.get();
+    m_buffers.push_back(std::move(owned));
+    return *buffer;
+}
+
+void Tracer::record(const Event& event) {
+    ThreadBuffer& buffer = threadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    if (buffer.events.size() >= kMaxEventsPerThread) {
+        buffer.dropped++;
+        return;
+    }
+    buffer.events.push_back(event);
+}
+
+void Tracer::complete(const char* name, uint64_t startNs, uint64_t endNs) {
+    if (!isEnabled()) return;
+    record({name, startNs, endNs > startNs ? endNs - startNs : 0, 0, 'X'});
+}
+
+void Tracer::asyncSpan(const char* name, uint64_t startNs, uint64_t endNs) {
+    if (!isEnabled()) return;
+    uint64_t id = m_nextAsyncId.fetch_add(1, std::memory_order_relaxed);
+    record({name, startNs, endNs > startNs ? endNs - startNs : 0, id, 'b'});
+}
+
+void Tracer::instant(const char* name) {
+    if (!isEnabled()) return;
+    record({name, monotonicNs(), 0, 0, 'i'});
+}
+
+std::string Tracer::json() const {
+    std::string pid = std::to_string(getpid());
+    std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+
+    auto begin = [&](const char* name, char phase, int tid, uint64_t tsNs) {
+        out += first ? "\n" : ",\n";
+        first = false;
+        out += "{\"name\":\"";
+        appendEscaped(out, name);
+        out += "\",\"cat\":\"zoom\",\"ph\":\"";
+        out += phase;
+        out += "\",\"pid\":" + pid + ",\"tid\":" + std::to_string(tid) + ",\"ts\":";
+        appendMicros(out, tsNs);
+    };
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& buffer : m_buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+
+        if (!buffer->threadName.empty()) {
+            begin("thread_name", 'M', buffer->tid, 0);
+            out += ",\"args\":{\"name\":\"";
+            appendEscaped(out, buffer->threadName);
+            out += "\"}}";
+        }
+
+        for (const auto& event : buffer->events) {
+            switch (event.phase) {
+                case 'X':
+                    begin(event.name, 'X', buffer->tid, event.startNs);
+                    out += ",\"dur\":";
+                    appendMicros(out, event.durationNs);
+                    out += "}";
+                    break;
+                case 'b':
+                    // Async spans are written as a begin/end pair sharing an id
+                    begin(event.name, 'b', buffer->tid, event.startNs);
+                    out += ",\"id\":" + std::to_string(event.id) + "}";
+                    begin(event.name, 'e', buffer->tid, event.startNs + event.durationNs);
+                    out += ",\"id\":" + std::to_string(event.id) + "}";
+                    break;
+                default:
+                    begin(event.name, 'i', buffer->tid, event.startNs);
+                    out += ",\"s\":\"t\"}";
+                    break;
+            }
+        }
+
+        // No logging here: the final write runs from a static destructor
+        if (buffer->dropped) {
+            begin("dropped_events", 'i', buffer->tid, buffer->events.back().startNs);
+            out += ",\"s\":\"t\",\"args\":{\"count\":" + std::to_string(buffer->dropped) + "}}";
+        }
+    }
+    out += "\n]}\n";
+    return out;
+}
+
+} // namespace Util
@@ -0,0 +1,124 @@
+#ifndef HEADLESS_ZOOM_BOT_TRACE_H
+#define HEADLESS_ZOOM_BOT_TRACE_H
+
+#include "MemoryAccounting.h"
+#include "Metrics.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Util {
+
+/**
+ * Span tracer exporting the Chrome trace event format
+ *
+ * Load the output in ui.perfetto.dev or chrome://tracing. Events go to a
+ * buffer owned by the recording thread, so recording never contends with
+ * other threads; the file is written on write(), disable() or process exit.
+ * Meant for lifecycle phases, not per-frame events: each thread keeps at most
+ * kMaxEventsPerThread events and drops the rest.
+ *
+ * Set ZOOM_SDK_TRACE=<path> to record from startup; "%p" in the path is
+ * replaced by the process id, so worker processes don't overwrite each other.
+ */
+class Tracer {
+public:
+    static constexpr size_t kMaxEventsPerThread = 65536;
+
+    static Tracer& getInstance() {
+        static Tracer instance;
+        return instance;
+    }
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    // Start recording; events recorded so far are kept
+    void enable(const std::string& path);
+
+    // Write the trace and stop recording, discarding the events
+    bool disable();
+
+    // Write everything recorded so far, keep recording
+    bool write();
+
+    bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * Record a span that ran on the calling thread
+     * @param name static string, stored by pointer
+     * @param startNs, endNs monotonicNs() readings
+     */
+    void complete(const char* name, uint64_t startNs, uint64_t endNs);
+
+    // Record a span that started and ended in different callbacks; shown on its own track
+    void asyncSpan(const char* name, uint64_t startNs, uint64_t endNs);
+
+    // Record a point in time on the calling thread
+    void instant(const char* name);
+
+    std::string json() const;
+
+private:
+    Tracer();
+    ~Tracer();
+
+    struct Event {
+        const char* name;
+        uint64_t startNs;
+        uint64_t durationNs;
+        uint64_t id;   // async spans only
+        char phase;    // 'X' complete, 'b' async, 'i' instant
+    };
+
+    struct ThreadBuffer {
+        explicit ThreadBuffer(const AccountingAllocator<Event>& allocator) : events(allocator) {}
+
+        std::mutex mutex;   // only contended while the trace is written
+        std::vector<Event, AccountingAllocator<Event>> events;
+        uint64_t dropped = 0;
+        int tid;
+        std::string threadName;
+    };
+
+    ThreadBuffer& threadBuffer();
+    void record(const Event& event);
+    std::string path() const;
+
+    std::atomic<bool> m_enabled{false};
+    std::atomic<uint64_t> m_nextAsyncId{1};
+
+    std::shared_ptr<MemoryAccount> m_memory;
+    mutable std::mutex m_mutex;
+    std::string m_path;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;  // kept after their thread exits
+};
+
+// Records the enclosing scope as a span when tracing is enabled
+class TraceSpan {
+public:
+    explicit TraceSpan(const char* name)
+        : m_name(name), m_start(Tracer::getInstance().isEnabled() ? monotonicNs() : 0) {}
+    ~TraceSpan() {
+        if (m_start) Tracer::getInstance().complete(m_name, m_start, monotonicNs());
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const char* m_name;
+    uint64_t m_start;
+};
+
+} // namespace Util
+
+#define ZTRACE_CONCAT_INNER(a, b) a##b
+#define ZTRACE_CONCAT(a, b) ZTRACE_CONCAT_INNER(a, b)
+#define ZTRACE_SCOPE(name) Util::TraceSpan ZTRACE_CONCAT(zTraceSpan, __LINE__)(name)
+
+#endif // HEADLESS_ZOOM_BOT_TRACE_H
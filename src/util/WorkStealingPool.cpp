@@ -0,0 +1,243 @@
+#include "WorkStealingPool.h"
+
+namespace Util {
+
+static uint64_t elapsedNs(std::chrono::steady_clock::time_point since) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - since).count();
+}
+
+WorkStealingPool::WorkStealingPool(const Options& options)
+    : m_options(options)
+    , m_startTime(std::chrono::steady_clock::now()) {
+    if (m_options.workerCount == 0) {
+        m_options.workerCount = 1;
+    }
+
+    for (size_t i = 0; i < m_options.workerCount; i++) {
+        m_workers.push_back(std::make_unique<Worker>(AccountingAllocator<StreamRef>(m_options.memory)));
+    }
+    for (size_t i = 0; i < m_workers.size(); i++) {
+        m_workers[i]->thread = std::thread(&WorkStealingPool::run, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+
+    for (auto& worker : m_workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+bool WorkStealingPool::submit(const StreamKey& key, Task task) {
+    Shard& shard = m_shards[StreamKeyHash()(key) % kShardCount];
+
+    std::shared_ptr<Stream> stream;
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto& slot = shard.streams[key];
+        if (!slot) {
+            AccountingAllocator<Stream> allocator(m_options.memory);
+            slot = std::allocate_shared<Stream>(allocator, AccountingAllocator<Queued>(m_options.memory));
+            slot->home = StreamKeyHash()(key) % m_workers.size();
+        }
+        stream = slot;
+    }
+
+    bool needsSchedule;
+    {
+        std::lock_guard<std::mutex> lock(stream->mutex);
+        if (stream->removed) {
+            return false;
+        }
+        if (stream->tasks.size() >= m_options.maxQueuedPerStream) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        stream->tasks.push_back({std::move(task), std::chrono::steady_clock::now()});
+        needsSchedule = !stream->scheduled;
+        stream->scheduled = true;
+    }
+
+    if (needsSchedule) {
+        schedule(stream, stream->home);
+    }
+    return true;
+}
+
+void WorkStealingPool::removeGroup(uint64_t group) {
+    std::vector<std::shared_ptr<Stream>> removed;
+    for (auto& shard : m_shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto it = shard.streams.begin(); it != shard.streams.end();) {
+            if (it->first.group == group) {
+                {
+                    std::lock_guard<std::mutex> streamLock(it->second->mutex);
+                    it->second->removed = true;
+                    it->second->tasks.clear();
+                }
+                removed.push_back(std::move(it->second));
+                it = shard.streams.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Outside the shard locks: a running task may submit to other streams meanwhile
+    auto self = std::this_thread::get_id();
+    for (auto& stream : removed) {
+        std::unique_lock<std::mutex> lock(stream->mutex);
+        stream->idle.wait(lock, [&]() { return stream->runner == std::thread::id() || stream->runner == self; });
+    }
+}
+
+std::vector<WorkStealingPool::WorkerStats> WorkStealingPool::stats() const {
+    std::vector<WorkerStats> result;
+    uint64_t uptime = elapsedNs(m_startTime);
+
+    for (const auto& worker : m_workers) {
+        WorkerStats s;
+        s.tasksExecuted = worker->tasksExecuted.load(std::memory_order_relaxed);
+        s.streamsStolen = worker->streamsStolen.load(std::memory_order_relaxed);
+        s.busyNs = worker->busyNs.load(std::memory_order_relaxed);
+        s.uptimeNs = uptime;
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            s.runnableStreams = worker->runnable.size();
+        }
+        for (size_t i = 0; i < kWaitBuckets; i++) {
+            s.waitBuckets[i] = worker->waitBuckets[i].load(std::memory_order_relaxed);
+        }
+        result.push_back(s);
+    }
+    return result;
+}
+
+void WorkStealingPool::schedule(const std::shared_ptr<Stream>& stream, size_t worker) {
+    {
+        std::lock_guard<std::mutex> lock(m_workers[worker]->mutex);
+        m_workers[worker]->runnable.push_back(stream);
+    }
+
+    // Taking the sleep mutex before notifying closes the window where a worker
+    // has checked m_pending but not yet started waiting
+    m_pending.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_wake.notify_one();
+}
+
+std::shared_ptr<WorkStealingPool::Stream> WorkStealingPool::takeRunnable(size_t index) {
+    // Own queue first, oldest stream first to keep latency fair
+    {
+        Worker& self = *m_workers[index];
+        std::lock_guard<std::mutex> lock(self.mutex);
+        if (!self.runnable.empty()) {
+            auto stream = std::move(self.runnable.front());
+            self.runnable.pop_front();
+            m_pending.fetch_sub(1);
+            return stream;
+        }
+    }
+
+    // Steal from the back of the other workers' queues
+    for (size_t i = 1; i < m_workers.size(); i++) {
+        Worker& victim = *m_workers[(index + i) % m_workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.runnable.empty()) {
+            auto stream = std::move(victim.runnable.back());
+            victim.runnable.pop_back();
+            m_pending.fetch_sub(1);
+            m_workers[index]->streamsStolen.fetch_add(1, std::memory_order_relaxed);
+            return stream;
+        }
+    }
+    return nullptr;
+}
+
+void WorkStealingPool::recordWait(Worker& worker, uint64_t waitNs) {
+    size_t bucket = 0;
+    for (uint64_t us = waitNs / 1000; us > 0 && bucket < kWaitBuckets - 1; us >>= 1) {
+        bucket++;
+    }
+    worker.waitBuckets[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+void WorkStealingPool::runStream(size_t index, const std::shared_ptr<Stream>& stream) {
+    Worker& self = *m_workers[index];
+    auto start = std::chrono::steady_clock::now();
+    uint64_t executed = 0;
+
+    // Run a bounded batch so one hot stream cannot monopolize the worker
+    for (size_t n = 0; n < kTasksPerTurn; n++) {
+        Queued queued;
+        {
+            std::lock_guard<std::mutex> lock(stream->mutex);
+            if (stream->tasks.empty()) break;
+            queued = std::move(stream->tasks.front());
+            stream->tasks.pop_front();
+            stream->runner = std::this_thread::get_id();
+        }
+        recordWait(self, elapsedNs(queued.submitted));
+        queued.task();
+        // Destroy the task's captures before removeGroup() may return
+        queued.task = nullptr;
+        executed++;
+
+        std::lock_guard<std::mutex> lock(stream->mutex);
+        stream->runner = std::thread::id();
+        if (stream->removed) {
+            stream->idle.notify_all();
+            break;
+        }
+    }
+
+    self.tasksExecuted.fetch_add(executed, std::memory_order_relaxed);
+    self.busyNs.fetch_add(elapsedNs(start), std::memory_order_relaxed);
+
+    bool more;
+    {
+        std::lock_guard<std::mutex> lock(stream->mutex);
+        more = !stream->tasks.empty();
+        stream->scheduled = more;
+    }
+
+    // Requeue behind other runnable streams; it may get stolen meanwhile
+    if (more) {
+        schedule(stream, index);
+    }
+}
+
+void WorkStealingPool::run(size_t index) {
+    ThreadOptions thread = m_options.thread;
+    thread.name = (thread.name.empty() ? "zoom-media" : thread.name) + "-" + std::to_string(index);
+    thread.cpus.clear();
+    if (!m_options.cpus.empty()) {
+        thread.cpus.push_back(m_options.cpus[index % m_options.cpus.size()]);
+    }
+    applyThreadOptions(thread);
+
+    while (true) {
+        if (auto stream = takeRunnable(index)) {
+            runStream(index, stream);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wake.wait(lock, [this]() { return m_stopping || m_pending.load() > 0; });
+        if (m_stopping) {
+            return;
+        }
+    }
+}
+
+} // namespace Util
@@ -0,0 +1,159 @@
+#ifndef HEADLESS_ZOOM_BOT_WORK_STEALING_POOL_H
+#define HEADLESS_ZOOM_BOT_WORK_STEALING_POOL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "MemoryAccounting.h"
+#include "ThreadOptions.h"
+
+namespace Util {
+
+/**
+ * Fixed-size thread pool for per-stream media processing
+ *
+ * Tasks are submitted against a stream key. Tasks of one stream run one at a
+ * time in submission order, while different streams run in parallel. Each
+ * stream has a home worker picked from its key; idle workers steal runnable
+ * streams from busy ones, so a burst on one stream never stalls the others.
+ */
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    // Identifies a stream; group lets all streams of one owner be dropped at once
+    struct StreamKey {
+        uint64_t group;
+        uint64_t stream;
+
+        bool operator==(const StreamKey& other) const {
+            return group == other.group && stream == other.stream;
+        }
+    };
+
+    struct Options {
+        size_t workerCount = 2;
+        std::vector<int> cpus;          // pin worker i to cpus[i % size], empty = no pinning
+        size_t maxQueuedPerStream = 256; // newer tasks are dropped beyond this
+        ThreadOptions thread;           // name prefix and scheduling of every worker, cpus ignored
+        std::shared_ptr<MemoryAccount> memory; // charged for stream and queue storage, can be null
+    };
+
+    // Queue wait (submit to start of execution) histogram: bucket i counts
+    // waits below 2^i microseconds, the last bucket also counts anything longer
+    static constexpr size_t kWaitBuckets = 24;
+
+    struct WorkerStats {
+        uint64_t tasksExecuted = 0;
+        uint64_t streamsStolen = 0;
+        uint64_t busyNs = 0;
+        uint64_t uptimeNs = 0;
+        size_t runnableStreams = 0;
+        uint64_t waitBuckets[kWaitBuckets] = {};
+    };
+
+    explicit WorkStealingPool(const Options& options);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * Queue a task on a stream
+     * @param key stream the task belongs to
+     * @param task work to run
+     * @return false if the stream queue is full and the task was dropped
+     */
+    bool submit(const StreamKey& key, Task task);
+
+    /**
+     * Forget all streams of a group, discarding their queued tasks
+     * Blocks until tasks of the group already running have finished (except
+     * one running on the calling thread), so once it returns no task of the
+     * group runs again and the group's keys can be reused. Later submits to
+     * streams taken out this way are rejected.
+     * @param group group passed in StreamKey::group
+     */
+    void removeGroup(uint64_t group);
+
+    size_t workerCount() const { return m_workers.size(); }
+    uint64_t droppedTasks() const { return m_dropped.load(std::memory_order_relaxed); }
+    std::vector<WorkerStats> stats() const;
+
+private:
+    struct Queued {
+        Task task;
+        std::chrono::steady_clock::time_point submitted;
+    };
+
+    struct Stream {
+        explicit Stream(const AccountingAllocator<Queued>& allocator) : tasks(allocator) {}
+
+        std::mutex mutex;
+        std::deque<Queued, AccountingAllocator<Queued>> tasks;
+        bool scheduled = false;
+        bool removed = false;           // Taken out by removeGroup(), never runs again
+        std::thread::id runner;         // Thread running one of its tasks, if any
+        std::condition_variable idle;   // Signalled when a removed stream's task finishes
+        size_t home = 0;
+    };
+
+    using StreamRef = std::shared_ptr<Stream>;
+
+    struct Worker {
+        explicit Worker(const AccountingAllocator<StreamRef>& allocator) : runnable(allocator) {}
+
+        std::mutex mutex;
+        std::deque<StreamRef, AccountingAllocator<StreamRef>> runnable;
+        std::thread thread;
+
+        std::atomic<uint64_t> tasksExecuted{0};
+        std::atomic<uint64_t> streamsStolen{0};
+        std::atomic<uint64_t> busyNs{0};
+        std::atomic<uint64_t> waitBuckets[kWaitBuckets] = {};
+    };
+
+    struct StreamKeyHash {
+        size_t operator()(const StreamKey& key) const {
+            return std::hash<uint64_t>()(key.group * 0x9E3779B97F4A7C15ULL ^ key.stream);
+        }
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<StreamKey, std::shared_ptr<Stream>, StreamKeyHash> streams;
+    };
+
+    static constexpr size_t kShardCount = 16;
+    static constexpr size_t kTasksPerTurn = 16;
+
+    void run(size_t index);
+    void schedule(const std::shared_ptr<Stream>& stream, size_t worker);
+    std::shared_ptr<Stream> takeRunnable(size_t index);
+    void runStream(size_t index, const std::shared_ptr<Stream>& stream);
+    static void recordWait(Worker& worker, uint64_t waitNs);
+
+    Options m_options;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    Shard m_shards[kShardCount];
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+    std::atomic<size_t> m_pending{0};
+    std::atomic<bool> m_stopping{false};
+    std::atomic<uint64_t> m_dropped{0};
+    std::chrono::steady_clock::time_point m_startTime;
+};
+
+} // namespace Util
+
+#endif // HEADLESS_ZOOM_BOT_WORK_STEALING_POOL_H